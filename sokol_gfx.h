@@ -44,6 +44,11 @@
     SOKOL_API_DECL              - same as SOKOL_GFX_API_DECL
     SOKOL_API_IMPL              - public function implementation prefix (default: -)
     SOKOL_TRACE_HOOKS           - enable trace hook callbacks (search below for TRACE HOOKS)
+    SOKOL_TRACK_RESOURCE_USAGE  - enable per-resource usage counters (search below for RESOURCE USAGE TRACKING)
+    SOKOL_THREADSAFE_RESOURCES  - allow resource allocation and queued initialization from
+                                  worker threads (search below for RESOURCE CREATION ON WORKER THREADS)
+    SOKOL_THREADLOCAL_CONTEXT   - make the current context a thread-local, so that different
+                                  threads can drive different contexts (search below for MULTIPLE CONTEXTS)
     SOKOL_EXTERNAL_GL_LOADER    - indicates that you're using your own GL loader, in this case
                                   sokol_gfx.h will not include any platform GL headers and disable
                                   the integrated Win32 GL loader
@@ -122,6 +127,11 @@
             sg_pipeline sg_make_pipeline(const sg_pipeline_desc*)
             sg_attachments sg_make_attachments(const sg_attachments_desc*)
 
+        To cheaply create variations of an existing pipeline (for instance
+        with a different blend, depth or cull state), call:
+
+            sg_pipeline sg_make_pipeline_variant(sg_pipeline base_pip, const sg_pipeline_variant_desc*)
+
     --- start a render pass:
 
             sg_begin_pass(const sg_pass* pass);
@@ -162,10 +172,37 @@
         Read the section 'UNIFORM DATA LAYOUT' to learn about the expected memory layout
         of the uniform data passed into sg_apply_uniforms().
 
+        With sg_desc.dedup_uniforms enabled, a call is skipped if the data is
+        identical with the data of the previous sg_apply_uniforms() call on the
+        same uniform block (in the same pass and with the same pipeline), see
+        sg_frame_stats.num_skipped_apply_uniforms. This trades a memcmp() and a
+        copy of the uniform data for the upload and is off by default.
+
     --- kick off a draw call with:
 
             sg_draw(int base_element, int num_elements, int num_instances)
 
+        With sg_desc.coalesce_draws enabled, a non-instanced draw with a points,
+        lines or triangles pipeline is held back until the next state change,
+        and directly following non-instanced draws which continue its element
+        range under unchanged state are merged into it (draws with strip
+        primitive types are never merged), for instance:
+
+            sg_draw(0, 6, 1);
+            sg_apply_uniforms(...);   // skipped if identical and sg_desc.dedup_uniforms is set
+            sg_draw(6, 6, 1);
+            sg_draw(12, 6, 1);
+
+        ...results in a single backend draw call sg_draw(0, 18, 1). The held
+        back draw is issued by the next sg_apply_viewport(), sg_apply_scissor_rect(),
+        sg_apply_pipeline() with a different pipeline, sg_apply_bindings() with
+        different bindings, non-skipped sg_apply_uniforms(), resource update,
+        debug group, sg_reset_state_cache() or sg_end_pass() call. The number of
+        merged draws is tracked in sg_frame_stats.num_coalesced_draws.
+        Don't enable coalescing when mixing sokol-gfx rendering with native
+        3D-API calls inside the same pass, or call sg_reset_state_cache() before
+        issuing native draw calls.
+
         The sg_draw() function unifies all the different ways to render primitives
         in a single call (indexed vs non-indexed rendering, and instanced vs non-instanced
         rendering). In case of indexed rendering, base_element and num_element specify
@@ -227,6 +264,12 @@
         Buffers and images to be updated must have been created with
         SG_USAGE_DYNAMIC or SG_USAGE_STREAM
 
+        The missing mipmaps of an immutable image which has been created
+        with fewer sg_image_desc.num_resident_mipmaps than .num_mipmaps
+        are streamed in with (see PROGRESSIVE MIPMAP STREAMING):
+
+            sg_update_image_mip(sg_image img, int mip_level, const sg_image_data* data)
+
         Only one update per frame is allowed for buffer and image resources when
         using the sg_update_*() functions. The rationale is to have a simple
         countermeasure to avoid the CPU scribbling over data the GPU is currently
@@ -236,6 +279,35 @@
         operation only references the valid (updated) data in the
         buffer or image.
 
+    --- to update only a part of a dynamic or stream buffer, call:
+
+            sg_update_buffer_range(sg_buffer buf, size_t offset, const sg_range* data)
+
+        Unlike sg_update_buffer(), sg_update_buffer_range() can be called
+        several times per frame on the same buffer for different ranges,
+        and the buffer content outside the updated ranges is preserved.
+        This is useful for big buffers where only small parts change
+        each frame (for instance a table of per-entity data in a storage
+        buffer). The offset and size must be multiples of 4.
+
+        To keep the buffer content coherent across the internal per-frame
+        buffer copies (see sg_desc.num_inflight_frames), sokol-gfx keeps a CPU-side
+        shadow copy of the buffer content and tracks which ranges have
+        changed since a buffer copy was last written. When the next buffer
+        copy is activated in a new frame, only those ranges are copied over.
+
+        The shadow copy is created on the first call to sg_update_buffer_range().
+        When switching a buffer from sg_update_buffer() to sg_update_buffer_range(),
+        write the entire buffer content once with sg_update_buffer_range().
+
+        NOTE: on D3D11 each call to sg_update_buffer_range() writes the
+        entire buffer from the shadow copy, because dynamic D3D11 buffers can
+        only be written through a discarding map operation. WebGPU doesn't
+        need a shadow copy, the range is written with wgpuQueueWriteBuffer().
+
+        sg_update_buffer_range() can't be mixed with sg_update_buffer() or
+        sg_append_buffer() on the same buffer in the same frame.
+
     --- to append a chunk of data to a buffer resource, call:
 
             int sg_append_buffer(sg_buffer buf, const sg_range* data)
@@ -274,6 +346,16 @@
         silently dropped (in debug mode this will also result in a
         validation error).
 
+        To avoid having to guess the worst-case size of a buffer used with
+        sg_append_buffer(), the buffer can be created with an optional
+        .max_size which is bigger than .size. When such a buffer overflows,
+        the next frame's first sg_append_buffer() call will reallocate the
+        buffer at twice the size (or more if needed to fit the data appended
+        in the overflown frame), but not bigger than .max_size. The buffer
+        handle remains the same, but the previous buffer content is lost.
+        Each growth step is reported via the log item SG_LOGITEM_BUFFER_GROWN
+        and in the frame stats (num_grow_buffer and size_grow_buffer).
+
         You can also check manually if a buffer is in overflow-state by calling
 
             bool sg_query_buffer_overflow(sg_buffer buf)
@@ -291,6 +373,79 @@
         is associated with one draw call, but will be problematic when
         a single indexed draw call spans several appended chunks of indices.
 
+    --- to suballocate ranges from a big buffer created with
+        sg_buffer_desc.max_views > 0, call:
+
+            sg_buffer_view sg_alloc_buffer_view(sg_buffer buf, size_t size)
+            void sg_free_buffer_view(sg_buffer_view view)
+
+        See the section BUFFER VIEWS below for details.
+
+    --- to get short-lived render target images (and matching attachments
+        objects) from a pool of recycled images, call:
+
+            sg_image sg_acquire_transient_image(const sg_image_desc* desc)
+            void sg_release_transient_image(sg_image img)
+            sg_attachments sg_make_transient_attachments(const sg_attachments_desc* desc)
+
+        See the section TRANSIENT RENDER TARGETS below for details.
+
+    --- to keep the memory used by streamed textures below a budget, create
+        them with sg_image_desc.evictable = true and configure the budget
+        in sg_desc.residency, images can be protected from eviction with:
+
+            void sg_pin_image(sg_image img)
+            void sg_unpin_image(sg_image img)
+
+        See the section IMAGE RESIDENCY below for details.
+
+    --- to share backend objects between immutable buffers and images with
+        identical content, set sg_desc.dedup_immutable_resources to true,
+        and get the number of shared resources and saved memory with:
+
+            sg_dedup_stats sg_query_dedup_stats(void)
+
+        See the section RESOURCE DEDUPLICATION below for details.
+
+    --- to read back the content of a render target image without stalling
+        the CPU, call:
+
+            bool sg_read_image_async(sg_image img, const sg_read_image_desc* desc)
+
+        The pixel data is delivered to a callback function in a later sg_commit().
+        See the section IMAGE READBACK below for details.
+
+    --- to copy data between buffers or images on the GPU (outside of passes),
+        call:
+
+            void sg_copy_buffer(sg_buffer dst, size_t dst_offset, sg_buffer src, size_t src_offset, size_t size)
+            void sg_copy_image_region(const sg_image_copy_desc* desc)
+
+        See the section GPU COPIES below for details.
+
+    --- to avoid shader and pipeline creation hitches on startup, record the
+        shaders and pipelines created in a previous run with
+        sg_desc.record_manifest, save the result of:
+
+            size_t sg_export_manifest(const sg_range* dst)
+
+        ...and spread the creation of the recorded objects over the first
+        frames of the next run with:
+
+            bool sg_prewarm(const sg_range* manifest, double budget_ms)
+
+        See the section SHADER AND PIPELINE MANIFESTS below for details.
+
+    --- to drive several independent sokol-gfx instances (for instance a
+        headless renderer next to the main renderer), create additional
+        contexts and switch between them:
+
+            sg_context sg_make_context(const sg_desc* desc)
+            void sg_set_context(sg_context ctx)
+            void sg_destroy_context(sg_context ctx)
+
+        See the section MULTIPLE CONTEXTS below for details.
+
     --- to check at runtime for optional features, limits and pixelformat support,
         call:
 
@@ -363,6 +518,12 @@
             sg_disable_frame_stats()
             sg_frame_stats_enabled()
 
+    --- you can check whether the CPU or the GPU is the bottleneck via:
+
+            sg_query_frame_pacing()
+
+        (see the section FRAME PACING for details)
+
     --- you can ask at runtime what backend sokol_gfx.h has been compiled for:
 
             sg_backend sg_query_backend(void)
@@ -973,8 +1134,9 @@
     - all GLES3 platforms (WebGL2, iOS, Android - with the option that support on
       Android may be added at a later point)
 
-    Currently only 'readonly' storage buffers are supported (meaning it's not possible
-    to write to storage buffers from shaders).
+    In vertex- and fragment-shaders, only 'readonly' storage buffers are supported
+    (meaning it's not possible to write to storage buffers from render shaders),
+    compute shaders may also write to storage buffers (see COMPUTE PASSES below).
 
     To use storage buffers, the following steps are required:
 
@@ -986,8 +1148,8 @@
           of automatically)
             - which storage buffer bind slots on the vertex- and fragment-stage
               are occupied
-            - whether the storage buffer on that bind slot is readonly (this is currently required
-              to be true)
+            - whether the storage buffer on that bind slot is readonly (this is required
+              to be true for vertex- and fragment-shaders)
         - when calling sg_apply_bindings(), apply the matching bind slots with the previously
           created storage buffers
         - ...and that's it.
@@ -1159,6 +1321,332 @@
         - SG_VERTEXFORMAT_HALF4
 
 
+    BUFFER VIEWS (SUBALLOCATING BUFFER RANGES)
+    ==========================================
+    When rendering many small meshes it is often better to put the vertex-
+    and index-data of many meshes into a single big buffer instead of creating
+    one sg_buffer object per mesh. This keeps the pressure on the buffer pool
+    low, and consecutive draw calls only need to update the buffer offsets
+    in sg_apply_bindings() instead of binding new buffer objects.
+
+    sokol-gfx provides a simple free-list allocator for managing ranges in
+    such shared buffers. To enable the allocator on a buffer, provide the
+    maximum number of ranges that can be allocated at the same time
+    in the sg_buffer_desc.max_views item:
+
+        sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+            .size = 4 * 1024 * 1024,
+            .usage = SG_USAGE_DYNAMIC,
+            .max_views = 1024,
+            .view_alignment = 16,     // optional, default is 4
+        });
+
+    Then allocate buffer views of a specific size:
+
+        sg_buffer_view view = sg_alloc_buffer_view(buf, num_bytes);
+
+    The returned sg_buffer_view struct contains the buffer handle, the
+    start offset and size of the allocated range. The offset will be a
+    multiple of .view_alignment, and the size will be rounded up to a
+    multiple of .view_alignment. If the allocation fails (because no
+    contiguous free range of the requested size exists, or because .max_views
+    allocations are already active), a zero-initialized sg_buffer_view struct
+    will be returned and a warning will be logged.
+
+    The buffer view is used like this in sg_apply_bindings():
+
+        sg_apply_bindings(&(sg_bindings){
+            .vertex_buffers[0] = view.buffer,
+            .vertex_buffer_offsets[0] = view.offset,
+            ...
+        });
+
+    ...and after the buffer range is no longer needed, return it to the
+    buffer's free-list:
+
+        sg_free_buffer_view(view);
+
+    Adjacent free ranges will be merged. The current state of the buffer's
+    free-list can be inspected with sg_query_buffer_info() in the nested
+    .views struct (number of active views, number of free ranges, the overall
+    number of free bytes and the size of the biggest free range). If the
+    biggest free range is much smaller than the overall free size, the
+    buffer is fragmented.
+
+    Note that sokol-gfx only manages the allocation of buffer ranges, it is
+    up to the application to populate the buffer ranges with data. Also
+    keep in mind that the GPU may still access a freed buffer range
+    in the current and previous frames, so a freed range should not be
+    overwritten for sg_desc.num_inflight_frames frames.
+
+
+    TRANSIENT RENDER TARGETS
+    ========================
+    Many render targets are only needed for a small part of a frame (for
+    instance the downsample chain of a bloom effect, or the ping-pong
+    images of a blur). Instead of creating a permanent image and attachments
+    object for each of those, render target images can be borrowed from
+    a pool of transient images:
+
+        sg_image img = sg_acquire_transient_image(&(sg_image_desc){
+            .render_target = true,
+            .width = 1024,
+            .height = 512,
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+        });
+
+    If the pool contains an image which is currently not acquired and
+    has the same type, size, number of slices and mipmaps, pixel format and
+    sample count, that image will be returned, otherwise a new image will be
+    created. Only render target images can be acquired.
+
+    To render into a transient image, get an attachments object with:
+
+        sg_attachments atts = sg_make_transient_attachments(&(sg_attachments_desc){
+            .colors[0].image = img,
+        });
+
+    ...this returns a cached attachments object if one with the same
+    attachment images, mip levels and slices has been created before.
+    Attachments objects returned by sg_make_transient_attachments() are
+    owned by the transient pool and must not be destroyed by the caller.
+
+    After the last pass which reads the image has been recorded, return
+    the image to the pool:
+
+        sg_release_transient_image(img);
+
+    A released image may be handed out again by sg_acquire_transient_image()
+    in the same frame. This is safe because sokol-gfx passes are executed in
+    the order they are recorded, but the content of a released image must be
+    considered undefined.
+
+    Images and attachments objects in the pool which haven't been used for
+    sg_desc.transient_max_unused_frames frames (default: 8) are destroyed
+    in sg_commit(), and so are cached attachments objects referencing
+    such an image. An attachments object counts as used when it is
+    returned by sg_make_transient_attachments() or passed to
+    sg_begin_pass(), so it's fine to keep it around across frames. The
+    maximum number of images in the pool is defined by
+    sg_desc.transient_pool_size (default: 64), and the size of the
+    attachments cache by sg_desc.transient_attachments_cache_size (default:
+    same as transient_pool_size).
+
+    Call sg_query_transient_stats() to get the current and peak memory used
+    by transient images, and the number of acquired and reused images
+    (num_reused / num_acquired is the reuse rate).
+
+    Transient images must not be destroyed with sg_destroy_image(), and the
+    transient pool functions must be called from the thread which calls
+    sg_commit(), also with SOKOL_THREADSAFE_RESOURCES.
+
+
+    IMAGE RESIDENCY
+    ===============
+    Applications which stream more textures than fit into GPU memory can
+    let sokol-gfx decide which textures to throw out. First configure a
+    memory budget in bytes and a callback in sg_setup():
+
+        sg_setup(&(sg_desc){
+            .residency = {
+                .budget = 512 * 1024 * 1024,
+                .evicted_func = my_evicted_func,
+                .user_data = ...,
+            },
+        });
+
+    ...and create the streamed textures as evictable images, optionally
+    with an eviction priority:
+
+        sg_image img = sg_make_image(&(sg_image_desc){
+            .evictable = true,
+            .evict_priority = 10,
+            ...
+        });
+
+    The memory cost of an evictable image is estimated from its pixel format,
+    size, number of mipmaps and slices. Each time an image is bound in
+    sg_apply_bindings() the current frame index is recorded in the image.
+
+    When the memory used by all evictable images exceeds the budget in
+    sg_commit(), images are evicted until the budget is met again. Images
+    with a lower evict_priority are evicted first, and among images with
+    the same priority the least recently used image is evicted first.
+    Images which have been used or created in the current frame are never
+    evicted, and neither are images which have been pinned with:
+
+        sg_pin_image(img);
+
+    ...until they are unpinned again with:
+
+        sg_unpin_image(img);
+
+    An evicted image keeps its handle, but its GPU resources are destroyed
+    and the image goes back into the ALLOC resource state. The callback is
+    called with the image handle:
+
+        void my_evicted_func(sg_image img, void* user_data) {
+            // queue img for re-streaming...
+        }
+
+    While an image is evicted, sg_apply_bindings() silently binds a 1x1
+    black placeholder image of the same image type instead, so rendering
+    continues without validation errors. To restore the image, initialize
+    it again with sg_init_image() once its data has been streamed in (or
+    destroy it with sg_destroy_image() if it is no longer needed).
+
+    Evictable images can't be render targets or storage images, and must
+    use a filterable color pixel format (so that the placeholder is a valid
+    substitute).
+
+    Call sg_query_residency_stats() to get the memory used by resident
+    evictable images, and the number of evicted images and placeholder
+    bindings.
+
+    A budget of 0 (the default) disables eviction.
+
+
+    PROGRESSIVE MIPMAP STREAMING
+    ============================
+    Large textures don't need to be fully loaded before they can be used.
+    An immutable image can be created with its full mipmap chain, but only
+    initial data for the smallest mipmaps:
+
+        sg_image img = sg_make_image(&(sg_image_desc){
+            .width = 1024,
+            .height = 1024,
+            .num_mipmaps = 11,
+            .num_resident_mipmaps = 4,
+            .data.subimage[0] = {
+                [7] = SG_RANGE(mip7),
+                [8] = SG_RANGE(mip8),
+                [9] = SG_RANGE(mip9),
+                [10] = SG_RANGE(mip10),
+            },
+        });
+
+    The image can be used for rendering right away, but samplers only see
+    the resident mipmaps (so the 1024x1024 texture first looks like a
+    blurry 8x8 texture). The missing mipmaps are uploaded later as their
+    data arrives, each mipmap exactly once:
+
+        sg_update_image_mip(img, 6, &(sg_image_data){
+            .subimage[0][6] = SG_RANGE(mip6),
+        });
+
+    The image data must be provided in the sg_image_data item of the
+    updated mipmap for each cube face (for array and 3D images, the item
+    contains all slices, same as in sg_make_image()).
+
+    When a mipmap becomes resident, the most detailed mipmap which can be
+    sampled moves to the highest resident mipmap that has no non-resident
+    mipmaps below it (so uploading the mipmaps from small to large gives a
+    smooth quality ramp-up). On the GL backend this is the texture's
+    GL_TEXTURE_BASE_LEVEL, which is independent from the sampler's
+    min_lod and max_lod.
+
+    Call sg_query_image_info() to get the current .base_mip_level of
+    the image (0 when all mipmaps are resident). The memory estimate of an
+    evictable image (see IMAGE RESIDENCY) only includes resident mipmaps
+    and grows as mipmaps are streamed in.
+
+    Progressive mipmap streaming is supported on the GL and dummy backends,
+    check sg_features.mip_streaming at runtime. On other backends, creating
+    an image with fewer resident mipmaps fails. Streamed images can't be
+    render targets, storage images or injected images, and since they
+    don't have data for mipmap 0 they are never deduplicated (see RESOURCE
+    DEDUPLICATION).
+
+
+    RESOURCE USAGE TRACKING
+    =======================
+    When the implementation is compiled with SOKOL_TRACK_RESOURCE_USAGE
+    defined, sokol-gfx keeps a couple of usage counters in the pool slots
+    of buffers and images. Those can be used to find resources which haven't
+    been used for a long time and only waste memory, or 'hot' resources
+    which are used many times per frame.
+
+    A resource counts as 'used' when it is bound in sg_apply_bindings()
+    (only if the bindings are valid), or in case of images also when
+    sg_begin_pass() is called with an attachments object which references
+    the image.
+
+    The counters are returned in the .usage item of sg_buffer_info and
+    sg_image_info:
+
+        .last_used_frame_index  the frame index of the last use (0 if the
+                                resource has never been used)
+        .num_binds              number of uses in the current frame
+        .num_binds_prev_frame   number of uses in the previous frame
+        .num_binds_total        number of uses since the resource was created
+        .num_updated_bytes      number of bytes written with sg_update_buffer(),
+                                sg_update_buffer_range(), sg_append_buffer()
+                                or sg_update_image() since the resource was created
+
+    To iterate over all live (valid) buffers and images call
+    sg_query_next_buffer() and sg_query_next_image() with the previous
+    handle, starting with an invalid handle:
+
+        const uint32_t max_unused_frames = 600;
+        for (sg_image img = sg_query_next_image((sg_image){0}); img.id; img = sg_query_next_image(img)) {
+            const sg_resource_usage usage = sg_query_image_info(img).usage;
+            if ((cur_frame_index - usage.last_used_frame_index) > max_unused_frames) {
+                // image hasn't been used for 600 frames...
+            }
+        }
+
+    The iterator functions are also available without SOKOL_TRACK_RESOURCE_USAGE,
+    but the usage counters will then always be zero. Without
+    SOKOL_TRACK_RESOURCE_USAGE, the usage tracking doesn't add any overhead.
+
+
+    RESOURCE DEDUPLICATION
+    ======================
+    Asset pipelines often produce byte-identical meshes and textures (for
+    instance the same prop exported into several asset packages). To avoid
+    creating a separate backend object for each copy, enable deduplication
+    in sg_setup():
+
+        sg_setup(&(sg_desc){
+            .dedup_immutable_resources = true,
+            ...
+        });
+
+    With deduplication enabled, sg_make_buffer() and sg_make_image() compute
+    a 64-bit hash over the creation attributes and content of immutable
+    resources. If a live resource with the same hash exists, its handle
+    is returned and a reference counter is incremented instead of creating
+    a new backend object. sg_destroy_buffer() and sg_destroy_image() decrement
+    the reference counter and only destroy the resource when the last
+    reference is gone. This means that identical handles may be returned
+    by different sg_make_*() calls, and each sg_make_*() call must still
+    be matched by one sg_destroy_*() call.
+
+    The content is hashed in a single streaming pass over the data (with
+    an XXH64-style hash at several GB/s). To guard against hash collisions,
+    sokol-gfx keeps a CPU-side copy of the content of each deduplicated
+    resource, and compares it byte by byte with the new content when the
+    hash matches. Note that this copy doubles the CPU memory cost of a
+    deduplicated resource's initial content while the resource is alive.
+
+    Only resources which are created with sg_make_buffer() or sg_make_image()
+    and have initial content in .data are considered, and only if they are:
+
+        - SG_USAGE_IMMUTABLE
+        - not injected native 3D-API resources
+        - buffers: not suballocated with buffer views or growable (.max_views
+          and .max_size are 0)
+        - images: not render targets, storage images or evictable images
+
+    Don't call sg_uninit_buffer(), sg_uninit_image(), sg_dealloc_buffer()
+    or sg_dealloc_image() on deduplicated resources, since this would
+    pull the resource out from under all other references.
+
+    Call sg_query_dedup_stats() to get the number of unique deduplicated
+    resources, the number of sg_make_*() calls which returned an existing
+    resource and the (estimated) memory which is currently saved.
+
+
     MEMORY ALLOCATION OVERRIDE
     ==========================
     You can override the memory allocation functions at initialization time
@@ -1273,6 +1761,61 @@
     listener item was found and removed, and false otherwise.
 
 
+    FRAME PACING
+    ============
+    Frame pacing is disabled by default. When sg_desc.max_frames_ahead is
+    set to a value > 0, sg_commit() inserts a fence into the GPU command
+    stream at the end of each frame and then blocks until the GPU has
+    finished the frame which was committed max_frames_ahead frames ago
+    (sg_commit() never waits for the frame it has just committed). This
+    bounds how far the CPU may run ahead of the GPU, and thus the input
+    latency:
+
+        sg_setup(&(sg_desc){
+            .max_frames_ahead = 1,
+            ...
+        });
+
+    The time spent waiting, and the number of frames the GPU is behind the
+    CPU, can be inspected after sg_commit() with:
+
+        const sg_frame_pacing pacing = sg_query_frame_pacing();
+
+    The returned struct has the following items:
+
+        .frame_index            the frame index of the last sg_commit()
+        .max_frames_in_flight   the clamped sg_desc.max_frames_ahead value
+        .frames_in_flight       the number of committed frames which the GPU
+                                hadn't finished yet at the end of the last
+                                sg_commit(), i.e. the CPU/GPU latency in frames
+        .wait_ms                the CPU time spent in the last frame waiting
+                                for the GPU
+        .total_wait_ms          accumulated wait time since sg_setup()
+        .num_waits              number of frames where the CPU had to wait
+                                for the GPU since sg_setup()
+
+    As a rule of thumb, if .wait_ms is regularly > 0 the application is
+    GPU-bound, and if .frames_in_flight stays at 0 the application is
+    CPU-bound (the GPU finishes each frame before the CPU has committed
+    the next one).
+
+    Backend specifics:
+
+    - GL: uses glFenceSync() and glClientWaitSync(). On WebGL, blocking waits
+      are not allowed, so the CPU never waits there (the browser paces
+      frames instead), but .frames_in_flight is still measured.
+    - Metal: frame pacing is always done with a semaphore in the first
+      sg_begin_pass() of a frame (bounded by sg_desc.num_inflight_frames),
+      the time spent there is reported in .wait_ms, but .frames_in_flight
+      is always 0.
+    - D3D11 and WebGPU: frame pacing is handled by the 3D API and swapchain,
+      all values except .frame_index and .max_frames_in_flight are 0.
+    - the dummy backend simulates a GPU which finishes each frame
+      sg_desc.dummy_gpu_latency_ms milliseconds after it has been
+      committed, this is mainly useful for tests. It never actually blocks,
+      instead the remaining simulated GPU time is reported as wait time.
+
+
     RESOURCE CREATION AND DESTRUCTION IN DETAIL
     ===========================================
     The 'vanilla' way to create resource objects is with the 'make functions':
@@ -1437,6 +1980,332 @@
     an attachments object with invalid image objects.
 
 
+    RESOURCE CREATION ON WORKER THREADS
+    ===================================
+    By default, all sokol-gfx functions must be called from the same thread.
+    When compiling the implementation with SOKOL_THREADSAFE_RESOURCES defined,
+    a small subset of functions may also be called from other threads,
+    which allows to create buffers and images directly from asset loader
+    threads without marshalling each call to the render thread:
+
+        sg_alloc_buffer()
+        sg_alloc_image()
+        sg_alloc_sampler()
+        sg_alloc_shader()
+        sg_alloc_pipeline()
+        sg_alloc_attachments()
+        sg_queue_init_buffer()
+        sg_queue_init_image()
+
+    The resource pools are protected by a mutex (pthreads on POSIX platforms,
+    a critical section on Windows, and a no-op on Emscripten). On a worker
+    thread, allocate a resource handle, and queue the resource
+    initialization:
+
+        sg_image img = sg_alloc_image();
+        sg_queue_init_image(img, &(sg_image_desc){ ... });
+
+    The handle can be used immediately, for instance by handing it over to
+    the render thread. sg_queue_init_buffer() and sg_queue_init_image() copy
+    the desc struct, the resource content and the debug label, so all data
+    pointed to by the desc struct can be released right after the call
+    returns. The actual resource initialization happens on the render thread
+    at the start of the next sg_commit(), until then the resource will
+    remain in the ALLOC state and draw calls using the resource will be
+    silently skipped (just like with the other asynchronous resource
+    creation functions described above).
+
+    Without SOKOL_THREADSAFE_RESOURCES, sg_queue_init_buffer() and
+    sg_queue_init_image() simply call sg_init_buffer() and sg_init_image().
+
+    Please note:
+
+    - the sg_desc.allocator and sg_desc.logger callbacks must be thread-safe
+    - don't call sg_dealloc_*() on a handle after its initialization has
+      been queued
+    - sg_setup() and sg_shutdown() must not run while other threads
+      allocate resources
+    - with SOKOL_THREADLOCAL_CONTEXT, worker threads must call sg_set_context()
+      before allocating resources in a context other than the default context
+    - the trace hooks (for instance sokol_gfx_imgui.h) are not thread-safe,
+      so they are only called for sg_alloc_*() on the thread which called
+      sg_setup(), queued initializations are reported as init_buffer and
+      init_image events when they are processed in sg_commit()
+    - the init queue is only locked while the pending items are swapped out,
+      so worker threads are not blocked while sg_commit() creates the
+      backend resources
+
+
+    IMAGE READBACK
+    ==============
+    The content of a render target image can be read back into CPU memory
+    with sg_read_image_async(). The function returns immediately, and the
+    pixel data is passed into a callback function once the GPU has finished
+    rendering into the image and the data has been copied over:
+
+        static void readback_done(const sg_image_readback* rb) {
+            // rb->data.ptr and rb->data.size point to the pixel data
+            save_thumbnail(rb->width, rb->height, rb->data.ptr, rb->user_data);
+        }
+
+        sg_read_image_async(img, &(sg_read_image_desc){
+            .callback = readback_done,
+            .user_data = ...,
+        });
+
+    By default the entire image is read back, to read back a sub-rectangle
+    set the sg_read_image_desc.x, .y, .width and .height items.
+
+    Please note:
+
+    - only 2D render target images with a sample count of 1 and a color
+      pixel format can be read back (to read back an MSAA render target,
+      read back its resolve image)
+    - sg_read_image_async() must be called outside of render passes, and
+      the readback sees all rendering into the image recorded before the call
+    - the pixel data is tightly packed (no row padding), and the rows are
+      stored in the backend's native order (bottom-to-top on GL, see
+      sg_features.origin_top_left)
+    - the data pointer is only valid inside the callback
+    - the callback is called from inside sg_commit() (or on the dummy backend
+      from inside sg_read_image_async()), typically one or two frames after the
+      readback has been started, and at the latest after sg_desc.num_inflight_frames
+      frames (in that case the CPU waits for the GPU)
+    - readbacks which are still pending in sg_shutdown() are dropped
+    - the maximum number of pending readbacks is defined by
+      sg_desc.readback_pool_size (default: 16)
+    - on GLES3 the only pixel format guaranteed to be readable is RGBA8
+    - sg_read_image_async() is currently only supported on the GL and
+      dummy backends (but not on WebGL2), check sg_features.image_readback
+      at runtime
+
+    On the GL backends, the readback is implemented with glReadPixels() into a
+    ring of pixel buffer objects, and a fence object to check whether the
+    copy has finished. The number of bytes read back and the number of times
+    the CPU had to wait for a fence are tracked in the frame stats
+    (size_read_image_async and gl.num_readback_fence_waits).
+
+
+    GPU COPIES
+    ==========
+    Data can be copied between buffers, and between images, without a
+    roundtrip through CPU memory (for instance to compact a texture atlas,
+    or to defragment a buffer managed with buffer views):
+
+        sg_copy_buffer(dst_buf, dst_offset, src_buf, src_offset, num_bytes);
+
+        sg_copy_image_region(&(sg_image_copy_desc){
+            .dst = { .image = atlas, .x = 64, .y = 128 },
+            .src = { .image = tile_img },
+            .width = 32,
+            .height = 32,
+        });
+
+    sg_copy_image_region() copies a rectangle from a mip level and a range of
+    slices (cube faces, array layers or 3D depth slices) of the source image
+    into the destination image. The width and height default to the remaining
+    size of the source mip level starting at .src.x and .src.y, and
+    .num_slices defaults to 1.
+
+    Please note:
+
+    - copies must happen outside of passes, a copy is ordered after all
+      rendering and compute work recorded before the call
+    - the destination buffer can't have SG_USAGE_IMMUTABLE, the destination
+      image must either have SG_USAGE_DYNAMIC/STREAM, or be a render target
+      or storage image (copying into an immutable resource would modify
+      resources which may be shared via sg_desc.dedup_immutable_resources)
+    - a copy reads the currently active backing buffer or texture of a
+      dynamic or stream resource, and writes the currently active backing
+      buffer or texture of the destination; the copied data will be replaced
+      by the next sg_update_*() or sg_append_buffer() call as usual
+    - if the destination buffer is updated with sg_update_buffer_range(), its
+      shadow copy is kept coherent, this requires that the source buffer also
+      has a shadow copy (for instance when copying within the same buffer)
+    - buffer offsets and the copy size must be multiples of 4, and source
+      and destination ranges must not overlap when copying within the same
+      buffer
+    - images must have the same pixel format and a sample count of 1, and
+      compressed pixel formats are not supported
+    - sg_copy_buffer() is supported on the GL and dummy backends, and
+      sg_copy_image_region() on GL 4.3 and the dummy backend, check
+      sg_features.copy_buffer and sg_features.copy_image at runtime
+
+    The number of copies and copied bytes are tracked in the frame stats
+    (num_copy_buffer, size_copy_buffer, num_copy_image and size_copy_image).
+
+
+    COMPUTE PASSES
+    ==============
+    Compute shaders can be used to write to storage buffers and storage images
+    on the GPU, for instance for particle simulation or GPU culling. Compute
+    support is currently only implemented on the GLCORE backend (which requires
+    GL 4.3) and on the dummy backend, check sg_features.compute at runtime.
+
+    To run a compute shader:
+
+        - create a compute shader by providing the shader code in
+          sg_shader_desc.cs (instead of .vs and .fs), together with the
+          usual reflection info for uniform blocks, storage buffers and
+          images, storage buffers in compute shaders may be read-write
+          (sg_shader_storage_buffer_desc.readonly = false)
+        - storage images (images which are written or read by the compute shader
+          via imageLoad() and imageStore() in GLSL) are described in
+          sg_shader_stage_desc.storage_images[], the matching images must be
+          created with sg_image_desc.storage_image = true
+        - create a compute pipeline object with sg_pipeline_desc.compute = true,
+          a compute pipeline only has a shader and no render state
+        - start a compute pass with sg_begin_pass(&(sg_pass){ .compute = true }),
+          a compute pass has no pass action, attachments or swapchain
+        - inside the compute pass, call sg_apply_pipeline(), sg_apply_bindings()
+          (with the resource bindings in sg_bindings.cs), sg_apply_uniforms()
+          (with SG_SHADERSTAGE_CS) and sg_dispatch() to start the compute shader
+          with the number of workgroups in the x-, y- and z-dimension
+        - finish the compute pass with sg_end_pass() as usual
+
+    For instance:
+
+        sg_begin_pass(&(sg_pass){ .compute = true });
+        sg_apply_pipeline(compute_pip);
+        sg_apply_bindings(&(sg_bindings){
+            .cs.storage_buffers[0] = particle_buffer,
+        });
+        sg_apply_uniforms(SG_SHADERSTAGE_CS, 0, &SG_RANGE(params));
+        sg_dispatch(num_particles / 64, 1, 1);
+        sg_end_pass();
+
+    The storage buffers written by the compute pass can then be used as
+    readonly storage buffers in render passes, or as vertex- or index-buffers
+    if they have been created with the matching buffer type.
+
+    In the GL backend, sokol-gfx will take care of the required memory barriers
+    between dispatches, and at the end of a compute pass, so that the results
+    of a compute shader are visible to subsequent dispatches and render passes.
+
+    NOTE: on the GL backend, the compute-shader stage internally shares the bind
+    slots with the vertex-shader stage, this is relevant when writing GLSL code
+    without sokol-shdc (storage buffers in compute shaders use the same
+    'binding=N' slots as vertex shader storage buffers, and storage images use
+    'binding=N' where N is the storage image slot index).
+
+
+    SHADER AND PIPELINE MANIFESTS
+    =============================
+    Creating shader and pipeline objects may be expensive (for instance on GL
+    the shader compilation is often deferred by the driver until the first draw
+    call). To move this cost out of the first frames where an object is used,
+    sokol-gfx can record the creation parameters of all shader and pipeline
+    objects into a 'manifest', and create the recorded objects in the next run
+    before the application asks for them.
+
+    To record a manifest, set sg_desc.record_manifest to true, and before
+    shutting down, get the manifest data and write it to a file:
+
+        const size_t size = sg_query_manifest_size();
+        void* ptr = malloc(size);
+        sg_export_manifest(&(sg_range){ ptr, size });
+        save_file("shaders.sgmf", ptr, size);
+
+    In the next run, call sg_prewarm() once per frame with the loaded manifest
+    and a time budget in milliseconds until the function returns true:
+
+        if (!prewarm_done) {
+            prewarm_done = sg_prewarm(&manifest, 2.0);
+        }
+
+    Each call creates recorded shaders and pipelines until the time budget is
+    used up (but always at least one object), in the order in which the
+    objects were first used with sg_apply_pipeline() when the manifest was
+    recorded. Objects which were never used are created last.
+
+    When the application later calls sg_make_shader() or sg_make_pipeline()
+    with creation parameters which match a prewarmed object, the prewarmed
+    object is returned instead of creating a new one (for pipelines, the
+    sg_pipeline_desc.shader handle must also be the prewarmed shader). If the
+    application creates an object before sg_prewarm() got to it, the object
+    won't be created a second time.
+
+    Please note:
+
+    - the manifest data is copied in the first call to sg_prewarm(), the
+      manifest argument is ignored in following calls
+    - the manifest format is compact but not portable: it stores the creation
+      parameters in host byte order and is tied to the backend it was recorded
+      with (a manifest from a different backend is ignored with a warning)
+    - a manifest which doesn't match the application anymore (e.g. after a
+      shader has been changed) is harmless, the outdated objects are created
+      but never claimed, and the new objects are created as usual
+    - prewarmed objects which are never claimed by sg_make_shader() or
+      sg_make_pipeline() are destroyed in sg_shutdown()
+    - the manifest contains the shader source code or bytecode, but no
+      driver-specific program binaries
+    - the number of objects created by sg_prewarm() and the number of
+      prewarmed objects returned by sg_make_shader() and sg_make_pipeline()
+      are tracked in the frame stats (num_prewarm and num_prewarm_hits)
+
+
+    MULTIPLE CONTEXTS
+    =================
+    All sokol-gfx state (resource pools, state caches, frame stats, commit
+    listeners, backend objects...) lives in a context. The context initialized
+    by sg_setup() is the 'default context', and all sokol-gfx functions operate
+    on the 'current context', which is the default context unless another
+    context has been activated.
+
+    To create an additional context, call:
+
+        sg_context ctx = sg_make_context(&(sg_desc){ ... });
+
+    This is the same as calling sg_setup() in a fresh context, the sg_desc
+    struct is interpreted the same way (and the context's memory is
+    allocated through sg_desc.allocator). The current context doesn't change.
+
+    To make a context current:
+
+        sg_set_context(ctx);
+
+    ...and to switch back to the default context:
+
+        sg_set_context(sg_default_context());
+
+    Switching contexts is cheap (it only changes a pointer), but note that
+    resource handles are only valid in the context which created them,
+    and that the frame index and per-frame stats are tracked separately
+    per context (so each context needs its own sg_commit() per frame).
+
+    With the GL backends, each sokol-gfx context should be associated with
+    its own GL context, make the GL context current *before* calling
+    sg_make_context() and sg_set_context(), sokol-gfx doesn't know anything
+    about GL contexts. It's also fine to use several sokol-gfx contexts with
+    the same GL context, but in that case call sg_reset_state_cache() after
+    switching contexts because the state cache of the newly activated
+    context doesn't know about changes made by the other context.
+
+    To destroy a context and all its resources:
+
+        sg_destroy_context(ctx);
+
+    If the destroyed context is current, the default context becomes current.
+    The default context is destroyed with sg_shutdown() as usual.
+
+    By default, the current context is a global, so contexts must be switched
+    explicitly even when they are driven from different threads. When the
+    implementation is compiled with SOKOL_THREADLOCAL_CONTEXT, the current
+    context is tracked per thread, each thread starts out with the default
+    context as current, and different threads can render into different
+    contexts at the same time. This makes every access to the context state
+    go through a thread-local pointer which is a bit slower on some platforms.
+
+    Please note:
+
+    - at most 16 contexts can exist at the same time (including the default context)
+    - sg_make_context() and sg_destroy_context() must not be called
+      concurrently, and a context must not be destroyed while it
+      is current on another thread
+    - a context must only be used by one thread at a time (except for the
+      functions listed in RESOURCE CREATION ON WORKER THREADS)
+
+
     WEBGPU CAVEATS
     ==============
     For a general overview and design notes of the WebGPU backend see:
@@ -1609,6 +2478,7 @@ typedef struct sg_sampler       { uint32_t id; } sg_sampler;
 typedef struct sg_shader        { uint32_t id; } sg_shader;
 typedef struct sg_pipeline      { uint32_t id; } sg_pipeline;
 typedef struct sg_attachments   { uint32_t id; } sg_attachments;
+typedef struct sg_context       { uint32_t id; } sg_context;
 
 /*
     sg_range is a pointer-size-pair struct used to pass memory blobs into
@@ -1640,12 +2510,14 @@ enum {
     SG_INVALID_ID = 0,
     SG_NUM_SHADER_STAGES = 2,
     SG_NUM_INFLIGHT_FRAMES = 2,
+    SG_MAX_INFLIGHT_FRAMES = 3,
     SG_MAX_COLOR_ATTACHMENTS = 4,
     SG_MAX_VERTEX_BUFFERS = 8,
     SG_MAX_SHADERSTAGE_IMAGES = 12,
     SG_MAX_SHADERSTAGE_SAMPLERS = 8,
     SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS = 12,
     SG_MAX_SHADERSTAGE_STORAGEBUFFERS = 8,
+    SG_MAX_SHADERSTAGE_STORAGEIMAGES = 4,
     SG_MAX_SHADERSTAGE_UBS = 4,
     SG_MAX_UB_MEMBERS = 16,
     SG_MAX_VERTEX_ATTRIBUTES = 16,
@@ -1833,6 +2705,11 @@ typedef struct sg_features {
     bool mrt_independent_blend_state;   // multiple-render-target rendering can use per-render-target blend state
     bool mrt_independent_write_mask;    // multiple-render-target rendering can use per-render-target color write masks
     bool storage_buffer;                // storage buffers are supported
+    bool image_readback;                // sg_read_image_async() is supported
+    bool compute;                       // compute shaders, compute passes and sg_dispatch() are supported
+    bool copy_buffer;                   // sg_copy_buffer() is supported
+    bool copy_image;                    // sg_copy_image_region() is supported
+    bool mip_streaming;                 // sg_image_desc.num_resident_mipmaps and sg_update_image_mip() are supported
 } sg_features;
 
 /*
@@ -2056,17 +2933,20 @@ typedef enum sg_cube_face {
 /*
     sg_shader_stage
 
-    There are 2 shader stages: vertex- and fragment-shader-stage.
+    There are 2 shader stages for render pipelines: vertex- and fragment-shader-stage,
+    and one shader stage for compute pipelines (compute-shader-stage).
     Each shader stage
 
     - SG_MAX_SHADERSTAGE_UBS slots for applying uniform data
     - SG_MAX_SHADERSTAGE_IMAGES slots for images used as textures
     - SG_MAX_SHADERSTAGE_SAMPLERS slots for texture samplers
     - SG_MAX_SHADERSTAGE_STORAGEBUFFERS slots for storage buffer bindings
+    - SG_MAX_SHADERSTAGE_STORAGEIMAGES slots for storage image bindings (only compute stage)
 */
 typedef enum sg_shader_stage {
     SG_SHADERSTAGE_VS,
     SG_SHADERSTAGE_FS,
+    SG_SHADERSTAGE_CS,
     _SG_SHADERSTAGE_FORCE_U32 = 0x7FFFFFFF
 } sg_shader_stage;
 
@@ -2673,9 +3553,16 @@ typedef struct sg_swapchain {
 
     You can also omit the .action object to get default pass action behaviour
     (clear to color=grey, depth=1 and stencil=0).
+
+    A compute pass is started with .compute = true, in that case, no pass action,
+    attachments or swapchain must be provided (see COMPUTE PASSES in the
+    documentation header):
+
+        sg_begin_pass(&(sg_pass){ .compute = true });
 */
 typedef struct sg_pass {
     uint32_t _start_canary;
+    bool compute;
     sg_pass_action action;
     sg_attachments attachments;
     sg_swapchain swapchain;
@@ -2702,6 +3589,9 @@ typedef struct sg_pass {
     - 0..N fragment shader stage images
     - 0..N fragment shader stage samplers
     - 0..N fragment shader storage buffers
+    - 0..N compute shader stage images, samplers, storage buffers and
+      storage images (only with compute pipelines, in that case, vertex-
+      and index-buffers and the vertex- and fragment-stage bindings must be empty)
 
     For the max number of bindings, see the constant definitions:
 
@@ -2709,6 +3599,7 @@ typedef struct sg_pass {
     - SG_MAX_SHADERSTAGE_IMAGES
     - SG_MAX_SHADERSTAGE_SAMPLERS
     - SG_MAX_SHADERSTAGE_STORAGEBUFFERS
+    - SG_MAX_SHADERSTAGE_STORAGEIMAGES
 
     The optional buffer offsets can be used to put different unrelated
     chunks of vertex- and/or index-data into the same buffer objects.
@@ -2717,6 +3608,7 @@ typedef struct sg_stage_bindings {
     sg_image images[SG_MAX_SHADERSTAGE_IMAGES];
     sg_sampler samplers[SG_MAX_SHADERSTAGE_SAMPLERS];
     sg_buffer storage_buffers[SG_MAX_SHADERSTAGE_STORAGEBUFFERS];
+    sg_image storage_images[SG_MAX_SHADERSTAGE_STORAGEIMAGES];
 } sg_stage_bindings;
 
 typedef struct sg_bindings {
@@ -2727,6 +3619,7 @@ typedef struct sg_bindings {
     int index_buffer_offset;
     sg_stage_bindings vs;
     sg_stage_bindings fs;
+    sg_stage_bindings cs;
     uint32_t _end_canary;
 } sg_bindings;
 
@@ -2743,6 +3636,9 @@ typedef struct sg_bindings {
     .usage:     SG_USAGE_IMMUTABLE
     .data.ptr   0       (*must* be valid for immutable buffers)
     .data.size  0       (*must* be > 0 for immutable buffers)
+    .max_views  0       (optional, > 0 enables sg_alloc_buffer_view())
+    .view_alignment 4   (only used with max_views > 0, must be a power of 2)
+    .max_size   0       (optional, > .size allows dynamic/stream buffers to grow on append-overflow)
     .label      0       (optional string label)
 
     For immutable buffers which are initialized with initial data,
@@ -2756,19 +3652,31 @@ typedef struct sg_bindings {
     be identical (this may change in the future when the dynamic resource
     management may become more flexible).
 
+    To suballocate ranges from the buffer via sg_alloc_buffer_view(),
+    set .max_views to the maximum number of buffer views that can
+    be allocated at the same time (see the BUFFER VIEWS section for details).
+
+    Dynamic and stream buffers which are written with sg_append_buffer()
+    can optionally grow when they overflow by setting .max_size to a value
+    bigger than .size. The buffer will then be reallocated at twice the
+    size in the next frame, until .max_size is reached (which must not be
+    bigger than INT_MAX). The reallocated buffer keeps the .label (truncated
+    to 31 characters). Growable buffers cannot be combined with buffer views
+    or injected native buffers.
+
     ADVANCED TOPIC: Injecting native 3D-API buffers:
 
     The following struct members allow to inject your own GL, Metal
     or D3D11 buffers into sokol_gfx:
 
-    .gl_buffers[SG_NUM_INFLIGHT_FRAMES]
-    .mtl_buffers[SG_NUM_INFLIGHT_FRAMES]
+    .gl_buffers[SG_MAX_INFLIGHT_FRAMES]
+    .mtl_buffers[SG_MAX_INFLIGHT_FRAMES]
     .d3d11_buffer
 
     You must still provide all other struct items except the .data item, and
     these must match the creation parameters of the native buffers you
     provide. For SG_USAGE_IMMUTABLE, only provide a single native 3D-API
-    buffer, otherwise you need to provide SG_NUM_INFLIGHT_FRAMES buffers
+    buffer, otherwise you need to provide sg_desc.num_inflight_frames buffers
     (only for GL and Metal, not D3D11). Providing multiple buffers for GL and
     Metal is necessary because sokol_gfx will rotate through them when
     calling sg_update_buffer() to prevent lock-stalls.
@@ -2785,15 +3693,34 @@ typedef struct sg_buffer_desc {
     sg_buffer_type type;
     sg_usage usage;
     sg_range data;
+    int max_views;
+    int view_alignment;
+    size_t max_size;
     const char* label;
     // optionally inject backend-specific resources
-    uint32_t gl_buffers[SG_NUM_INFLIGHT_FRAMES];
-    const void* mtl_buffers[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t gl_buffers[SG_MAX_INFLIGHT_FRAMES];
+    const void* mtl_buffers[SG_MAX_INFLIGHT_FRAMES];
     const void* d3d11_buffer;
     const void* wgpu_buffer;
     uint32_t _end_canary;
 } sg_buffer_desc;
 
+/*
+    sg_buffer_view
+
+    A range of bytes suballocated from a buffer via sg_alloc_buffer_view().
+    The .buffer and .offset items can be plugged directly into
+    sg_bindings.vertex_buffers[]/.vertex_buffer_offsets[] or
+    sg_bindings.index_buffer/.index_buffer_offset.
+
+    A failed allocation returns a zero-initialized struct.
+*/
+typedef struct sg_buffer_view {
+    sg_buffer buffer;
+    int offset;
+    int size;
+} sg_buffer_view;
+
 /*
     sg_image_data
 
@@ -2814,13 +3741,17 @@ typedef struct sg_image_data {
 
     .type:              SG_IMAGETYPE_2D
     .render_target:     false
+    .storage_image:     false (true if the image is written by compute shaders)
     .width              0 (must be set to >0)
     .height             0 (must be set to >0)
     .num_slices         1 (3D textures: depth; array textures: number of layers)
     .num_mipmaps:       1
+    .num_resident_mipmaps: .num_mipmaps (fewer to stream in the larger mipmaps later with sg_update_image_mip())
     .usage:             SG_USAGE_IMMUTABLE
     .pixel_format:      SG_PIXELFORMAT_RGBA8 for textures, or sg_desc.environment.defaults.color_format for render targets
     .sample_count:      1 for textures, or sg_desc.environment.defaults.sample_count for render targets
+    .evictable          false (true if the image may be evicted to meet sg_desc.residency.budget)
+    .evict_priority     0 (images with lower priority are evicted first)
     .data               an sg_image_data struct to define the initial content
     .label              0 (optional string label for trace hooks)
 
@@ -2836,15 +3767,24 @@ typedef struct sg_image_data {
     NOTE:
 
     Images with usage SG_USAGE_IMMUTABLE must be fully initialized by
-    providing a valid .data member which points to initialization data.
+    providing a valid .data member which points to initialization data
+    (except for render targets and storage images). When .num_resident_mipmaps
+    is less than .num_mipmaps, only the smallest .num_resident_mipmaps must
+    have data (see PROGRESSIVE MIPMAP STREAMING).
+
+    Storage images must have usage SG_USAGE_IMMUTABLE, must not have
+    initial data, and must use a pixel format which can be written
+    by compute shaders (RGBA8, RGBA8SN, RGBA8UI, RGBA8SI, RGBA16UI, RGBA16SI,
+    RGBA16F, R32UI, R32SI, R32F, RG32UI, RG32SI, RG32F, RGBA32UI, RGBA32SI
+    or RGBA32F).
 
     ADVANCED TOPIC: Injecting native 3D-API textures:
 
     The following struct members allow to inject your own GL, Metal or D3D11
     textures into sokol_gfx:
 
-    .gl_textures[SG_NUM_INFLIGHT_FRAMES]
-    .mtl_textures[SG_NUM_INFLIGHT_FRAMES]
+    .gl_textures[SG_MAX_INFLIGHT_FRAMES]
+    .mtl_textures[SG_MAX_INFLIGHT_FRAMES]
     .d3d11_texture
     .d3d11_shader_resource_view
     .wgpu_texture
@@ -2865,19 +3805,23 @@ typedef struct sg_image_desc {
     uint32_t _start_canary;
     sg_image_type type;
     bool render_target;
+    bool storage_image;
     int width;
     int height;
     int num_slices;
     int num_mipmaps;
+    int num_resident_mipmaps;
     sg_usage usage;
     sg_pixel_format pixel_format;
     int sample_count;
+    bool evictable;
+    int evict_priority;
     sg_image_data data;
     const char* label;
     // optionally inject backend-specific resources
-    uint32_t gl_textures[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t gl_textures[SG_MAX_INFLIGHT_FRAMES];
     uint32_t gl_texture_target;
-    const void* mtl_textures[SG_NUM_INFLIGHT_FRAMES];
+    const void* mtl_textures[SG_MAX_INFLIGHT_FRAMES];
     const void* d3d11_texture;
     const void* d3d11_shader_resource_view;
     const void* wgpu_texture;
@@ -2934,7 +3878,7 @@ typedef struct sg_sampler_desc {
     - reflection information for vertex attributes (vertex shader inputs):
         - vertex attribute name (only optionally used by GLES3 and GL)
         - a semantic name and index (required for D3D11)
-    - for each shader-stage (vertex and fragment):
+    - for each shader-stage (vertex and fragment, or compute):
         - the shader source or bytecode
         - an optional entry function name
         - an optional compile target (only for D3D11 when source is provided,
@@ -2957,8 +3901,15 @@ typedef struct sg_sampler_desc {
             - the sampler slot of the involved sampler
             - for GLSL only: the name of the combined image-sampler object
         - reflection info for each storage-buffer used by the shader:
-            - whether the storage buffer is readonly (currently this
-              must be true)
+            - whether the storage buffer is readonly (this must be true
+              for vertex- and fragment-shaders)
+        - reflection info for each storage-image used by a compute shader:
+            - the image type (SG_IMAGETYPE_xxx)
+            - the pixel format used to access the image in the shader
+            - whether the storage image is readonly
+
+    A compute shader is created by providing the source or bytecode
+    in .cs instead of .vs and .fs (it's an error to provide both).
 
     For all GL backends, shader source-code must be provided. For D3D11 and Metal,
     either shader source-code or byte-code can be provided.
@@ -2992,6 +3943,13 @@ typedef struct sg_shader_storage_buffer_desc {
     bool readonly;
 } sg_shader_storage_buffer_desc;
 
+typedef struct sg_shader_storage_image_desc {
+    bool used;
+    sg_image_type image_type;
+    sg_pixel_format access_format;  // the image format in the shader code, e.g. rgba8 or r32f
+    bool readonly;
+} sg_shader_storage_image_desc;
+
 typedef struct sg_shader_image_desc {
     bool used;
     bool multisampled;
@@ -3021,6 +3979,7 @@ typedef struct sg_shader_stage_desc {
     sg_shader_image_desc images[SG_MAX_SHADERSTAGE_IMAGES];
     sg_shader_sampler_desc samplers[SG_MAX_SHADERSTAGE_SAMPLERS];
     sg_shader_image_sampler_pair_desc image_sampler_pairs[SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS];
+    sg_shader_storage_image_desc storage_images[SG_MAX_SHADERSTAGE_STORAGEIMAGES];
 } sg_shader_stage_desc;
 
 typedef struct sg_shader_desc {
@@ -3028,6 +3987,7 @@ typedef struct sg_shader_desc {
     sg_shader_attr_desc attrs[SG_MAX_VERTEX_ATTRIBUTES];
     sg_shader_stage_desc vs;
     sg_shader_stage_desc fs;
+    sg_shader_stage_desc cs;
     const char* label;
     uint32_t _end_canary;
 } sg_shader_desc;
@@ -3053,6 +4013,8 @@ typedef struct sg_shader_desc {
 
     The default configuration is as follows:
 
+    .compute:           false (set to true for compute pipelines, which need a
+                        compute shader, all other render state is ignored)
     .shader:            0 (must be initialized with a valid sg_shader id!)
     .layout:
         .buffers[]:         vertex buffer layouts
@@ -3161,6 +4123,7 @@ typedef struct sg_color_target_state {
 
 typedef struct sg_pipeline_desc {
     uint32_t _start_canary;
+    bool compute;
     sg_shader shader;
     sg_vertex_layout_state layout;
     sg_depth_state depth;
@@ -3178,6 +4141,59 @@ typedef struct sg_pipeline_desc {
     uint32_t _end_canary;
 } sg_pipeline_desc;
 
+/*
+    sg_pipeline_variant_desc
+
+    The override params for sg_make_pipeline_variant(), which creates a new
+    pipeline object from the resolved state of an existing 'base pipeline'.
+    The variant always uses the same shader and vertex layout as the base
+    pipeline, only the items specified in the sg_pipeline_variant_desc struct
+    are changed:
+
+    .depth, .stencil, .colors[] and .color_count
+        these are only used if the matching override flag is set
+        (.override_depth, .override_stencil, .override_colors), and then
+        replace the entire state group, unspecified items in the group get
+        the same default values as in sg_pipeline_desc (for instance, to
+        create a depth-only variant, set .override_colors = true and
+        .colors[0].pixel_format = SG_PIXELFORMAT_NONE)
+    .primitive_type, .index_type, .cull_mode, .face_winding
+        the default value (zero) keeps the base pipeline's value
+    .sample_count
+        0 keeps the base pipeline's sample count
+    .blend_color
+        only used if .override_blend_color is true
+    .alpha_to_coverage_enabled
+        only used if .override_alpha_to_coverage is true
+    .label
+        optional string label for trace hooks
+
+    Because the shader and vertex layout have already been validated when the
+    base pipeline was created, creating a variant skips most of the validation
+    and default-value resolution of sg_make_pipeline().
+*/
+typedef struct sg_pipeline_variant_desc {
+    uint32_t _start_canary;
+    bool override_depth;
+    sg_depth_state depth;
+    bool override_stencil;
+    sg_stencil_state stencil;
+    bool override_colors;
+    int color_count;
+    sg_color_target_state colors[SG_MAX_COLOR_ATTACHMENTS];
+    sg_primitive_type primitive_type;
+    sg_index_type index_type;
+    sg_cull_mode cull_mode;
+    sg_face_winding face_winding;
+    int sample_count;
+    bool override_blend_color;
+    sg_color blend_color;
+    bool override_alpha_to_coverage;
+    bool alpha_to_coverage_enabled;
+    const char* label;
+    uint32_t _end_canary;
+} sg_pipeline_variant_desc;
+
 /*
     sg_attachments_desc
 
@@ -3224,6 +4240,75 @@ typedef struct sg_attachments_desc {
     uint32_t _end_canary;
 } sg_attachments_desc;
 
+/*
+    sg_read_image_desc
+
+    Describes an asynchronous image readback started with sg_read_image_async(),
+    see the section IMAGE READBACK for details.
+
+    .x, .y, .width, .height:
+        the rectangle to read back, width and height default to the
+        image size
+    .callback:
+        called with an sg_image_readback struct when the readback has finished
+    .user_data:
+        an optional user pointer passed into the callback
+*/
+typedef struct sg_image_readback {
+    sg_image image;
+    int x;
+    int y;
+    int width;
+    int height;
+    sg_pixel_format pixel_format;
+    sg_range data;      // tightly packed pixel data, only valid inside the callback
+    void* user_data;
+} sg_image_readback;
+
+typedef struct sg_read_image_desc {
+    uint32_t _start_canary;
+    int x;
+    int y;
+    int width;
+    int height;
+    void (*callback)(const sg_image_readback* readback);
+    void* user_data;
+    uint32_t _end_canary;
+} sg_read_image_desc;
+
+/*
+    sg_image_copy_desc
+
+    Describes a GPU-side copy between two images with sg_copy_image_region(),
+    see the section GPU COPIES for details.
+
+    .dst, .src:
+        the destination and source image, mip level, first slice (cube face,
+        array layer or 3D depth slice) and top-left corner of the copied region
+    .width, .height:
+        the size of the copied region, defaults to the source mip level size
+        minus .src.x and .src.y
+    .num_slices:
+        the number of copied slices, defaults to 1
+*/
+typedef struct sg_image_copy_location {
+    sg_image image;
+    int mip_level;
+    int slice;
+    int x;
+    int y;
+} sg_image_copy_location;
+
+typedef struct sg_image_copy_desc {
+    uint32_t _start_canary;
+    sg_image_copy_location dst;
+    sg_image_copy_location src;
+    int width;
+    int height;
+    int num_slices;
+    uint32_t _end_canary;
+} sg_image_copy_desc;
+
 /*
     sg_trace_hooks
 
@@ -3252,8 +4337,12 @@ typedef struct sg_trace_hooks {
     void (*destroy_pipeline)(sg_pipeline pip, void* user_data);
     void (*destroy_attachments)(sg_attachments atts, void* user_data);
     void (*update_buffer)(sg_buffer buf, const sg_range* data, void* user_data);
+    void (*update_buffer_range)(sg_buffer buf, size_t offset, const sg_range* data, void* user_data);
     void (*update_image)(sg_image img, const sg_image_data* data, void* user_data);
+    void (*update_image_mip)(sg_image img, int mip_level, const sg_image_data* data, void* user_data);
     void (*append_buffer)(sg_buffer buf, const sg_range* data, int result, void* user_data);
+    void (*copy_buffer)(sg_buffer dst, size_t dst_offset, sg_buffer src, size_t src_offset, size_t size, void* user_data);
+    void (*copy_image_region)(const sg_image_copy_desc* desc, void* user_data);
     void (*begin_pass)(const sg_pass* pass, void* user_data);
     void (*apply_viewport)(int x, int y, int width, int height, bool origin_top_left, void* user_data);
     void (*apply_scissor_rect)(int x, int y, int width, int height, bool origin_top_left, void* user_data);
@@ -3261,6 +4350,7 @@ typedef struct sg_trace_hooks {
     void (*apply_bindings)(const sg_bindings* bindings, void* user_data);
     void (*apply_uniforms)(sg_shader_stage stage, int ub_index, const sg_range* data, void* user_data);
     void (*draw)(int base_element, int num_elements, int num_instances, void* user_data);
+    void (*dispatch)(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data);
     void (*end_pass)(void* user_data);
     void (*commit)(void* user_data);
     void (*alloc_buffer)(sg_buffer result, void* user_data);
@@ -3325,6 +4415,15 @@ typedef struct sg_slot_info {
     uint32_t res_id;            // type-neutral resource if (e.g. sg_buffer.id)
 } sg_slot_info;
 
+// usage counters, only updated with SOKOL_TRACK_RESOURCE_USAGE (see RESOURCE USAGE TRACKING)
+typedef struct sg_resource_usage {
+    uint32_t last_used_frame_index; // frame index of the last use (0 if never used)
+    uint32_t num_binds;             // number of uses in the current frame
+    uint32_t num_binds_prev_frame;  // number of uses in the previous frame
+    uint32_t num_binds_total;       // number of uses since creation
+    uint64_t num_updated_bytes;     // bytes written with sg_update_*() or sg_append_buffer() since creation
+} sg_resource_usage;
+
 typedef struct sg_buffer_info {
     sg_slot_info slot;              // resource pool slot info
     uint32_t update_frame_index;    // frame index of last sg_update_buffer()
@@ -3333,6 +4432,13 @@ typedef struct sg_buffer_info {
     bool append_overflow;           // is buffer in overflow state (due to sg_append_buffer)
     int num_slots;                  // number of renaming-slots for dynamically updated buffers
     int active_slot;                // currently active write-slot for dynamically updated buffers
+    struct {
+        int num_views;              // number of currently allocated buffer views
+        int num_free_ranges;        // number of ranges in the free-list
+        int free_size;              // overall number of free bytes
+        int largest_free_size;      // size of the biggest free range (if much smaller than free_size, the buffer is fragmented)
+    } views;
+    sg_resource_usage usage;        // usage counters (SOKOL_TRACK_RESOURCE_USAGE only)
 } sg_buffer_info;
 
 typedef struct sg_image_info {
@@ -3340,6 +4446,10 @@ typedef struct sg_image_info {
     uint32_t upd_frame_index;       // frame index of last sg_update_image()
     int num_slots;                  // number of renaming-slots for dynamically updated images
     int active_slot;                // currently active write-slot for dynamically updated images
+    uint32_t use_frame_index;       // frame index of last sg_apply_bindings() with this image (evictable images only)
+    bool evicted;                   // true if the image has been evicted (see IMAGE RESIDENCY)
+    int base_mip_level;             // most detailed mipmap which can be sampled (see PROGRESSIVE MIPMAP STREAMING)
+    sg_resource_usage usage;        // usage counters (SOKOL_TRACK_RESOURCE_USAGE only)
 } sg_image_info;
 
 typedef struct sg_sampler_info {
@@ -3377,6 +4487,19 @@ typedef struct sg_frame_stats_gl {
     uint32_t num_enable_vertex_attrib_array;
     uint32_t num_disable_vertex_attrib_array;
     uint32_t num_uniform;
+    uint32_t num_readback_fence_waits;
+    uint32_t num_bind_vertex_array;
+    uint32_t num_vao_cache_hits;
+    uint32_t num_vao_cache_misses;
+    uint32_t num_vao_cache_evictions;
+    uint32_t num_multi_bind_textures;
+    uint32_t num_multi_bind_samplers;
+    uint32_t num_multi_bind_buffers;
+    uint32_t num_staging_uploads;
+    uint32_t num_staging_stalls;
+    uint32_t size_staging;
+    uint32_t num_bind_image_texture;
+    uint32_t num_memory_barrier;
 } sg_frame_stats_gl;
 
 typedef struct sg_frame_stats_d3d11_pass {
@@ -3500,14 +4623,33 @@ typedef struct sg_frame_stats {
     uint32_t num_apply_bindings;
     uint32_t num_apply_uniforms;
     uint32_t num_draw;
+    uint32_t num_dispatch;
     uint32_t num_update_buffer;
+    uint32_t num_update_buffer_range;
     uint32_t num_append_buffer;
     uint32_t num_update_image;
+    uint32_t num_update_image_mip;
+    uint32_t num_grow_buffer;
+    uint32_t num_read_image_async;
+    uint32_t num_copy_buffer;
+    uint32_t num_copy_image;
+    uint32_t num_prewarm;       // shaders and pipelines created by sg_prewarm()
+    uint32_t num_prewarm_hits;  // sg_make_shader/pipeline() calls which returned a prewarmed object
+    uint32_t num_skipped_apply_uniforms;    // sg_apply_uniforms() calls skipped because the data didn't change
+    uint32_t num_coalesced_draws;   // sg_draw() calls merged into the previous draw (sg_desc.coalesce_draws)
 
     uint32_t size_apply_uniforms;
+    uint32_t size_skipped_apply_uniforms;
     uint32_t size_update_buffer;
+    uint32_t size_update_buffer_range;
+    uint32_t size_sync_buffer_range;
     uint32_t size_append_buffer;
     uint32_t size_update_image;
+    uint32_t size_update_image_mip;
+    uint32_t size_grow_buffer;
+    uint32_t size_read_image_async;
+    uint32_t size_copy_buffer;
+    uint32_t size_copy_image;
 
     sg_frame_stats_gl gl;
     sg_frame_stats_d3d11 d3d11;
@@ -3515,6 +4657,73 @@ typedef struct sg_frame_stats {
     sg_frame_stats_wgpu wgpu;
 } sg_frame_stats;
 
+/*
+    sg_transient_stats
+
+    Returned by sg_query_transient_stats(), provides information about
+    the transient render target pool (see the section TRANSIENT RENDER
+    TARGETS). Memory sizes are estimates computed from the image
+    attributes.
+*/
+typedef struct sg_transient_stats {
+    int num_images;             // number of images currently in the pool
+    int num_images_in_use;      // number of currently acquired images
+    int num_attachments;        // number of cached attachments objects
+    size_t total_bytes;         // memory used by all images in the pool
+    size_t peak_bytes;          // highest total_bytes value since sg_setup()
+    uint32_t num_acquired;      // number of sg_acquire_transient_image() calls
+    uint32_t num_reused;        // number of acquired images taken from the pool
+    uint32_t num_evicted;       // number of images destroyed after being unused
+} sg_transient_stats;
+
+/*
+    sg_residency_stats
+
+    Returned by sg_query_residency_stats(), provides information about
+    the memory used by evictable images (see the section IMAGE RESIDENCY).
+    Memory sizes are estimates computed from the image attributes.
+*/
+typedef struct sg_residency_stats {
+    size_t budget;                  // the sg_desc.residency.budget value
+    size_t resident_bytes;          // memory used by all resident evictable images
+    size_t peak_bytes;              // highest resident_bytes value since sg_setup()
+    int num_resident_images;        // number of resident evictable images
+    uint32_t num_evicted;           // number of evicted images since sg_setup()
+    uint32_t num_placeholder_binds; // number of times an evicted image was replaced by a placeholder
+} sg_residency_stats;
+
+/*
+    sg_dedup_stats
+
+    Returned by sg_query_dedup_stats(), provides information about
+    shared immutable resources (see the section RESOURCE DEDUPLICATION).
+*/
+typedef struct sg_dedup_stats {
+    int num_buffers;            // number of live deduplicated buffers
+    int num_images;             // number of live deduplicated images
+    uint32_t num_buffer_hits;   // number of sg_make_buffer() calls which returned an existing buffer
+    uint32_t num_image_hits;    // number of sg_make_image() calls which returned an existing image
+    uint32_t num_collisions;    // number of hash matches with different content
+    size_t saved_bytes;         // memory currently saved by sharing resources (estimate)
+    size_t hashed_bytes;        // number of content bytes hashed since sg_setup()
+} sg_dedup_stats;
+
+/*
+    sg_frame_pacing
+
+    Returned by sg_query_frame_pacing(), describes how far the CPU is
+    running ahead of the GPU and how long the CPU had to wait for the
+    GPU in sg_commit() (see the section FRAME PACING).
+*/
+typedef struct sg_frame_pacing {
+    uint32_t frame_index;       // frame index of the last sg_commit()
+    int max_frames_in_flight;   // the clamped sg_desc.max_frames_ahead (0 if frame pacing is disabled)
+    int frames_in_flight;       // frames not yet finished by the GPU at the end of the last sg_commit()
+    double wait_ms;             // CPU time spent waiting for the GPU in the last frame
+    double total_wait_ms;       // accumulated wait time since sg_setup()
+    uint32_t num_waits;         // number of frames which had to wait for the GPU
+} sg_frame_pacing;
+
 /*
     sg_log_item
 
@@ -3625,6 +4834,30 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(PASS_POOL_EXHAUSTED, "pass pool exhausted") \
     _SG_LOGITEM_XMACRO(BEGINPASS_ATTACHMENT_INVALID, "sg_begin_pass: an attachment was provided that no longer exists") \
     _SG_LOGITEM_XMACRO(DRAW_WITHOUT_BINDINGS, "attempting to draw without resource bindings") \
+    _SG_LOGITEM_XMACRO(BUFFER_VIEWS_NOT_ENABLED, "sg_alloc_buffer_view(): buffer wasn't created with sg_buffer_desc.max_views > 0") \
+    _SG_LOGITEM_XMACRO(BUFFER_VIEWS_EXHAUSTED, "sg_alloc_buffer_view(): too many active buffer views (increase sg_buffer_desc.max_views)") \
+    _SG_LOGITEM_XMACRO(BUFFER_VIEW_OUT_OF_MEMORY, "sg_alloc_buffer_view(): no free buffer range big enough (buffer too small or fragmented)") \
+    _SG_LOGITEM_XMACRO(BUFFER_VIEW_INVALID_FREE, "sg_free_buffer_view(): buffer view isn't allocated (double free?)") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_IMAGE_NOT_RENDER_TARGET, "sg_acquire_transient_image(): sg_image_desc.render_target must be true") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_POOL_EXHAUSTED, "sg_acquire_transient_image(): transient image pool exhausted (use sg_desc.transient_pool_size to adjust)") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_IMAGE_INVALID_RELEASE, "sg_release_transient_image(): image isn't an acquired transient image") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_ATTACHMENTS_CACHE_FULL, "sg_make_transient_attachments(): attachments cache is full (use sg_desc.transient_attachments_cache_size to adjust)") \
+    _SG_LOGITEM_XMACRO(READBACK_POOL_EXHAUSTED, "sg_read_image_async(): too many pending readbacks (use sg_desc.readback_pool_size to adjust)") \
+    _SG_LOGITEM_XMACRO(READBACK_NOT_SUPPORTED, "sg_read_image_async(): image readback not supported by this backend (check sg_features.image_readback)") \
+    _SG_LOGITEM_XMACRO(COPY_BUFFER_NOT_SUPPORTED, "sg_copy_buffer(): buffer copies not supported by this backend (check sg_features.copy_buffer)") \
+    _SG_LOGITEM_XMACRO(COPY_IMAGE_NOT_SUPPORTED, "sg_copy_image_region(): image copies not supported by this backend (check sg_features.copy_image)") \
+    _SG_LOGITEM_XMACRO(MIP_STREAMING_NOT_SUPPORTED, "sg_make_image(): progressive mipmap streaming not supported by this backend (check sg_features.mip_streaming)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_FRAMEBUFFER_INCOMPLETE, "sg_read_image_async(): framebuffer for image readback is incomplete (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_FENCE_WAIT_FAILED, "waiting for image readback fence failed (gl)") \
+    _SG_LOGITEM_XMACRO(GL_FRAME_FENCE_WAIT_FAILED, "waiting for frame fence failed (gl)") \
+    _SG_LOGITEM_XMACRO(MANIFEST_NOT_RECORDING, "sg_export_manifest(): manifest recording isn't enabled (set sg_desc.record_manifest)") \
+    _SG_LOGITEM_XMACRO(MANIFEST_EXPORT_BUFFER_TOO_SMALL, "sg_export_manifest(): destination buffer too small (use sg_query_manifest_size())") \
+    _SG_LOGITEM_XMACRO(MANIFEST_INVALID, "sg_prewarm(): invalid or corrupt manifest data") \
+    _SG_LOGITEM_XMACRO(MANIFEST_BACKEND_MISMATCH, "sg_prewarm(): manifest was recorded with a different backend") \
+    _SG_LOGITEM_XMACRO(CONTEXT_POOL_EXHAUSTED, "sg_make_context(): too many contexts (max 16 including the default context)") \
+    _SG_LOGITEM_XMACRO(CONTEXT_INVALID, "invalid or destroyed context handle") \
+    _SG_LOGITEM_XMACRO(CONTEXT_DESTROY_DEFAULT, "sg_destroy_context(): cannot destroy default context (call sg_shutdown() instead)") \
+    _SG_LOGITEM_XMACRO(BUFFER_GROWN, "sg_append_buffer(): buffer has grown after overflow (consider a bigger initial sg_buffer_desc.size)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_CANARY, "sg_buffer_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_SIZE, "sg_buffer_desc.size and .data.size cannot both be 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_DATA, "immutable buffers must be initialized with data (sg_buffer_desc.data.ptr and sg_buffer_desc.data.size)") \
@@ -3632,6 +4865,13 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_NO_DATA, "dynamic/stream usage buffers cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED, "storage buffers not supported by the backend 3D API (requires OpenGL >= 4.3)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4, "size of storage buffers must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_VIEWS, "sg_buffer_desc.max_views must be >= 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_VIEW_ALIGNMENT, "sg_buffer_desc.view_alignment must be a power of 2") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_SIZE, "sg_buffer_desc.max_size must be >= sg_buffer_desc.size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_SIZE_LIMIT, "sg_buffer_desc.max_size must be <= INT_MAX") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_SIZE_USAGE, "sg_buffer_desc.max_size can only be used with dynamic or stream usage") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_SIZE_INJECTED, "sg_buffer_desc.max_size cannot be used with injected native buffers") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_MAX_SIZE_VIEWS, "sg_buffer_desc.max_size and .max_views cannot be combined") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_NODATA, "sg_image_data: no data (.ptr and/or .size is zero)") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_DATA_SIZE, "sg_image_data: data size doesn't match expected surface size") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_CANARY, "sg_image_desc not initialized") \
@@ -3649,6 +4889,16 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_INJECTED_NO_DATA, "images with injected textures cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_DYNAMIC_NO_DATA, "dynamic/stream images cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE, "compressed images must be immutable") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGE_NOT_SUPPORTED, "storage images not supported by this backend (check sg_features.compute)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGE_PIXELFORMAT, "invalid pixel format for storage image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGE_IMMUTABLE, "storage images must be SG_USAGE_IMMUTABLE") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGE_NO_DATA, "storage images cannot be initialized with data") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGE_MSAA, "storage images cannot be multisampled") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_EVICTABLE_RT, "evictable images cannot be render targets or storage images") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_EVICTABLE_PIXELFORMAT, "evictable images must have a filterable color pixel format") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_RESIDENT_MIPMAPS, "sg_image_desc.num_resident_mipmaps must be between 1 and num_mipmaps") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STREAMING_USAGE, "images with non-resident mipmaps must be SG_USAGE_IMMUTABLE and cannot be render targets, storage images or injected") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STREAMING_NO_DATA, "non-resident mipmaps cannot be initialized with data (use sg_update_image_mip())") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_CANARY, "sg_sampler_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_MINFILTER_NONE, "sg_sampler_desc.min_filter cannot be SG_FILTER_NONE") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_MAGFILTER_NONE, "sg_sampler_desc.mag_filter cannot be SG_FILTER_NONE") \
@@ -3666,7 +4916,12 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UB_ARRAY_COUNT, "uniform array count must be >= 1") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UB_STD140_ARRAY_TYPE, "uniform arrays only allowed for FLOAT4, INT4, MAT4 in std140 layout") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_NO_CONT_STORAGEBUFFERS, "shader stage storage buffers must occupy continuous slots (sg_shader_desc.vs|fs.storage_buffers[])") \
-    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_STORAGEBUFFER_READONLY, "shader stage storage buffers must be readonly (sg_shader_desc.vs|fs.storage_buffers[].readonly)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_STORAGEBUFFER_READONLY, "vertex- and fragment-stage storage buffers must be readonly (sg_shader_desc.vs|fs.storage_buffers[].readonly)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_COMPUTE_NOT_SUPPORTED, "compute shaders not supported by this backend (check sg_features.compute)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_COMPUTE_VS_FS, "compute shaders cannot have vertex- or fragment-shader code (sg_shader_desc.cs vs sg_shader_desc.vs|fs)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_STORAGEIMAGE_COMPUTE_ONLY, "storage images are only allowed in compute shaders (sg_shader_desc.vs|fs.storage_images[])") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_NO_CONT_STORAGEIMAGES, "shader stage storage images must occupy continuous slots (sg_shader_desc.cs.storage_images[])") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_STORAGEIMAGE_FORMAT, "invalid storage image access format (sg_shader_desc.cs.storage_images[].access_format)") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_NO_CONT_IMAGES, "shader stage images must occupy continuous slots (sg_shader_desc.vs|fs.images[])") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_NO_CONT_SAMPLERS, "shader stage samplers must occupy continuous slots (sg_shader_desc.vs|fs.samplers[])") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_IMAGE_SAMPLER_PAIR_IMAGE_SLOT_OUT_OF_RANGE, "shader stage: image-sampler-pair image slot index is out of range (sg_shader_desc.vs|fs.image_sampler_pairs[].image_slot)") \
@@ -3686,6 +4941,11 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEDESC_NO_CONT_ATTRS, "sg_pipeline_desc.layout.attrs is not continuous") \
     _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEDESC_LAYOUT_STRIDE4, "sg_pipeline_desc.layout.buffers[].stride must be multiple of 4") \
     _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEDESC_ATTR_SEMANTICS, "D3D11 missing vertex attribute semantics in shader") \
+    _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEDESC_COMPUTE_SHADER, "sg_pipeline_desc.compute must match the shader type (compute pipelines require a compute shader and vice versa)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEDESC_COMPUTE_NO_LAYOUT, "compute pipelines cannot have a vertex layout (sg_pipeline_desc.layout)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEVARIANTDESC_CANARY, "sg_pipeline_variant_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEVARIANTDESC_BASE, "sg_make_pipeline_variant: base pipeline must be valid") \
+    _SG_LOGITEM_XMACRO(VALIDATE_PIPELINEVARIANTDESC_SHADER, "sg_make_pipeline_variant: shader of base pipeline no longer valid") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_CANARY, "sg_attachments_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_NO_ATTACHMENTS, "sg_attachments_desc no color or depth-stencil attachments") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_NO_CONT_COLOR_ATTS, "color attachments must occupy continuous slots") \
@@ -3718,6 +4978,9 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_DEPTH_IMAGE_SIZES, "pass depth attachment image size must match color attachment image size") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_DEPTH_IMAGE_SAMPLE_COUNT, "pass depth attachment sample count must match color attachment sample count") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_CANARY, "sg_begin_pass: pass struct not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_COMPUTE_NOT_SUPPORTED, "sg_begin_pass: compute passes not supported by this backend (check sg_features.compute)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_COMPUTE_EXPECT_NO_ATTACHMENTS, "sg_begin_pass: compute passes cannot have attachments (sg_pass.attachments)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_COMPUTE_EXPECT_NO_SWAPCHAIN, "sg_begin_pass: compute passes cannot have a swapchain (sg_pass.swapchain)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_ATTACHMENTS_EXISTS, "sg_begin_pass: attachments object no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_ATTACHMENTS_VALID, "sg_begin_pass: attachments object not in resource state VALID") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_COLOR_ATTACHMENT_IMAGE, "sg_begin_pass: one or more color attachment images are not valid") \
@@ -3762,6 +5025,7 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_APIP_COLOR_FORMAT, "sg_apply_pipeline: pipeline color attachment pixel format doesn't match pass color attachment pixel format") \
     _SG_LOGITEM_XMACRO(VALIDATE_APIP_DEPTH_FORMAT, "sg_apply_pipeline: pipeline depth pixel_format doesn't match pass depth attachment pixel format") \
     _SG_LOGITEM_XMACRO(VALIDATE_APIP_SAMPLE_COUNT, "sg_apply_pipeline: pipeline MSAA sample count doesn't match render pass attachment sample count") \
+    _SG_LOGITEM_XMACRO(VALIDATE_APIP_PASS_TYPE, "sg_apply_pipeline: compute pipelines can only be applied in compute passes, and render pipelines only in render passes") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_PIPELINE, "sg_apply_bindings: must be called after sg_apply_pipeline") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_PIPELINE_EXISTS, "sg_apply_bindings: currently applied pipeline object no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_PIPELINE_VALID, "sg_apply_bindings: currently applied pipeline object not in valid state") \
@@ -3808,18 +5072,65 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_FS_STORAGEBUFFER_EXISTS, "sg_apply_bindings: storage buffer bound to fragment stage no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_FS_STORAGEBUFFER_BINDING_BUFFERTYPE, "sg_apply_bindings: buffer bound to frahment stage storage buffer slot is not of type storage buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_FS_UNEXPECTED_STORAGEBUFFER_BINDING, "sg_apply_bindings: unexpected storage buffer binding on fragment stage") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_COMPUTE_BINDINGS, "sg_apply_bindings: compute pipelines expect no vertex-, index-buffer, vertex- or fragment-stage bindings (use sg_bindings.cs)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_UNEXPECTED_CS_BINDINGS, "sg_apply_bindings: render pipelines expect no compute-stage bindings (sg_bindings.cs)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_EXPECTED_STORAGEIMAGE_BINDING, "sg_apply_bindings: storage image binding on compute stage is missing or the image handle is invalid") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_STORAGEIMAGE_EXISTS, "sg_apply_bindings: storage image bound to compute stage no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_STORAGEIMAGE_USAGE, "sg_apply_bindings: image bound to compute stage storage image slot wasn't created with storage_image=true") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_STORAGEIMAGE_TYPE_MISMATCH, "sg_apply_bindings: type of storage image bound to compute stage doesn't match shader desc") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_STORAGEIMAGE_FORMAT, "sg_apply_bindings: pixel format of storage image bound to compute stage doesn't match shader desc access format") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_CS_UNEXPECTED_STORAGEIMAGE_BINDING, "sg_apply_bindings: unexpected storage image binding on compute stage") \
     _SG_LOGITEM_XMACRO(VALIDATE_AUB_NO_PIPELINE, "sg_apply_uniforms: must be called after sg_apply_pipeline()") \
     _SG_LOGITEM_XMACRO(VALIDATE_AUB_NO_UB_AT_SLOT, "sg_apply_uniforms: no uniform block declaration at this shader stage UB slot") \
     _SG_LOGITEM_XMACRO(VALIDATE_AUB_SIZE, "sg_apply_uniforms: data size doesn't match declared uniform block size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_STAGE, "sg_apply_uniforms: SG_SHADERSTAGE_CS requires a compute pipeline, SG_SHADERSTAGE_VS/FS a render pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_COMPUTE_PASS, "sg_draw: cannot be called inside a compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_COMPUTE_PASS, "sg_dispatch: must be called inside a compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NO_PIPELINE, "sg_dispatch: must be called after sg_apply_pipeline() with a compute pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUM_GROUPS, "sg_dispatch: number of workgroups must be >= 0 and <= 65535 in each dimension") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_USAGE, "sg_update_buffer: cannot update immutable buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_SIZE, "sg_update_buffer: update size is bigger than buffer size") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_ONCE, "sg_update_buffer: only one update allowed per buffer and frame") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_APPEND, "sg_update_buffer: cannot call sg_update_buffer and sg_append_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_RANGE, "sg_update_buffer: cannot call sg_update_buffer and sg_update_buffer_range in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_USAGE, "sg_update_buffer_range: cannot update immutable buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_SIZE, "sg_update_buffer_range: offset plus update size is bigger than buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_OFFSET, "sg_update_buffer_range: offset must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_SIZE_ALIGNMENT, "sg_update_buffer_range: size must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_UPDATE, "sg_update_buffer_range: cannot call sg_update_buffer_range and sg_update_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUFRANGE_APPEND, "sg_update_buffer_range: cannot call sg_update_buffer_range and sg_append_buffer in same frame") \
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_USAGE, "sg_append_buffer: cannot append to immutable buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_SIZE, "sg_append_buffer: overall appended size is bigger than buffer size") \
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_UPDATE, "sg_append_buffer: cannot call sg_append_buffer and sg_update_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_RANGE, "sg_append_buffer: cannot call sg_append_buffer and sg_update_buffer_range in same frame") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_USAGE, "sg_update_image: cannot update immutable image") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_ONCE, "sg_update_image: only one update allowed per image and frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGMIP_MIPLEVEL, "sg_update_image_mip: mip_level out of range") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGMIP_RESIDENT, "sg_update_image_mip: mipmap is already resident (each mipmap can only be streamed in once)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_CANARY, "sg_read_image_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_CALLBACK, "sg_read_image_async: sg_read_image_desc.callback must be set") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_RENDERTARGET, "sg_read_image_async: image must be a render target") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_IMAGETYPE, "sg_read_image_async: image must be a 2D image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_SAMPLECOUNT, "sg_read_image_async: image sample count must be 1 (read back the resolve image instead)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_COLORFORMAT, "sg_read_image_async: image must have a color pixel format") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_RECT, "sg_read_image_async: readback rectangle is outside the image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMG_INPASS, "sg_read_image_async: cannot be called inside a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_INPASS, "sg_copy_buffer: cannot be called inside a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_USAGE, "sg_copy_buffer: cannot copy into immutable buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_ALIGNMENT, "sg_copy_buffer: offsets and size must be multiples of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_SRC_RANGE, "sg_copy_buffer: source offset plus size is bigger than source buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_DST_RANGE, "sg_copy_buffer: destination offset plus size is bigger than destination buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_OVERLAP, "sg_copy_buffer: source and destination ranges overlap") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYBUF_SHADOW, "sg_copy_buffer: destination buffer is updated with sg_update_buffer_range(), so the source buffer must be too") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_CANARY, "sg_image_copy_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_INPASS, "sg_copy_image_region: cannot be called inside a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_USAGE, "sg_copy_image_region: destination image must be a render target, storage image or have dynamic/stream usage") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_FORMAT, "sg_copy_image_region: source and destination image must have the same pixel format") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_COMPRESSED, "sg_copy_image_region: compressed pixel formats are not supported") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_SAMPLECOUNT, "sg_copy_image_region: image sample count must be 1") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_SRC_REGION, "sg_copy_image_region: source region is outside the source image (check mip level, slices and rectangle)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_DST_REGION, "sg_copy_image_region: destination region is outside the destination image (check mip level, slices and rectangle)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COPYIMG_OVERLAP, "sg_copy_image_region: source and destination regions overlap") \
     _SG_LOGITEM_XMACRO(VALIDATION_FAILED, "validation layer checks failed") \
 
 #define _SG_LOGITEM_XMACRO(item,msg) SG_LOGITEM_##item,
@@ -3844,10 +5155,27 @@ typedef enum sg_log_item {
     .pass_pool_size         16
     .uniform_buffer_size    4 MB (4*1024*1024)
     .max_commit_listeners   1024
+    .transient_pool_size    64
+    .transient_attachments_cache_size   same as .transient_pool_size
+    .transient_max_unused_frames    8
+    .readback_pool_size     16
+    .num_inflight_frames    SG_NUM_INFLIGHT_FRAMES (2)
+    .max_frames_ahead       0 (no frame pacing in sg_commit())
     .disable_validation     false
+    .dedup_uniforms         false
+    .coalesce_draws         false
+    .record_manifest        false
+    .dedup_immutable_resources  false
+    .gl_vao_cache_size      0 (VAO cache disabled)
+    .gl_staging_buffer_size 0 (texture upload staging disabled)
     .mtl_force_managed_storage_mode false
     .wgpu_disable_bindgroups_cache  false
     .wgpu_bindgroups_cache_size     1024
+    .dummy_gpu_latency_ms   0.0
+
+    .residency.budget       0 (image eviction disabled)
+    .residency.evicted_func 0
+    .residency.user_data    0
 
     .allocator.alloc_fn     0 (in this case, malloc() will be called)
     .allocator.free_fn      0 (in this case, free() will be called)
@@ -3860,6 +5188,60 @@ typedef enum sg_log_item {
     .environment.defaults.depth_format: SG_PIXELFORMAT_DEPTH_STENCIL
     .environment.defaults.sample_count: 1
 
+    The .num_inflight_frames item defines how many frames the CPU may run
+    ahead of the GPU before it has to wait. On GL and Metal, each buffer and
+    image with SG_USAGE_DYNAMIC or SG_USAGE_STREAM is allocated once per
+    in-flight frame, and sg_update_*() / sg_append_buffer() rotate through
+    those copies, so the memory used by dynamic and stream resources grows
+    linearly with the in-flight frame count (on Metal, this also applies to
+    the uniform buffer, so its memory usage is sg_desc.uniform_buffer_size
+    times num_inflight_frames). Use 3 if you see CPU/GPU serialization
+    stalls in sg_update_*() calls, or 1 to save memory if stalls don't matter.
+    The value is clamped to the range 1..SG_MAX_INFLIGHT_FRAMES (3). The
+    number of copies of a specific resource can be inspected with
+    sg_query_buffer_info().num_slots and sg_query_image_info().num_slots.
+    On D3D11 and WebGPU, resource renaming is handled by the 3D API, and
+    the value only affects sokol-gfx internal bookkeeping.
+
+    The .max_frames_ahead item enables frame pacing in sg_commit() on the
+    GL and dummy backends (see FRAME PACING). It is clamped to the range
+    0..SG_MAX_INFLIGHT_FRAMES, 0 (the default) disables frame pacing.
+
+    GL specific:
+        .gl_vao_cache_size
+            By default the GL backends use a single vertex array object and
+            re-specify the vertex attributes in sg_apply_bindings() whenever
+            the vertex buffers, buffer offsets or the vertex layout have
+            changed. When .gl_vao_cache_size is > 0, the GL backend instead
+            keeps up to this many vertex array objects around, keyed by the
+            vertex layout, vertex buffers, buffer offsets and index buffer,
+            so that a cache hit in sg_apply_bindings() is a single
+            glBindVertexArray() call. When the cache is full, the least
+            recently used VAO is destroyed, and all VAOs referencing a buffer
+            are destroyed when the buffer is destroyed. The cache efficiency
+            can be inspected in sg_frame_stats.gl (num_vao_cache_hits,
+            num_vao_cache_misses and num_vao_cache_evictions). Enabling the
+            cache is mainly useful with a small set of vertex buffer
+            combinations which are bound with the same offsets each frame,
+            buffer offsets which change every frame (for instance from
+            sg_append_buffer()) will cause a cache miss each time.
+        .gl_staging_buffer_size
+            When this is > 0, the GL backends (except WebGL2) create a pixel
+            unpack buffer of this size which is used as a ring buffer to
+            stage texture data: sg_update_image() and the creation of large
+            immutable images (at least 256 KBytes of pixel data) copy the
+            data into the staging buffer and then issue glTexSubImage*() /
+            glTexImage*() from the staging buffer, which allows the GL driver
+            to do the actual upload asynchronously instead of blocking the
+            calling thread. Ring space is recycled with fences which are
+            inserted in sg_commit(), when the staging buffer is full, the CPU
+            waits for the GPU (this is counted in sg_frame_stats.gl.num_staging_stalls),
+            and uploads which are bigger than the whole staging buffer use
+            the regular direct upload path. A good size is a few times the
+            texture data uploaded per frame, for instance for streaming a
+            1080p RGBA8 video (8 MBytes per frame) with the default in-flight
+            frame count, use at least 3 * 8 MBytes.
+
     Metal specific:
         (NOTE: All Objective-C object references are transferred through
         a bridged (const void*) to sokol_gfx, which will use a unretained
@@ -3988,6 +5370,19 @@ typedef struct sg_logger {
     void* user_data;
 } sg_logger;
 
+/*
+    sg_residency_desc
+
+    Configures the memory budget for evictable images and the callback
+    which is called when an image has been evicted (see the section
+    IMAGE RESIDENCY).
+*/
+typedef struct sg_residency_desc {
+    size_t budget;      // max memory in bytes for evictable images (0 disables eviction)
+    void (*evicted_func)(sg_image img, void* user_data);
+    void* user_data;
+} sg_residency_desc;
+
 typedef struct sg_desc {
     uint32_t _start_canary;
     int buffer_pool_size;
@@ -3998,11 +5393,25 @@ typedef struct sg_desc {
     int attachments_pool_size;
     int uniform_buffer_size;
     int max_commit_listeners;
+    int transient_pool_size;            // max number of images in the transient render target pool
+    int transient_attachments_cache_size;   // max number of cached sg_make_transient_attachments() objects
+    int transient_max_unused_frames;    // transient images are destroyed after this many frames without use
+    int readback_pool_size;             // max number of pending sg_read_image_async() readbacks
+    int num_inflight_frames;            // number of frames the CPU may run ahead of the GPU (1..SG_MAX_INFLIGHT_FRAMES)
+    int max_frames_ahead;               // GL and dummy: block in sg_commit() when the CPU is this many frames ahead of the GPU (0 = off)
+    int gl_vao_cache_size;              // GL: max number of cached vertex array objects (0 disables the cache)
+    int gl_staging_buffer_size;         // GL: size of the texture upload staging ring buffer in bytes (0 disables staging)
     bool disable_validation;    // disable validation layer even in debug mode, useful for tests
+    bool dedup_uniforms;        // skip sg_apply_uniforms() calls with the same data as the previous call
+    bool coalesce_draws;        // merge consecutive sg_draw() calls with contiguous element ranges and unchanged state
+    bool record_manifest;       // record shader and pipeline creation params for sg_export_manifest()
+    bool dedup_immutable_resources; // share backend objects between immutable buffers/images with identical content
     bool mtl_force_managed_storage_mode; // for debugging: use Metal managed storage mode for resources even with UMA
     bool mtl_use_command_buffer_with_retained_references;    // Metal: use a managed MTLCommandBuffer which ref-counts used resources
     bool wgpu_disable_bindgroups_cache;  // set to true to disable the WebGPU backend BindGroup cache
     int wgpu_bindgroups_cache_size;      // number of slots in the WebGPU bindgroup cache (must be 2^N)
+    double dummy_gpu_latency_ms;         // dummy backend: simulated time the GPU needs to finish a frame
+    sg_residency_desc residency;         // memory budget for evictable images
     sg_allocator allocator;
     sg_logger logger; // optional log function override
     sg_environment environment;
@@ -4013,12 +5422,20 @@ typedef struct sg_desc {
 SOKOL_GFX_API_DECL void sg_setup(const sg_desc* desc);
 SOKOL_GFX_API_DECL void sg_shutdown(void);
 SOKOL_GFX_API_DECL bool sg_isvalid(void);
+SOKOL_GFX_API_DECL sg_context sg_make_context(const sg_desc* desc);
+SOKOL_GFX_API_DECL void sg_destroy_context(sg_context ctx);
+SOKOL_GFX_API_DECL void sg_set_context(sg_context ctx);
+SOKOL_GFX_API_DECL sg_context sg_get_context(void);
+SOKOL_GFX_API_DECL sg_context sg_default_context(void);
 SOKOL_GFX_API_DECL void sg_reset_state_cache(void);
 SOKOL_GFX_API_DECL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks);
 SOKOL_GFX_API_DECL void sg_push_debug_group(const char* name);
 SOKOL_GFX_API_DECL void sg_pop_debug_group(void);
 SOKOL_GFX_API_DECL bool sg_add_commit_listener(sg_commit_listener listener);
 SOKOL_GFX_API_DECL bool sg_remove_commit_listener(sg_commit_listener listener);
+SOKOL_GFX_API_DECL size_t sg_query_manifest_size(void);
+SOKOL_GFX_API_DECL size_t sg_export_manifest(const sg_range* dst);
+SOKOL_GFX_API_DECL bool sg_prewarm(const sg_range* manifest, double budget_ms);
 
 // resource creation, destruction and updating
 SOKOL_GFX_API_DECL sg_buffer sg_make_buffer(const sg_buffer_desc* desc);
@@ -4026,6 +5443,7 @@ SOKOL_GFX_API_DECL sg_image sg_make_image(const sg_image_desc* desc);
 SOKOL_GFX_API_DECL sg_sampler sg_make_sampler(const sg_sampler_desc* desc);
 SOKOL_GFX_API_DECL sg_shader sg_make_shader(const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc);
+SOKOL_GFX_API_DECL sg_pipeline sg_make_pipeline_variant(sg_pipeline base_pip, const sg_pipeline_variant_desc* desc);
 SOKOL_GFX_API_DECL sg_attachments sg_make_attachments(const sg_attachments_desc* desc);
 SOKOL_GFX_API_DECL void sg_destroy_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_destroy_image(sg_image img);
@@ -4034,10 +5452,22 @@ SOKOL_GFX_API_DECL void sg_destroy_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_destroy_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_destroy_attachments(sg_attachments atts);
 SOKOL_GFX_API_DECL void sg_update_buffer(sg_buffer buf, const sg_range* data);
+SOKOL_GFX_API_DECL void sg_update_buffer_range(sg_buffer buf, size_t offset, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data);
+SOKOL_GFX_API_DECL void sg_update_image_mip(sg_image img, int mip_level, const sg_image_data* data);
+SOKOL_GFX_API_DECL bool sg_read_image_async(sg_image img, const sg_read_image_desc* desc);
+SOKOL_GFX_API_DECL void sg_copy_buffer(sg_buffer dst, size_t dst_offset, sg_buffer src, size_t src_offset, size_t size);
+SOKOL_GFX_API_DECL void sg_copy_image_region(const sg_image_copy_desc* desc);
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL bool sg_query_buffer_overflow(sg_buffer buf);
 SOKOL_GFX_API_DECL bool sg_query_buffer_will_overflow(sg_buffer buf, size_t size);
+SOKOL_GFX_API_DECL sg_buffer_view sg_alloc_buffer_view(sg_buffer buf, size_t size);
+SOKOL_GFX_API_DECL void sg_free_buffer_view(sg_buffer_view view);
+SOKOL_GFX_API_DECL sg_image sg_acquire_transient_image(const sg_image_desc* desc);
+SOKOL_GFX_API_DECL void sg_release_transient_image(sg_image img);
+SOKOL_GFX_API_DECL sg_attachments sg_make_transient_attachments(const sg_attachments_desc* desc);
+SOKOL_GFX_API_DECL void sg_pin_image(sg_image img);
+SOKOL_GFX_API_DECL void sg_unpin_image(sg_image img);
 
 // rendering functions
 SOKOL_GFX_API_DECL void sg_begin_pass(const sg_pass* pass);
@@ -4049,6 +5479,7 @@ SOKOL_GFX_API_DECL void sg_apply_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_apply_bindings(const sg_bindings* bindings);
 SOKOL_GFX_API_DECL void sg_apply_uniforms(sg_shader_stage stage, int ub_index, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_draw(int base_element, int num_elements, int num_instances);
+SOKOL_GFX_API_DECL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z);
 SOKOL_GFX_API_DECL void sg_end_pass(void);
 SOKOL_GFX_API_DECL void sg_commit(void);
 
@@ -4074,6 +5505,9 @@ SOKOL_GFX_API_DECL sg_sampler_info sg_query_sampler_info(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_shader_info sg_query_shader_info(sg_shader shd);
 SOKOL_GFX_API_DECL sg_pipeline_info sg_query_pipeline_info(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_attachments_info sg_query_attachments_info(sg_attachments atts);
+// iterate over all valid buffers and images, start with an invalid handle (see RESOURCE USAGE TRACKING)
+SOKOL_GFX_API_DECL sg_buffer sg_query_next_buffer(sg_buffer prev_buf);
+SOKOL_GFX_API_DECL sg_image sg_query_next_image(sg_image prev_img);
 // get desc structs matching a specific resource (NOTE that not all creation attributes may be provided)
 SOKOL_GFX_API_DECL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_image_desc sg_query_image_desc(sg_image img);
@@ -4108,6 +5542,8 @@ SOKOL_GFX_API_DECL void sg_init_sampler(sg_sampler smg, const sg_sampler_desc* d
 SOKOL_GFX_API_DECL void sg_init_shader(sg_shader shd, const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_attachments(sg_attachments attachments, const sg_attachments_desc* desc);
+SOKOL_GFX_API_DECL void sg_queue_init_buffer(sg_buffer buf, const sg_buffer_desc* desc);
+SOKOL_GFX_API_DECL void sg_queue_init_image(sg_image img, const sg_image_desc* desc);
 SOKOL_GFX_API_DECL void sg_uninit_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_uninit_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_uninit_sampler(sg_sampler smp);
@@ -4126,6 +5562,10 @@ SOKOL_GFX_API_DECL void sg_enable_frame_stats(void);
 SOKOL_GFX_API_DECL void sg_disable_frame_stats(void);
 SOKOL_GFX_API_DECL bool sg_frame_stats_enabled(void);
 SOKOL_GFX_API_DECL sg_frame_stats sg_query_frame_stats(void);
+SOKOL_GFX_API_DECL sg_transient_stats sg_query_transient_stats(void);
+SOKOL_GFX_API_DECL sg_residency_stats sg_query_residency_stats(void);
+SOKOL_GFX_API_DECL sg_dedup_stats sg_query_dedup_stats(void);
+SOKOL_GFX_API_DECL sg_frame_pacing sg_query_frame_pacing(void);
 
 /* Backend-specific structs and functions, these may come in handy for mixing
    sokol-gfx rendering with 'native backend' rendering functions.
@@ -4169,12 +5609,12 @@ typedef struct sg_d3d11_attachments_info {
 } sg_d3d11_attachments_info;
 
 typedef struct sg_mtl_buffer_info {
-    const void* buf[SG_NUM_INFLIGHT_FRAMES];  // id<MTLBuffer>
+    const void* buf[SG_MAX_INFLIGHT_FRAMES];  // id<MTLBuffer>
     int active_slot;
 } sg_mtl_buffer_info;
 
 typedef struct sg_mtl_image_info {
-    const void* tex[SG_NUM_INFLIGHT_FRAMES]; // id<MTLTexture>
+    const void* tex[SG_MAX_INFLIGHT_FRAMES]; // id<MTLTexture>
     int active_slot;
 } sg_mtl_image_info;
 
@@ -4224,12 +5664,12 @@ typedef struct sg_wgpu_attachments_info {
 } sg_wgpu_attachments_info;
 
 typedef struct sg_gl_buffer_info {
-    uint32_t buf[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t buf[SG_MAX_INFLIGHT_FRAMES];
     int active_slot;
 } sg_gl_buffer_info;
 
 typedef struct sg_gl_image_info {
-    uint32_t tex[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t tex[SG_MAX_INFLIGHT_FRAMES];
     uint32_t tex_target;
     uint32_t msaa_render_buffer;
     int active_slot;
@@ -4317,14 +5757,20 @@ SOKOL_GFX_API_DECL sg_gl_attachments_info sg_gl_query_attachments_info(sg_attach
 
 // reference-based equivalents for c++
 inline void sg_setup(const sg_desc& desc) { return sg_setup(&desc); }
+inline sg_context sg_make_context(const sg_desc& desc) { return sg_make_context(&desc); }
+inline size_t sg_export_manifest(const sg_range& dst) { return sg_export_manifest(&dst); }
+inline bool sg_prewarm(const sg_range& manifest, double budget_ms) { return sg_prewarm(&manifest, budget_ms); }
 
 inline sg_buffer sg_make_buffer(const sg_buffer_desc& desc) { return sg_make_buffer(&desc); }
 inline sg_image sg_make_image(const sg_image_desc& desc) { return sg_make_image(&desc); }
 inline sg_sampler sg_make_sampler(const sg_sampler_desc& desc) { return sg_make_sampler(&desc); }
 inline sg_shader sg_make_shader(const sg_shader_desc& desc) { return sg_make_shader(&desc); }
 inline sg_pipeline sg_make_pipeline(const sg_pipeline_desc& desc) { return sg_make_pipeline(&desc); }
+inline sg_pipeline sg_make_pipeline_variant(sg_pipeline base_pip, const sg_pipeline_variant_desc& desc) { return sg_make_pipeline_variant(base_pip, &desc); }
 inline sg_attachments sg_make_attachments(const sg_attachments_desc& desc) { return sg_make_attachments(&desc); }
 inline void sg_update_image(sg_image img, const sg_image_data& data) { return sg_update_image(img, &data); }
+inline void sg_update_image_mip(sg_image img, int mip_level, const sg_image_data& data) { return sg_update_image_mip(img, mip_level, &data); }
+inline bool sg_read_image_async(sg_image img, const sg_read_image_desc& desc) { return sg_read_image_async(img, &desc); }
 
 inline void sg_begin_pass(const sg_pass& pass) { return sg_begin_pass(&pass); }
 inline void sg_apply_bindings(const sg_bindings& bindings) { return sg_apply_bindings(&bindings); }
@@ -4345,6 +5791,7 @@ inline void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc& desc) { re
 inline void sg_init_attachments(sg_attachments atts, const sg_attachments_desc& desc) { return sg_init_attachments(atts, &desc); }
 
 inline void sg_update_buffer(sg_buffer buf_id, const sg_range& data) { return sg_update_buffer(buf_id, &data); }
+inline void sg_update_buffer_range(sg_buffer buf_id, size_t offset, const sg_range& data) { return sg_update_buffer_range(buf_id, offset, &data); }
 inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_append_buffer(buf_id, &data); }
 #endif
 #endif // SOKOL_GFX_INCLUDED
@@ -4369,6 +5816,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 #include <stdlib.h> // malloc, free
 #include <string.h> // memset
 #include <float.h> // FLT_MAX
+#include <limits.h> // INT_MAX
 
 #ifndef SOKOL_API_IMPL
     #define SOKOL_API_IMPL
@@ -4398,12 +5846,57 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #define _SOKOL_UNUSED(x) (void)(x)
 #endif
 
-#if defined(SOKOL_TRACE_HOOKS)
-#define _SG_TRACE_ARGS(fn, ...) if (_sg.hooks.fn) { _sg.hooks.fn(__VA_ARGS__, _sg.hooks.user_data); }
-#define _SG_TRACE_NOARGS(fn) if (_sg.hooks.fn) { _sg.hooks.fn(_sg.hooks.user_data); }
-#else
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+    #if defined(_WIN32)
+        #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+        #endif
+        #ifndef NOMINMAX
+        #define NOMINMAX
+        #endif
+        #include <windows.h>
+        #define _SG_WINTHREADS (1)
+    #elif defined(__EMSCRIPTEN__)
+        #define _SG_NOTHREADS (1)
+    #else
+        #include <pthread.h>
+        #define _SG_PTHREADS (1)
+    #endif
+#endif
+
+// for the time budget in sg_prewarm() and frame pacing, on Win32 only use
+// QueryPerformanceCounter() if windows.h is included anyway (D3D11, the
+// embedded GL loader or the thread-safe resource functions)
+#if defined(_WIN32)
+    #if defined(SOKOL_D3D11) || (defined(SOKOL_GLCORE) && !defined(SOKOL_EXTERNAL_GL_LOADER)) || defined(_SG_WINTHREADS)
+        #define _SG_WIN32_TIMER (1)
+    #else
+        #include <time.h>
+    #endif
+#elif defined(__APPLE__)
+    #include <mach/mach_time.h>
+#elif defined(__EMSCRIPTEN__)
+    #include <emscripten/emscripten.h>
+#else
+    // NOTE: clock_gettime() is POSIX, with strict -std=c99/c11 it's only
+    // available if _POSIX_C_SOURCE >= 199309L is defined before including
+    // any system headers, otherwise fall back to the C11 timespec_get()
+    #include <time.h>
+#endif
+
+#if defined(SOKOL_TRACE_HOOKS)
+#define _SG_TRACE_ARGS(fn, ...) if (_sg.hooks.fn) { _sg.hooks.fn(__VA_ARGS__, _sg.hooks.user_data); }
+#define _SG_TRACE_NOARGS(fn) if (_sg.hooks.fn) { _sg.hooks.fn(_sg.hooks.user_data); }
+// sg_alloc_*() may be called from worker threads, trace hooks are not thread-safe
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+#define _SG_TRACE_ALLOC(fn, res) if (_sg_on_render_thread()) { _SG_TRACE_ARGS(fn, res); }
+#else
+#define _SG_TRACE_ALLOC(fn, res) _SG_TRACE_ARGS(fn, res)
+#endif
+#else
 #define _SG_TRACE_ARGS(fn, ...)
 #define _SG_TRACE_NOARGS(fn)
+#define _SG_TRACE_ALLOC(fn, res)
 #endif
 
 // default clear values
@@ -4520,6 +6013,22 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #endif
     #endif
 
+    // GL_ARB_multi_bind entry points (glBindTextures etc) are only available on desktop GL
+    // (with a runtime check for the GL version or extension), but not on macOS
+    #if defined(SOKOL_GLCORE) && !defined(__APPLE__)
+        #define _SOKOL_GL_HAS_MULTI_BIND (1)
+    #endif
+
+    // compute shaders require GL 4.3 (checked at runtime), which isn't available on macOS
+    #if defined(SOKOL_GLCORE) && !defined(__APPLE__)
+        #define _SOKOL_GL_HAS_COMPUTE (1)
+    #endif
+
+    // glCopyImageSubData() requires GL 4.3 (checked at runtime), not available on macOS and GLES3
+    #if defined(SOKOL_GLCORE) && !defined(__APPLE__)
+        #define _SOKOL_GL_HAS_COPY_IMAGE (1)
+    #endif
+
     // optional GL loader definitions (only on Win32)
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
         #define __gl_h_ 1
@@ -4554,6 +6063,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         typedef int64_t  GLint64;
         typedef float  GLfloat;
         typedef int  GLint;
+        typedef struct __GLsync* GLsync;
         #define GL_INT_2_10_10_10_REV 0x8D9F
         #define GL_R32F 0x822E
         #define GL_PROGRAM_POINT_SIZE 0x8642
@@ -4762,6 +6272,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #define GL_COMPARE_REF_TO_TEXTURE 0x884E
         #define GL_TEXTURE_CUBE_MAP_SEAMLESS 0x884F
         #define GL_TEXTURE_MAX_LEVEL 0x813D
+        #define GL_TEXTURE_BASE_LEVEL 0x813C
         #define GL_FRAMEBUFFER_UNDEFINED 0x8219
         #define GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT 0x8CD6
         #define GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT 0x8CD7
@@ -4769,6 +6280,22 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #define GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE 0x8D56
         #define GL_MAJOR_VERSION 0x821B
         #define GL_MINOR_VERSION 0x821C
+        #define GL_PIXEL_PACK_BUFFER 0x88EB
+        #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+        #define GL_COPY_READ_BUFFER 0x8F36
+        #define GL_COPY_WRITE_BUFFER 0x8F37
+        #define GL_MAP_WRITE_BIT 0x0002
+        #define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+        #define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+        #define GL_STREAM_READ 0x88E1
+        #define GL_PACK_ALIGNMENT 0x0D05
+        #define GL_MAP_READ_BIT 0x0001
+        #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+        #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+        #define GL_ALREADY_SIGNALED 0x911A
+        #define GL_TIMEOUT_EXPIRED 0x911B
+        #define GL_CONDITION_SATISFIED 0x911C
+        #define GL_WAIT_FAILED 0x911D
     #endif
 
     #ifndef GL_UNSIGNED_INT_2_10_10_10_REV
@@ -4895,6 +6422,24 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 #ifndef GL_SHADER_STORAGE_BUFFER
 #define GL_SHADER_STORAGE_BUFFER 0x90D2
 #endif
+#ifndef GL_COMPUTE_SHADER
+#define GL_COMPUTE_SHADER 0x91B9
+#endif
+#ifndef GL_SHADER_STORAGE_BARRIER_BIT
+#define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
+#endif
+#ifndef GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+#define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
+#endif
+#ifndef GL_ALL_BARRIER_BITS
+#define GL_ALL_BARRIER_BITS 0xFFFFFFFF
+#endif
+#ifndef GL_READ_ONLY
+#define GL_READ_ONLY 0x88B8
+#endif
+#ifndef GL_READ_WRITE
+#define GL_READ_WRITE 0x88BA
+#endif
 
 // ███████ ████████ ██████  ██    ██  ██████ ████████ ███████
 // ██         ██    ██   ██ ██    ██ ██         ██    ██
@@ -4903,24 +6448,66 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 // ███████    ██    ██   ██  ██████   ██████    ██    ███████
 //
 // >>structs
+#if defined(SOKOL_TRACK_RESOURCE_USAGE)
+// per-resource usage counters
+typedef struct {
+    uint32_t use_frame_index;       // frame index of the last use
+    uint32_t num_uses;              // number of uses in use_frame_index
+    uint32_t num_uses_prev_frame;   // number of uses in the frame before use_frame_index
+    uint32_t num_uses_total;
+    uint64_t num_updated_bytes;
+} _sg_slot_usage_t;
+#endif
+
 // resource pool slots
 typedef struct {
     uint32_t id;
     sg_resource_state state;
+    #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+    _sg_slot_usage_t usage;
+    #endif
 } _sg_slot_t;
 
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+#if defined(_SG_PTHREADS)
+typedef struct {
+    pthread_mutex_t mutex;
+} _sg_mutex_t;
+#elif defined(_SG_WINTHREADS)
+typedef struct {
+    CRITICAL_SECTION critsec;
+} _sg_mutex_t;
+#else
+typedef struct {
+    int dummy_mutex;
+} _sg_mutex_t;
+#endif
+#if defined(_SG_PTHREADS)
+typedef pthread_t _sg_thread_id_t;
+#elif defined(_SG_WINTHREADS)
+typedef DWORD _sg_thread_id_t;
+#else
+typedef int _sg_thread_id_t;
+#endif
+#endif
+
 // resource pool housekeeping struct
 typedef struct {
     int size;
     int queue_top;
     uint32_t* gen_ctrs;
     int* free_queue;
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_mutex_t mutex;  // protects the free queue
+    #endif
 } _sg_pool_t;
 
 _SOKOL_PRIVATE void _sg_init_pool(_sg_pool_t* pool, int num);
 _SOKOL_PRIVATE void _sg_discard_pool(_sg_pool_t* pool);
 _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool);
 _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index);
+_SOKOL_PRIVATE uint32_t _sg_pool_alloc_slot(_sg_pool_t* pool, void* items, size_t item_size);
+_SOKOL_PRIVATE void _sg_pool_free_slot(_sg_pool_t* pool, _sg_slot_t* slot);
 _SOKOL_PRIVATE void _sg_reset_slot(_sg_slot_t* slot);
 _SOKOL_PRIVATE uint32_t _sg_slot_alloc(_sg_pool_t* pool, _sg_slot_t* slot, int slot_index);
 _SOKOL_PRIVATE int _sg_slot_index(uint32_t id);
@@ -4939,6 +6526,13 @@ enum {
     _SG_DEFAULT_ATTACHMENTS_POOL_SIZE = 16,
     _SG_DEFAULT_UB_SIZE = 4 * 1024 * 1024,
     _SG_DEFAULT_MAX_COMMIT_LISTENERS = 1024,
+    _SG_DEFAULT_TRANSIENT_POOL_SIZE = 64,
+    _SG_DEFAULT_TRANSIENT_MAX_UNUSED_FRAMES = 8,
+    _SG_MAX_BUFFER_DIRTY_RANGES = 8,
+    _SG_DEFAULT_READBACK_POOL_SIZE = 16,
+    _SG_MAX_CONTEXTS = 16,
+    _SG_DEFAULT_CONTEXT_ID = 1,
+    _SG_MAX_FRAME_FENCES = SG_MAX_INFLIGHT_FRAMES + 1,
     _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE = 1024,
 };
 
@@ -4960,6 +6554,26 @@ typedef struct {
 _SOKOL_PRIVATE void* _sg_malloc_clear(size_t size);
 _SOKOL_PRIVATE void _sg_free(void* ptr);
 _SOKOL_PRIVATE void _sg_clear(void* ptr, size_t size);
+_SOKOL_PRIVATE int _sg_num_inflight_frames(void);
+
+typedef struct {
+    int offset;
+    int size;
+} _sg_buffer_range_t;
+
+// content hash of a deduplicated resource
+typedef struct {
+    uint64_t hash;          // used for the table lookup
+    size_t size;            // number of hashed bytes (creation attributes and content)
+} _sg_dedup_key_t;
+
+typedef struct {
+    _sg_dedup_key_t key;
+    int ref_count;          // 0 if the resource isn't in the dedup table
+    int next;               // pool slot index of the next item in the same bucket (0: end of chain)
+    size_t memory_size;
+    uint8_t* bytes;         // copy of the hashed bytes, compared on a hash match
+} _sg_dedup_item_t;
 
 typedef struct {
     int size;
@@ -4971,6 +6585,24 @@ typedef struct {
     int active_slot;
     sg_buffer_type type;
     sg_usage usage;
+    int max_size;           // > size if the buffer can grow on append-overflow
+    _sg_str_t label;        // label of growable buffers, passed on when the backend buffer is recreated
+    int append_demand;      // bytes requested by sg_append_buffer() in the current frame, including overflow
+    struct {
+        int max_views;
+        int alignment;
+        int num_views;
+        int num_free;
+        _sg_buffer_range_t* free;   // sorted by offset, capacity is max_views + 1
+        _sg_buffer_range_t* live;   // currently allocated views, unsorted, capacity is max_views
+    } views;
+    uint32_t update_range_frame_index;  // frame index of last sg_update_buffer_range()
+    uint8_t* shadow;        // CPU copy of the buffer content, created in first sg_update_buffer_range()
+    struct {
+        int num;
+        _sg_buffer_range_t ranges[_SG_MAX_BUFFER_DIRTY_RANGES];
+    } dirty[SG_MAX_INFLIGHT_FRAMES];    // per-slot ranges changed since the slot was last written
+    _sg_dedup_item_t dedup;
 } _sg_buffer_common_t;
 
 _SOKOL_PRIVATE void _sg_buffer_common_init(_sg_buffer_common_t* cmn, const sg_buffer_desc* desc) {
@@ -4979,10 +6611,109 @@ _SOKOL_PRIVATE void _sg_buffer_common_init(_sg_buffer_common_t* cmn, const sg_bu
     cmn->append_overflow = false;
     cmn->update_frame_index = 0;
     cmn->append_frame_index = 0;
-    cmn->num_slots = (desc->usage == SG_USAGE_IMMUTABLE) ? 1 : SG_NUM_INFLIGHT_FRAMES;
+    cmn->num_slots = (desc->usage == SG_USAGE_IMMUTABLE) ? 1 : _sg_num_inflight_frames();
     cmn->active_slot = 0;
     cmn->type = desc->type;
     cmn->usage = desc->usage;
+    cmn->max_size = (int)desc->max_size;
+    _sg_clear(&cmn->label, sizeof(cmn->label));
+    cmn->append_demand = 0;
+    cmn->update_range_frame_index = 0;
+    cmn->shadow = 0;
+    for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
+        cmn->dirty[i].num = 0;
+    }
+    if (desc->max_views > 0) {
+        // n allocated views can be separated by at most n+1 free ranges
+        cmn->views.max_views = desc->max_views;
+        cmn->views.alignment = (desc->view_alignment > 0) ? desc->view_alignment : 4;
+        cmn->views.free = (_sg_buffer_range_t*)_sg_malloc_clear((size_t)(desc->max_views + 1) * sizeof(_sg_buffer_range_t));
+        cmn->views.live = (_sg_buffer_range_t*)_sg_malloc_clear((size_t)desc->max_views * sizeof(_sg_buffer_range_t));
+        cmn->views.free[0].offset = 0;
+        cmn->views.free[0].size = cmn->size;
+        cmn->views.num_free = 1;
+    }
+}
+
+// true if the buffer will grow on append-overflow
+_SOKOL_PRIVATE bool _sg_buffer_common_can_grow(const _sg_buffer_common_t* cmn) {
+    return cmn->max_size > cmn->size;
+}
+
+_SOKOL_PRIVATE void _sg_buffer_common_discard_shadow(_sg_buffer_common_t* cmn) {
+    if (cmn->shadow) {
+        _sg_free(cmn->shadow);
+        cmn->shadow = 0;
+    }
+    for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
+        cmn->dirty[i].num = 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_buffer_common_discard(_sg_buffer_common_t* cmn) {
+    if (cmn->views.free) {
+        _sg_free(cmn->views.free);
+        cmn->views.free = 0;
+    }
+    if (cmn->views.live) {
+        _sg_free(cmn->views.live);
+        cmn->views.live = 0;
+    }
+    _sg_buffer_common_discard_shadow(cmn);
+}
+
+// add a range to the dirty list of a buffer slot, overlapping and adjacent
+// ranges are merged, and if the list is full the range is merged with the
+// closest existing range
+_SOKOL_PRIVATE void _sg_buffer_common_add_dirty(_sg_buffer_common_t* cmn, int slot, int offset, int size) {
+    SOKOL_ASSERT((slot >= 0) && (slot < SG_MAX_INFLIGHT_FRAMES));
+    int start = offset;
+    int end = offset + size;
+    int i = 0;
+    while (i < cmn->dirty[slot].num) {
+        const _sg_buffer_range_t* r = &cmn->dirty[slot].ranges[i];
+        if ((r->offset <= end) && ((r->offset + r->size) >= start)) {
+            start = _sg_min(start, r->offset);
+            end = _sg_max(end, r->offset + r->size);
+            cmn->dirty[slot].ranges[i] = cmn->dirty[slot].ranges[--cmn->dirty[slot].num];
+        } else {
+            i++;
+        }
+    }
+    if (cmn->dirty[slot].num == _SG_MAX_BUFFER_DIRTY_RANGES) {
+        int closest = 0;
+        int closest_gap = cmn->size;
+        for (i = 0; i < cmn->dirty[slot].num; i++) {
+            const _sg_buffer_range_t* r = &cmn->dirty[slot].ranges[i];
+            const int gap = (r->offset > end) ? (r->offset - end) : (start - (r->offset + r->size));
+            if (gap < closest_gap) {
+                closest = i;
+                closest_gap = gap;
+            }
+        }
+        const _sg_buffer_range_t* r = &cmn->dirty[slot].ranges[closest];
+        start = _sg_min(start, r->offset);
+        end = _sg_max(end, r->offset + r->size);
+        cmn->dirty[slot].ranges[closest] = cmn->dirty[slot].ranges[--cmn->dirty[slot].num];
+        // the merged range may now overlap other ranges
+        _sg_buffer_common_add_dirty(cmn, slot, start, end - start);
+        return;
+    }
+    _sg_buffer_range_t* dst = &cmn->dirty[slot].ranges[cmn->dirty[slot].num++];
+    dst->offset = start;
+    dst->size = end - start;
+}
+
+// copy updated data into the shadow copy and mark the range as dirty in all inactive slots
+_SOKOL_PRIVATE void _sg_buffer_common_track_update(_sg_buffer_common_t* cmn, int offset, const sg_range* data) {
+    SOKOL_ASSERT(cmn->shadow);
+    SOKOL_ASSERT((offset >= 0) && ((offset + (int)data->size) <= cmn->size));
+    memcpy(cmn->shadow + offset, data->ptr, data->size);
+    for (int slot = 0; slot < cmn->num_slots; slot++) {
+        if (slot != cmn->active_slot) {
+            _sg_buffer_common_add_dirty(cmn, slot, offset, (int)data->size);
+        }
+    }
 }
 
 typedef struct {
@@ -4991,28 +6722,48 @@ typedef struct {
     int active_slot;
     sg_image_type type;
     bool render_target;
+    bool storage_image;
     int width;
     int height;
     int num_slices;
     int num_mipmaps;
+    int base_mip_level;         // most detailed mipmap which can be sampled
+    uint32_t resident_mips;     // bit mask of mipmaps which have data
     sg_usage usage;
     sg_pixel_format pixel_format;
     int sample_count;
+    bool evictable;
+    bool evicted;
+    bool pinned;
+    int evict_priority;
+    uint32_t use_frame_index;
+    size_t memory_size;
+    _sg_dedup_item_t dedup;
 } _sg_image_common_t;
 
 _SOKOL_PRIVATE void _sg_image_common_init(_sg_image_common_t* cmn, const sg_image_desc* desc) {
     cmn->upd_frame_index = 0;
-    cmn->num_slots = (desc->usage == SG_USAGE_IMMUTABLE) ? 1 : SG_NUM_INFLIGHT_FRAMES;
+    cmn->num_slots = (desc->usage == SG_USAGE_IMMUTABLE) ? 1 : _sg_num_inflight_frames();
     cmn->active_slot = 0;
     cmn->type = desc->type;
     cmn->render_target = desc->render_target;
+    cmn->storage_image = desc->storage_image;
     cmn->width = desc->width;
     cmn->height = desc->height;
     cmn->num_slices = desc->num_slices;
     cmn->num_mipmaps = desc->num_mipmaps;
+    // progressively streamed images start with only the smallest mipmaps resident
+    cmn->base_mip_level = desc->num_mipmaps - desc->num_resident_mipmaps;
+    cmn->resident_mips = ((1u << desc->num_resident_mipmaps) - 1) << cmn->base_mip_level;
     cmn->usage = desc->usage;
     cmn->pixel_format = desc->pixel_format;
     cmn->sample_count = desc->sample_count;
+    cmn->evictable = desc->evictable;
+    cmn->evicted = false;
+    cmn->pinned = false;
+    cmn->evict_priority = desc->evict_priority;
+    cmn->use_frame_index = 0;
+    cmn->memory_size = 0;
 }
 
 typedef struct {
@@ -5068,26 +6819,52 @@ typedef struct {
     int sampler_slot;
 } _sg_shader_image_sampler_t;
 
+typedef struct {
+    sg_image_type image_type;
+    sg_pixel_format access_format;
+    bool readonly;
+} _sg_shader_storage_image_t;
+
 typedef struct {
     int num_uniform_blocks;
     int num_storage_buffers;
     int num_images;
     int num_samplers;
     int num_image_samplers;
+    int num_storage_images;
     _sg_shader_uniform_block_t uniform_blocks[SG_MAX_SHADERSTAGE_UBS];
     _sg_shader_storage_buffer_t storage_buffers[SG_MAX_SHADERSTAGE_STORAGEBUFFERS];
     _sg_shader_image_t images[SG_MAX_SHADERSTAGE_IMAGES];
     _sg_shader_sampler_t samplers[SG_MAX_SHADERSTAGE_SAMPLERS];
     _sg_shader_image_sampler_t image_samplers[SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS];
+    _sg_shader_storage_image_t storage_images[SG_MAX_SHADERSTAGE_STORAGEIMAGES];
 } _sg_shader_stage_t;
 
+// NOTE: compute shaders only have a single stage, which occupies the vertex stage slot
 typedef struct {
+    bool is_compute;
     _sg_shader_stage_t stage[SG_NUM_SHADER_STAGES];
+    uint64_t manifest_hash;     // hash of the creation params, only if manifests are used
+    int manifest_entry;         // index + 1 of the recorded manifest entry (0 if not recorded)
 } _sg_shader_common_t;
 
+_SOKOL_PRIVATE bool _sg_shader_desc_is_compute(const sg_shader_desc* desc) {
+    return (0 != desc->cs.source) || (0 != desc->cs.bytecode.ptr);
+}
+
+// returns the stage desc for an internal stage index (compute shaders use the VS slot)
+_SOKOL_PRIVATE const sg_shader_stage_desc* _sg_shader_desc_stage(const sg_shader_desc* desc, int stage_index) {
+    if (stage_index == SG_SHADERSTAGE_VS) {
+        return _sg_shader_desc_is_compute(desc) ? &desc->cs : &desc->vs;
+    } else {
+        return &desc->fs;
+    }
+}
+
 _SOKOL_PRIVATE void _sg_shader_common_init(_sg_shader_common_t* cmn, const sg_shader_desc* desc) {
+    cmn->is_compute = _sg_shader_desc_is_compute(desc);
     for (int stage_index = 0; stage_index < SG_NUM_SHADER_STAGES; stage_index++) {
-        const sg_shader_stage_desc* stage_desc = (stage_index == SG_SHADERSTAGE_VS) ? &desc->vs : &desc->fs;
+        const sg_shader_stage_desc* stage_desc = _sg_shader_desc_stage(desc, stage_index);
         _sg_shader_stage_t* stage = &cmn->stage[stage_index];
         SOKOL_ASSERT(stage->num_uniform_blocks == 0);
         for (int ub_index = 0; ub_index < SG_MAX_SHADERSTAGE_UBS; ub_index++) {
@@ -5140,10 +6917,22 @@ _SOKOL_PRIVATE void _sg_shader_common_init(_sg_shader_common_t* cmn, const sg_sh
             stage->storage_buffers[sbuf_index].readonly = sbuf_desc->readonly;
             stage->num_storage_buffers++;
         }
+        SOKOL_ASSERT(stage->num_storage_images == 0);
+        for (int simg_index = 0; simg_index < SG_MAX_SHADERSTAGE_STORAGEIMAGES; simg_index++) {
+            const sg_shader_storage_image_desc* simg_desc = &stage_desc->storage_images[simg_index];
+            if (!simg_desc->used) {
+                break;
+            }
+            stage->storage_images[simg_index].image_type = simg_desc->image_type;
+            stage->storage_images[simg_index].access_format = simg_desc->access_format;
+            stage->storage_images[simg_index].readonly = simg_desc->readonly;
+            stage->num_storage_images++;
+        }
     }
 }
 
 typedef struct {
+    bool is_compute;
     bool vertex_buffer_layout_active[SG_MAX_VERTEX_BUFFERS];
     bool use_instanced_draw;
     sg_shader shader_id;
@@ -5159,6 +6948,7 @@ typedef struct {
     int sample_count;
     sg_color blend_color;
     bool alpha_to_coverage_enabled;
+    int manifest_entry;         // index + 1 of the recorded manifest entry, reset on first use
 } _sg_pipeline_common_t;
 
 _SOKOL_PRIVATE void _sg_pipeline_common_init(_sg_pipeline_common_t* cmn, const sg_pipeline_desc* desc) {
@@ -5166,6 +6956,7 @@ _SOKOL_PRIVATE void _sg_pipeline_common_init(_sg_pipeline_common_t* cmn, const s
     for (int i = 0; i < SG_MAX_VERTEX_BUFFERS; i++) {
         cmn->vertex_buffer_layout_active[i] = false;
     }
+    cmn->is_compute = desc->compute;
     cmn->use_instanced_draw = false;
     cmn->shader_id = desc->shader;
     cmn->layout = desc->layout;
@@ -5197,6 +6988,7 @@ typedef struct {
     _sg_attachment_common_t colors[SG_MAX_COLOR_ATTACHMENTS];
     _sg_attachment_common_t resolves[SG_MAX_COLOR_ATTACHMENTS];
     _sg_attachment_common_t depth_stencil;
+    bool transient;     // owned by the transient pool (sg_make_transient_attachments())
 } _sg_attachments_common_t;
 
 _SOKOL_PRIVATE void _sg_attachment_common_init(_sg_attachment_common_t* cmn, const sg_attachment_desc* desc) {
@@ -5277,7 +7069,7 @@ typedef struct {
     _sg_slot_t slot;
     _sg_buffer_common_t cmn;
     struct {
-        GLuint buf[SG_NUM_INFLIGHT_FRAMES];
+        GLuint buf[SG_MAX_INFLIGHT_FRAMES];
         bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
     } gl;
 } _sg_gl_buffer_t;
@@ -5289,7 +7081,7 @@ typedef struct {
     struct {
         GLenum target;
         GLuint msaa_render_buffer;
-        GLuint tex[SG_NUM_INFLIGHT_FRAMES];
+        GLuint tex[SG_MAX_INFLIGHT_FRAMES];
         bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
     } gl;
 } _sg_gl_image_t;
@@ -5398,6 +7190,34 @@ typedef struct {
     GLuint sampler;
 } _sg_gl_cache_texture_sampler_bind_slot;
 
+// index buffer, and per vertex attribute: buffer, offset, stride, divisor, size+normalized, GL type
+#define _SG_GL_VAOCACHE_ATTR_ITEMS (6)
+#define _SG_GL_VAOCACHE_NUM_ITEMS (1 + _SG_GL_VAOCACHE_ATTR_ITEMS * SG_MAX_VERTEX_ATTRIBUTES)
+typedef struct {
+    uint64_t hash;
+    uint32_t items[_SG_GL_VAOCACHE_NUM_ITEMS];
+} _sg_gl_vao_cache_key_t;
+
+typedef struct {
+    GLuint vao;             // 0 if the cache item is unused
+    int bucket_next;        // next item in the same hash bucket, or -1
+    int lru_prev;           // towards the most recently used item, or -1
+    int lru_next;           // towards the least recently used item, or -1
+    _sg_gl_vao_cache_key_t key;
+} _sg_gl_vao_cache_item_t;
+
+// cached VAOs are found through a hash table with chained buckets, all
+// items (used and unused) are kept in a list ordered by last use, unused
+// items at the end, so that the last item is the one to (re-)use next
+typedef struct {
+    int num;                // 0 if the VAO cache is disabled
+    int num_buckets;        // power of 2
+    int* buckets;           // first item index in bucket, or -1
+    int lru_head;
+    int lru_tail;
+    _sg_gl_vao_cache_item_t* items;
+} _sg_gl_vao_cache_t;
+
 typedef struct {
     sg_depth_state depth;
     sg_stencil_state stencil;
@@ -5420,23 +7240,75 @@ typedef struct {
     GLuint prog;
     _sg_gl_cache_texture_sampler_bind_slot texture_samplers[_SG_GL_TEXTURE_SAMPLER_CACHE_SIZE];
     _sg_gl_cache_texture_sampler_bind_slot stored_texture_sampler;
+    struct {
+        // dirty slot ranges waiting for a multi-bind call (first > last if nothing is pending)
+        int first_texture_sampler;
+        int last_texture_sampler;
+        int first_storage_buffer[SG_NUM_SHADER_STAGES];
+        int last_storage_buffer[SG_NUM_SHADER_STAGES];
+    } multi_bind;
     int cur_ib_offset;
     GLenum cur_primitive_type;
     GLenum cur_index_type;
     GLenum cur_active_texture;
     _sg_pipeline_t* cur_pipeline;
     sg_pipeline cur_pipeline_id;
+    GLuint cur_vao;
 } _sg_gl_state_cache_t;
 
+typedef struct {
+    GLuint pbo;
+    int pbo_size;
+    GLsync fence;           // non-zero while the readback is pending
+    uint32_t frame_index;   // frame index when the readback was started
+    int num_bytes;
+    void (*callback)(const sg_image_readback* readback);
+    sg_image_readback info;
+} _sg_gl_readback_t;
+
+#define _SG_GL_STAGING_MAX_FENCES (16)
+#define _SG_GL_STAGING_ALIGN (16)
+#define _SG_GL_STAGING_MIN_IMMUTABLE_SIZE (256 * 1024)
+typedef struct {
+    GLsync fence;
+    uint64_t pos;           // staging ring position up to which data is covered by the fence
+} _sg_gl_staging_fence_t;
+
+typedef struct {
+    GLuint pbo;             // 0 if texture upload staging is disabled
+    int size;
+    // monotonic ring positions (in bytes), pbo offset is pos % size
+    uint64_t head;          // next write position
+    uint64_t tail;          // oldest position which may still be in use by the GPU
+    uint64_t fenced;        // position up to which writes have been fenced
+    int fence_head;
+    int fence_tail;
+    int num_fences;
+    _sg_gl_staging_fence_t fences[_SG_GL_STAGING_MAX_FENCES];
+} _sg_gl_staging_t;
+
 typedef struct {
     bool valid;
     GLuint vao;
+    _sg_gl_vao_cache_t vao_cache;
+    _sg_gl_staging_t staging;
     _sg_gl_state_cache_t cache;
     bool ext_anisotropic;
+    bool ext_multi_bind;    // GL_ARB_multi_bind or GL 4.4
+    bool compute_barrier_pending;   // a dispatch has written to storage buffers or images
     GLint max_anisotropy;
+    GLsync frame_fences[_SG_MAX_FRAME_FENCES];
     sg_store_action color_store_actions[SG_MAX_COLOR_ATTACHMENTS];
     sg_store_action depth_store_action;
     sg_store_action stencil_store_action;
+    struct {
+        GLuint fb;
+        int num_slots;
+        int head;           // next free slot
+        int tail;           // oldest pending readback
+        int num_pending;
+        _sg_gl_readback_t* slots;
+    } readback;
     #if _SOKOL_USE_WIN32_GL_LOADER
     HINSTANCE opengl32_dll;
     #endif
@@ -5583,7 +7455,7 @@ typedef struct {
     _sg_slot_t slot;
     _sg_buffer_common_t cmn;
     struct {
-        int buf[SG_NUM_INFLIGHT_FRAMES];  // index into _sg_mtl_pool
+        int buf[SG_MAX_INFLIGHT_FRAMES];  // index into _sg_mtl_pool
     } mtl;
 } _sg_mtl_buffer_t;
 typedef _sg_mtl_buffer_t _sg_buffer_t;
@@ -5592,7 +7464,7 @@ typedef struct {
     _sg_slot_t slot;
     _sg_image_common_t cmn;
     struct {
-        int tex[SG_NUM_INFLIGHT_FRAMES];
+        int tex[SG_MAX_INFLIGHT_FRAMES];
     } mtl;
 } _sg_mtl_image_t;
 typedef _sg_mtl_image_t _sg_image_t;
@@ -5684,7 +7556,7 @@ typedef struct {
     id<MTLCommandBuffer> cmd_buffer;
     id<MTLRenderCommandEncoder> cmd_encoder;
     id<CAMetalDrawable> cur_drawable;
-    id<MTLBuffer> uniform_buffers[SG_NUM_INFLIGHT_FRAMES];
+    id<MTLBuffer> uniform_buffers[SG_MAX_INFLIGHT_FRAMES];
 } _sg_mtl_backend_t;
 
 #elif defined(SOKOL_WGPU)
@@ -5863,6 +7735,166 @@ typedef struct {
     sg_commit_listener* items;
 } _sg_commit_listeners_t;
 
+// the image desc items which must match for reusing a transient image
+typedef struct {
+    sg_image_type type;
+    int width;
+    int height;
+    int num_slices;
+    int num_mipmaps;
+    sg_pixel_format pixel_format;
+    int sample_count;
+} _sg_transient_image_key_t;
+
+// an image in the transient render target pool
+typedef struct {
+    sg_image img;
+    _sg_transient_image_key_t key;
+    size_t size;
+    bool in_use;
+    uint32_t last_used_frame;
+} _sg_transient_image_t;
+
+// a cached attachments object for transient images
+typedef struct {
+    sg_attachments atts;
+    sg_attachments_desc desc;   // label is cleared, used as lookup key
+    uint32_t last_used_frame;
+} _sg_transient_attachments_t;
+
+typedef struct {
+    int capacity;
+    int atts_capacity;
+    int num_images;
+    int num_atts;
+    _sg_transient_image_t* images;
+    _sg_transient_attachments_t* atts;
+    sg_transient_stats stats;
+} _sg_transient_pool_t;
+
+// hash tables for resource deduplication, the buckets
+// contain the pool slot index of the first item in a chain
+typedef enum {
+    _SG_DEDUPKIND_BUFFER,
+    _SG_DEDUPKIND_IMAGE,
+    _SG_DEDUPKIND_NUM,
+} _sg_dedup_kind_t;
+
+typedef struct {
+    int num_buckets;    // a power of 2
+    int* buckets;
+} _sg_dedup_table_t;
+
+typedef struct {
+    _sg_dedup_table_t tables[_SG_DEDUPKIND_NUM];
+    sg_dedup_stats stats;
+} _sg_dedup_t;
+
+// placeholder images and stats for evictable images
+typedef struct {
+    sg_image placeholders[_SG_IMAGETYPE_NUM];
+    sg_residency_stats stats;
+} _sg_residency_t;
+
+// a growable byte array
+typedef struct {
+    uint8_t* ptr;
+    size_t size;
+    size_t capacity;
+} _sg_bytes_t;
+
+// last applied uniform data per shader stage and uniform block, for skipping redundant sg_apply_uniforms()
+typedef struct {
+    bool valid[SG_NUM_SHADER_STAGES][SG_MAX_SHADERSTAGE_UBS];
+    _sg_bytes_t data[SG_NUM_SHADER_STAGES][SG_MAX_SHADERSTAGE_UBS];
+} _sg_uniform_cache_t;
+
+// a held back draw which directly following draws may be merged into (sg_desc.coalesce_draws)
+typedef struct {
+    bool pending;
+    int base_element;
+    int num_elements;
+    int num_instances;
+    int prim_vertices;      // vertices per primitive of the current pipeline, 0 for strips
+    bool bindings_valid;
+    sg_bindings bindings;   // the bindings applied in the backend
+} _sg_draw_coalesce_t;
+
+enum {
+    _SG_MANIFEST_SHADER = 1,
+    _SG_MANIFEST_PIPELINE = 2,
+};
+
+// a recorded shader or pipeline
+typedef struct {
+    int kind;                   // _SG_MANIFEST_SHADER or _SG_MANIFEST_PIPELINE
+    uint64_t hash;              // hash of the encoded creation params
+    uint32_t first_use;         // frame index of first sg_apply_pipeline(), 0 if never used
+    size_t offset;              // encoded creation params in _sg.manifest.data
+    size_t size;
+} _sg_manifest_entry_t;
+
+typedef struct {
+    int num_entries;
+    int capacity;
+    _sg_manifest_entry_t* entries;
+    _sg_bytes_t data;
+    _sg_bytes_t scratch;
+} _sg_manifest_t;
+
+typedef enum {
+    _SG_PREWARM_PENDING,
+    _SG_PREWARM_CREATED,        // created by sg_prewarm(), not yet returned by sg_make_shader/pipeline()
+    _SG_PREWARM_CLAIMED,        // returned by sg_make_shader/pipeline(), or created outside sg_prewarm()
+    _SG_PREWARM_FAILED,
+} _sg_prewarm_state_t;
+
+typedef struct {
+    int kind;
+    _sg_prewarm_state_t state;
+    uint64_t hash;
+    uint64_t shader_hash;       // pipelines only: hash of the pipeline's shader
+    uint32_t first_use;
+    uint32_t res_id;            // the created (or claimed) shader or pipeline
+    const uint8_t* ptr;         // encoded creation params in _sg.prewarm.data
+    size_t size;
+} _sg_prewarm_entry_t;
+
+typedef struct {
+    bool started;
+    bool done;
+    bool in_prewarm;            // true while sg_prewarm() creates resources
+    int num_entries;
+    int cur;                    // next item in order[]
+    _sg_prewarm_entry_t* entries;
+    int* order;                 // entry indices sorted by first use
+    uint8_t* data;              // copy of the manifest data, freed when done
+    uint8_t* keys;              // encoded params of the unclaimed objects when done
+} _sg_prewarm_t;
+
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+// a resource initialization queued from a worker thread
+typedef struct {
+    uint32_t res_id;
+    bool is_image;
+    union {
+        sg_buffer_desc buf;
+        sg_image_desc img;
+    } desc;
+    void* data;     // copy of resource content and label referenced by desc
+} _sg_init_queue_item_t;
+
+typedef struct {
+    _sg_mutex_t mutex;
+    _sg_thread_id_t render_thread;  // the thread which called sg_setup()
+    int num;
+    int capacity;
+    _sg_init_queue_item_t* items;
+    int spare_capacity;
+    _sg_init_queue_item_t* spare;   // swapped with items in _sg_process_init_queue(), render thread only
+} _sg_init_queue_t;
+#endif
+
 // resolved resource bindings struct
 typedef struct {
     _sg_pipeline_t* pip;
@@ -5883,6 +7915,8 @@ typedef struct {
     _sg_image_t* fs_imgs[SG_MAX_SHADERSTAGE_IMAGES];
     _sg_sampler_t* fs_smps[SG_MAX_SHADERSTAGE_SAMPLERS];
     _sg_buffer_t* fs_sbufs[SG_MAX_SHADERSTAGE_STORAGEBUFFERS];
+    int num_simgs;  // compute-stage storage images
+    _sg_image_t* simgs[SG_MAX_SHADERSTAGE_STORAGEIMAGES];
 } _sg_bindings_t;
 
 typedef struct {
@@ -5894,6 +7928,17 @@ typedef struct {
     bool depth;
 } _sg_pixelformat_info_t;
 
+// per-frame fences, see sg_commit() and sg_query_frame_pacing()
+typedef struct {
+    bool pending[_SG_MAX_FRAME_FENCES];   // a fence has been inserted and not yet seen signalled
+    #if defined(SOKOL_DUMMY_BACKEND)
+    double dummy_signal_ms[_SG_MAX_FRAME_FENCES];    // time when the simulated GPU finishes the frame
+    #endif
+    double backend_wait_ms; // wait time measured inside the backend (Metal)
+    bool backend_waited;
+    sg_frame_pacing info;
+} _sg_frame_pacing_t;
+
 typedef struct {
     bool valid;
     sg_desc desc;       // original desc with default values patched in
@@ -5901,6 +7946,7 @@ typedef struct {
     struct {
         bool valid;
         bool in_pass;
+        bool is_compute;
         sg_attachments atts_id;     // SG_INVALID_ID in a swapchain pass
         _sg_attachments_t* atts;    // 0 in a swapchain pass
         int width;
@@ -5924,6 +7970,7 @@ typedef struct {
     bool stats_enabled;
     sg_frame_stats stats;
     sg_frame_stats prev_stats;
+    _sg_frame_pacing_t pacing;
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_backend_t gl;
     #elif defined(SOKOL_METAL)
@@ -5937,8 +7984,39 @@ typedef struct {
     sg_trace_hooks hooks;
     #endif
     _sg_commit_listeners_t commit_listeners;
+    _sg_transient_pool_t transient;
+    _sg_residency_t residency;
+    _sg_dedup_t dedup;
+    _sg_uniform_cache_t ub_cache;
+    _sg_draw_coalesce_t coalesce;
+    _sg_manifest_t manifest;
+    _sg_prewarm_t prewarm;
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_init_queue_t init_queue;
+    #endif
 } _sg_state_t;
-static _sg_state_t _sg;
+
+#if defined(SOKOL_THREADLOCAL_CONTEXT)
+#if defined(_MSC_VER)
+#define _SG_THREAD_LOCAL __declspec(thread)
+#else
+#define _SG_THREAD_LOCAL __thread
+#endif
+#else
+#define _SG_THREAD_LOCAL
+#endif
+static _sg_state_t _sg_default_state;
+static _SG_THREAD_LOCAL _sg_state_t* _sg_cur_state = &_sg_default_state;
+// all code accesses the state of the current context through _sg
+#define _sg (*_sg_cur_state)
+
+// slot 0 is the default context, slot index + 1 is stored in the lower id bits
+typedef struct {
+    uint32_t unique_counter;
+    uint32_t ids[_SG_MAX_CONTEXTS];
+    _sg_state_t* states[_SG_MAX_CONTEXTS];
+} _sg_contexts_t;
+static _sg_contexts_t _sg_contexts;
 
 // ██       ██████   ██████   ██████  ██ ███    ██  ██████
 // ██      ██    ██ ██       ██       ██ ████   ██ ██
@@ -6032,6 +8110,40 @@ _SOKOL_PRIVATE void _sg_free(void* ptr) {
     }
 }
 
+_SOKOL_PRIVATE int _sg_num_inflight_frames(void) {
+    return _sg.desc.num_inflight_frames;
+}
+
+_SOKOL_PRIVATE double _sg_time_ms(void) {
+    #if defined(_SG_WIN32_TIMER)
+        LARGE_INTEGER freq, count;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&count);
+        return ((double)count.QuadPart * 1000.0) / (double)freq.QuadPart;
+    #elif defined(_WIN32)
+        struct timespec ts;
+        timespec_get(&ts, TIME_UTC);
+        return ((double)ts.tv_sec * 1000.0) + ((double)ts.tv_nsec / 1000000.0);
+    #elif defined(__APPLE__)
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        return ((double)mach_absolute_time() * (double)timebase.numer) / ((double)timebase.denom * 1000000.0);
+    #elif defined(__EMSCRIPTEN__)
+        return emscripten_get_now();
+    #elif defined(CLOCK_MONOTONIC)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ((double)ts.tv_sec * 1000.0) + ((double)ts.tv_nsec / 1000000.0);
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        struct timespec ts;
+        timespec_get(&ts, TIME_UTC);
+        return ((double)ts.tv_sec * 1000.0) + ((double)ts.tv_nsec / 1000000.0);
+    #else
+        // last resort, processor time is better than nothing for a time budget
+        return ((double)clock() * 1000.0) / (double)CLOCKS_PER_SEC;
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_strempty(const _sg_str_t* str) {
     return 0 == str->buf[0];
 }
@@ -6258,6 +8370,31 @@ _SOKOL_PRIVATE bool _sg_is_depth_stencil_format(sg_pixel_format fmt) {
     return (SG_PIXELFORMAT_DEPTH_STENCIL == fmt);
 }
 
+// the pixel formats which can be written by compute shaders (GLSL image formats)
+_SOKOL_PRIVATE bool _sg_is_valid_storage_image_format(sg_pixel_format fmt) {
+    switch (fmt) {
+        case SG_PIXELFORMAT_RGBA8:
+        case SG_PIXELFORMAT_RGBA8SN:
+        case SG_PIXELFORMAT_RGBA8UI:
+        case SG_PIXELFORMAT_RGBA8SI:
+        case SG_PIXELFORMAT_RGBA16UI:
+        case SG_PIXELFORMAT_RGBA16SI:
+        case SG_PIXELFORMAT_RGBA16F:
+        case SG_PIXELFORMAT_R32UI:
+        case SG_PIXELFORMAT_R32SI:
+        case SG_PIXELFORMAT_R32F:
+        case SG_PIXELFORMAT_RG32UI:
+        case SG_PIXELFORMAT_RG32SI:
+        case SG_PIXELFORMAT_RG32F:
+        case SG_PIXELFORMAT_RGBA32UI:
+        case SG_PIXELFORMAT_RGBA32SI:
+        case SG_PIXELFORMAT_RGBA32F:
+            return true;
+        default:
+            return false;
+    }
+}
+
 _SOKOL_PRIVATE int _sg_pixelformat_bytesize(sg_pixel_format fmt) {
     switch (fmt) {
         case SG_PIXELFORMAT_R8:
@@ -6573,6 +8710,12 @@ _SOKOL_PRIVATE void _sg_dummy_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(desc);
     _SOKOL_UNUSED(desc);
     _sg.backend = SG_BACKEND_DUMMY;
+    _sg.features.image_readback = true;
+    _sg.features.storage_buffer = true;
+    _sg.features.compute = true;
+    _sg.features.copy_buffer = true;
+    _sg.features.copy_image = true;
+    _sg.features.mip_streaming = true;
     for (int i = SG_PIXELFORMAT_R8; i < SG_PIXELFORMAT_BC1_RGBA; i++) {
         _sg.formats[i].sample = true;
         _sg.formats[i].filter = true;
@@ -6724,6 +8867,28 @@ _SOKOL_PRIVATE void _sg_dummy_commit(void) {
     // empty
 }
 
+_SOKOL_PRIVATE void _sg_dummy_insert_frame_fence(int slot) {
+    SOKOL_ASSERT((slot >= 0) && (slot < _SG_MAX_FRAME_FENCES));
+    _sg.pacing.dummy_signal_ms[slot] = _sg_time_ms() + _sg.desc.dummy_gpu_latency_ms;
+}
+
+// the dummy backend doesn't actually block, a wait is only reported
+// as the remaining simulated GPU time
+_SOKOL_PRIVATE bool _sg_dummy_frame_fence_signaled(int slot, bool wait) {
+    SOKOL_ASSERT((slot >= 0) && (slot < _SG_MAX_FRAME_FENCES));
+    const double remaining_ms = _sg.pacing.dummy_signal_ms[slot] - _sg_time_ms();
+    if (remaining_ms <= 0.0) {
+        return true;
+    }
+    if (wait) {
+        _sg.pacing.backend_wait_ms += remaining_ms;
+        _sg.pacing.backend_waited = true;
+        _sg.pacing.dummy_signal_ms[slot] = 0.0;
+        return true;
+    }
+    return false;
+}
+
 _SOKOL_PRIVATE void _sg_dummy_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
     _SOKOL_UNUSED(x);
     _SOKOL_UNUSED(y);
@@ -6764,6 +8929,12 @@ _SOKOL_PRIVATE void _sg_dummy_draw(int base_element, int num_elements, int num_i
     _SOKOL_UNUSED(num_instances);
 }
 
+_SOKOL_PRIVATE void _sg_dummy_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    _SOKOL_UNUSED(num_groups_x);
+    _SOKOL_UNUSED(num_groups_y);
+    _SOKOL_UNUSED(num_groups_z);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(data);
@@ -6772,6 +8943,20 @@ _SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* d
     }
 }
 
+_SOKOL_PRIVATE void _sg_dummy_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (new_frame) {
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+        for (int i = 0; i < buf->cmn.dirty[buf->cmn.active_slot].num; i++) {
+            _sg_stats_add(size_sync_buffer_range, (uint32_t)buf->cmn.dirty[buf->cmn.active_slot].ranges[i].size);
+        }
+        buf->cmn.dirty[buf->cmn.active_slot].num = 0;
+    }
+    _sg_buffer_common_track_update(&buf->cmn, offset, data);
+}
+
 _SOKOL_PRIVATE bool _sg_dummy_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(data);
@@ -6791,6 +8976,51 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
+_SOKOL_PRIVATE void _sg_dummy_update_image_mip(_sg_image_t* img, int mip_index, const sg_image_data* data) {
+    SOKOL_ASSERT(img && data);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(mip_index);
+    _SOKOL_UNUSED(data);
+}
+
+// the dummy backend delivers zero-initialized pixel data right away
+_SOKOL_PRIVATE bool _sg_dummy_read_image_async(_sg_image_t* img, const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(img && desc && desc->callback);
+    const int num_bytes = _sg_surface_pitch(img->cmn.pixel_format, desc->width, desc->height, 1);
+    void* ptr = _sg_malloc_clear((size_t)num_bytes);
+    sg_image_readback info;
+    _sg_clear(&info, sizeof(info));
+    info.image.id = img->slot.id;
+    info.x = desc->x;
+    info.y = desc->y;
+    info.width = desc->width;
+    info.height = desc->height;
+    info.pixel_format = img->cmn.pixel_format;
+    info.data.ptr = ptr;
+    info.data.size = (size_t)num_bytes;
+    info.user_data = desc->user_data;
+    desc->callback(&info);
+    _sg_free(ptr);
+    _sg_stats_add(size_read_image_async, (uint32_t)num_bytes);
+    return true;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_copy_buffer(_sg_buffer_t* dst, int dst_offset, _sg_buffer_t* src, int src_offset, int size) {
+    SOKOL_ASSERT(dst && src && (size > 0));
+    _SOKOL_UNUSED(dst);
+    _SOKOL_UNUSED(dst_offset);
+    _SOKOL_UNUSED(src);
+    _SOKOL_UNUSED(src_offset);
+    _SOKOL_UNUSED(size);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_copy_image_region(_sg_image_t* dst, _sg_image_t* src, const sg_image_copy_desc* desc) {
+    SOKOL_ASSERT(dst && src && desc);
+    _SOKOL_UNUSED(dst);
+    _SOKOL_UNUSED(src);
+    _SOKOL_UNUSED(desc);
+}
+
 //  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
 // ██    ██ ██   ██ ██      ████   ██ ██       ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
 // ██    ██ ██████  █████   ██ ██  ██ ██   ███ ██          ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
@@ -6852,6 +9082,8 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     _SG_XMACRO(glFramebufferRenderbuffer,         void, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) \
     _SG_XMACRO(glCompressedTexImage2D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)) \
     _SG_XMACRO(glCompressedTexImage3D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)) \
+    _SG_XMACRO(glCompressedTexSubImage2D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)) \
+    _SG_XMACRO(glCompressedTexSubImage3D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)) \
     _SG_XMACRO(glActiveTexture,                   void, (GLenum texture)) \
     _SG_XMACRO(glTexSubImage3D,                   void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)) \
     _SG_XMACRO(glRenderbufferStorage,             void, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)) \
@@ -6913,16 +9145,35 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     _SG_XMACRO(glSamplerParameterf,               void, (GLuint sampler, GLenum pname, GLfloat param)) \
     _SG_XMACRO(glSamplerParameterfv,              void, (GLuint sampler, GLenum pname, const GLfloat* params)) \
     _SG_XMACRO(glDeleteSamplers,                  void, (GLsizei n, const GLuint* samplers)) \
-    _SG_XMACRO(glBindBufferBase,                  void, (GLenum target, GLuint index, GLuint buffer))
+    _SG_XMACRO(glBindBufferBase,                  void, (GLenum target, GLuint index, GLuint buffer)) \
+    _SG_XMACRO(glReadPixels,                      void, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* data)) \
+    _SG_XMACRO(glMapBufferRange,                  void*, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    _SG_XMACRO(glUnmapBuffer,                     GLboolean, (GLenum target)) \
+    _SG_XMACRO(glFenceSync,                       GLsync, (GLenum condition, GLbitfield flags)) \
+    _SG_XMACRO(glClientWaitSync,                  GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glDeleteSync,                      void, (GLsync sync)) \
+    _SG_XMACRO(glCopyBufferSubData,               void, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size))
+
+// optional GL functions, these may be null and must be checked before use
+#define _SG_GL_FUNCS_OPT \
+    _SG_XMACRO(glBindTextures,                    void, (GLuint first, GLsizei count, const GLuint* textures)) \
+    _SG_XMACRO(glBindSamplers,                    void, (GLuint first, GLsizei count, const GLuint* samplers)) \
+    _SG_XMACRO(glBindBuffersBase,                 void, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers)) \
+    _SG_XMACRO(glDispatchCompute,                 void, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)) \
+    _SG_XMACRO(glMemoryBarrier,                   void, (GLbitfield barriers)) \
+    _SG_XMACRO(glBindImageTexture,                void, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)) \
+    _SG_XMACRO(glCopyImageSubData,                void, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth))
 
 // generate GL function pointer typedefs
 #define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
 _SG_GL_FUNCS
+_SG_GL_FUNCS_OPT
 #undef _SG_XMACRO
 
 // generate GL function pointers
 #define _SG_XMACRO(name, ret, args) static PFN_ ## name name;
 _SG_GL_FUNCS
+_SG_GL_FUNCS_OPT
 #undef _SG_XMACRO
 
 // helper function to lookup GL functions in GL DLL
@@ -6936,6 +9187,15 @@ _SOKOL_PRIVATE void* _sg_gl_getprocaddr(const char* name, _sg_wglGetProcAddress
     return proc_addr;
 }
 
+// same as _sg_gl_getprocaddr(), but for optional functions which may not exist
+_SOKOL_PRIVATE void* _sg_gl_getprocaddr_opt(const char* name, _sg_wglGetProcAddress wgl_getprocaddress) {
+    void* proc_addr = (void*) wgl_getprocaddress(name);
+    if (0 == proc_addr) {
+        proc_addr = (void*) GetProcAddress(_sg.gl.opengl32_dll, name);
+    }
+    return proc_addr;
+}
+
 // populate GL function pointers
 _SOKOL_PRIVATE  void _sg_gl_load_opengl(void) {
     SOKOL_ASSERT(0 == _sg.gl.opengl32_dll);
@@ -6946,6 +9206,9 @@ _SOKOL_PRIVATE  void _sg_gl_load_opengl(void) {
     #define _SG_XMACRO(name, ret, args) name = (PFN_ ## name) _sg_gl_getprocaddr(#name, wgl_getprocaddress);
     _SG_GL_FUNCS
     #undef _SG_XMACRO
+    #define _SG_XMACRO(name, ret, args) name = (PFN_ ## name) _sg_gl_getprocaddr_opt(#name, wgl_getprocaddress);
+    _SG_GL_FUNCS_OPT
+    #undef _SG_XMACRO
 }
 
 _SOKOL_PRIVATE void _sg_gl_unload_opengl(void) {
@@ -6988,6 +9251,7 @@ _SOKOL_PRIVATE GLenum _sg_gl_shader_stage(sg_shader_stage stage) {
     switch (stage) {
         case SG_SHADERSTAGE_VS:     return GL_VERTEX_SHADER;
         case SG_SHADERSTAGE_FS:     return GL_FRAGMENT_SHADER;
+        case SG_SHADERSTAGE_CS:     return GL_COMPUTE_SHADER;
         default: SOKOL_UNREACHABLE; return 0;
     }
 }
@@ -7637,6 +9901,9 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
     _sg.features.mrt_independent_blend_state = false;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.storage_buffer = version >= 430;
+    _sg.features.image_readback = true;
+    _sg.features.copy_buffer = true;
+    _sg.features.mip_streaming = true;
 
     // scan extensions
     bool has_s3tc = false;  // BC1..BC3
@@ -7664,9 +9931,32 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
                 _sg.gl.ext_anisotropic = true;
             } else if (strstr(ext, "_texture_compression_astc_ldr")) {
                 has_astc = true;
+            } else if (strstr(ext, "_multi_bind")) {
+                _sg.gl.ext_multi_bind = true;
             }
         }
     }
+    #if defined(_SOKOL_GL_HAS_MULTI_BIND)
+        // multi-bind is core since GL 4.4
+        _sg.gl.ext_multi_bind |= (version >= 440);
+        #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+            _sg.gl.ext_multi_bind &= (0 != glBindTextures) && (0 != glBindSamplers) && (0 != glBindBuffersBase);
+        #endif
+    #else
+        _sg.gl.ext_multi_bind = false;
+    #endif
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+        _sg.features.compute = version >= 430;
+        #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+            _sg.features.compute &= (0 != glDispatchCompute) && (0 != glMemoryBarrier) && (0 != glBindImageTexture);
+        #endif
+    #endif
+    #if defined(_SOKOL_GL_HAS_COPY_IMAGE)
+        _sg.features.copy_image = version >= 430;
+        #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+            _sg.features.copy_image &= (0 != glCopyImageSubData);
+        #endif
+    #endif
 
     // limits
     _sg_gl_init_limits();
@@ -7710,6 +10000,14 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
     _sg.features.mrt_independent_blend_state = false;
     _sg.features.mrt_independent_write_mask = false;
     _sg.features.storage_buffer = false;
+    #if defined(__EMSCRIPTEN__)
+        // WebGL2 has no glMapBufferRange() to read back the pixel buffer
+        _sg.features.image_readback = false;
+    #else
+        _sg.features.image_readback = true;
+    #endif
+    _sg.features.copy_buffer = true;
+    _sg.features.mip_streaming = true;
 
     bool has_s3tc = false;  // BC1..BC3
     bool has_rgtc = false;  // BC4 and BC5
@@ -7914,26 +10212,163 @@ _SOKOL_PRIVATE void _sg_gl_cache_restore_buffer_binding(GLenum target) {
     }
 }
 
-// called when _sg_gl_discard_buffer()
-_SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
-    if (buf == _sg.gl.cache.vertex_buffer) {
-        _sg.gl.cache.vertex_buffer = 0;
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        _sg_stats_add(gl.num_bind_buffer, 1);
-    }
-    if (buf == _sg.gl.cache.index_buffer) {
-        _sg.gl.cache.index_buffer = 0;
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        _sg_stats_add(gl.num_bind_buffer, 1);
+_SOKOL_PRIVATE void _sg_gl_cache_bind_vertex_array(GLuint vao) {
+    if (_sg.gl.cache.cur_vao != vao) {
+        _sg.gl.cache.cur_vao = vao;
+        glBindVertexArray(vao);
+        _sg_stats_add(gl.num_bind_vertex_array, 1);
     }
-    if (buf == _sg.gl.cache.storage_buffer) {
-        _sg.gl.cache.storage_buffer = 0;
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
-        _sg_stats_add(gl.num_bind_buffer, 1);
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_init(const sg_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->gl_vao_cache_size >= 0));
+    SOKOL_ASSERT(0 == _sg.gl.vao_cache.items);
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    if (desc->gl_vao_cache_size > 0) {
+        c->num = desc->gl_vao_cache_size;
+        c->items = (_sg_gl_vao_cache_item_t*)_sg_malloc_clear((size_t)c->num * sizeof(_sg_gl_vao_cache_item_t));
+        c->num_buckets = 1;
+        while (c->num_buckets < (2 * c->num)) {
+            c->num_buckets *= 2;
+        }
+        c->buckets = (int*)_sg_malloc((size_t)c->num_buckets * sizeof(int));
+        for (int i = 0; i < c->num_buckets; i++) {
+            c->buckets[i] = -1;
+        }
+        for (int i = 0; i < c->num; i++) {
+            c->items[i].bucket_next = -1;
+            c->items[i].lru_prev = i - 1;
+            c->items[i].lru_next = (i + 1) < c->num ? (i + 1) : -1;
+        }
+        c->lru_head = 0;
+        c->lru_tail = c->num - 1;
     }
-    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
-        for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++) {
-            if (buf == _sg.gl.cache.stage_storage_buffers[stage][i]) {
+}
+
+_SOKOL_PRIVATE int _sg_gl_vao_cache_bucket(uint64_t hash) {
+    return (int)(hash & (uint64_t)(_sg.gl.vao_cache.num_buckets - 1));
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_lru_unlink(int item_index) {
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    _sg_gl_vao_cache_item_t* item = &c->items[item_index];
+    if (item->lru_prev >= 0) {
+        c->items[item->lru_prev].lru_next = item->lru_next;
+    } else {
+        c->lru_head = item->lru_next;
+    }
+    if (item->lru_next >= 0) {
+        c->items[item->lru_next].lru_prev = item->lru_prev;
+    } else {
+        c->lru_tail = item->lru_prev;
+    }
+    item->lru_prev = item->lru_next = -1;
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_lru_push_front(int item_index) {
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    _sg_gl_vao_cache_item_t* item = &c->items[item_index];
+    item->lru_prev = -1;
+    item->lru_next = c->lru_head;
+    if (c->lru_head >= 0) {
+        c->items[c->lru_head].lru_prev = item_index;
+    } else {
+        c->lru_tail = item_index;
+    }
+    c->lru_head = item_index;
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_lru_push_back(int item_index) {
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    _sg_gl_vao_cache_item_t* item = &c->items[item_index];
+    item->lru_next = -1;
+    item->lru_prev = c->lru_tail;
+    if (c->lru_tail >= 0) {
+        c->items[c->lru_tail].lru_next = item_index;
+    } else {
+        c->lru_head = item_index;
+    }
+    c->lru_tail = item_index;
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_evict(int item_index) {
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    _sg_gl_vao_cache_item_t* item = &c->items[item_index];
+    SOKOL_ASSERT(item->vao);
+    // remove from the hash bucket chain
+    int* link = &c->buckets[_sg_gl_vao_cache_bucket(item->key.hash)];
+    while (*link != item_index) {
+        SOKOL_ASSERT(*link >= 0);
+        link = &c->items[*link].bucket_next;
+    }
+    *link = item->bucket_next;
+    item->bucket_next = -1;
+    if (item->vao == _sg.gl.cache.cur_vao) {
+        // fall back to the default VAO, and since the element array buffer
+        // binding is VAO state, also reset the cached index buffer binding
+        _sg_gl_cache_bind_vertex_array(_sg.gl.vao);
+        _sg.gl.cache.index_buffer = 0;
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
+    glDeleteVertexArrays(1, &item->vao);
+    _sg_stats_add(gl.num_vao_cache_evictions, 1);
+    item->vao = 0;
+    _sg_clear(&item->key, sizeof(item->key));
+    // unused items go to the end of the LRU list
+    _sg_gl_vao_cache_lru_unlink(item_index);
+    _sg_gl_vao_cache_lru_push_back(item_index);
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_discard(void) {
+    for (int i = 0; i < _sg.gl.vao_cache.num; i++) {
+        if (_sg.gl.vao_cache.items[i].vao) {
+            glDeleteVertexArrays(1, &_sg.gl.vao_cache.items[i].vao);
+        }
+    }
+    _sg_free(_sg.gl.vao_cache.items);
+    _sg_free(_sg.gl.vao_cache.buckets);
+    _sg_clear(&_sg.gl.vao_cache, sizeof(_sg.gl.vao_cache));
+}
+
+// evict all cached VAOs which reference a GL buffer
+_SOKOL_PRIVATE void _sg_gl_vao_cache_invalidate_buffer(GLuint buf) {
+    for (int item_index = 0; item_index < _sg.gl.vao_cache.num; item_index++) {
+        _sg_gl_vao_cache_item_t* item = &_sg.gl.vao_cache.items[item_index];
+        if (0 == item->vao) {
+            continue;
+        }
+        bool referenced = (item->key.items[0] == buf);
+        for (int attr_index = 0; !referenced && (attr_index < SG_MAX_VERTEX_ATTRIBUTES); attr_index++) {
+            referenced = (item->key.items[1 + _SG_GL_VAOCACHE_ATTR_ITEMS * attr_index] == buf);
+        }
+        if (referenced) {
+            _sg_gl_vao_cache_evict(item_index);
+        }
+    }
+}
+
+// called when _sg_gl_discard_buffer()
+_SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
+    _sg_gl_vao_cache_invalidate_buffer(buf);
+    if (buf == _sg.gl.cache.vertex_buffer) {
+        _sg.gl.cache.vertex_buffer = 0;
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
+    if (buf == _sg.gl.cache.index_buffer) {
+        _sg.gl.cache.index_buffer = 0;
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
+    if (buf == _sg.gl.cache.storage_buffer) {
+        _sg.gl.cache.storage_buffer = 0;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
+    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
+        for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++) {
+            if (buf == _sg.gl.cache.stage_storage_buffers[stage][i]) {
                 _sg.gl.cache.stage_storage_buffers[stage][i] = 0;
                 _sg.gl.cache.storage_buffer = 0; // not a bug!
                 const GLuint bind_index = _sg_gl_storagebuffer_bind_index(stage, i);
@@ -8045,6 +10480,85 @@ _SOKOL_PRIVATE void _sg_gl_cache_restore_texture_sampler_binding(int slot_index)
     }
 }
 
+/*
+    Multi-bind variants of _sg_gl_cache_bind_texture_sampler() and
+    _sg_gl_cache_bind_storage_buffer(): the state cache is updated right away,
+    but the GL calls are deferred and the dirty slot range is bound with a
+    single glBindTextures() + glBindSamplers() or glBindBuffersBase() call in
+    _sg_gl_cache_flush_multi_bind(). Unchanged slots inside the dirty range are
+    simply bound again from the state cache. Only used when _sg.gl.ext_multi_bind
+    is true.
+*/
+_SOKOL_PRIVATE void _sg_gl_cache_reset_multi_bind(void) {
+    _sg.gl.cache.multi_bind.first_texture_sampler = _SG_GL_TEXTURE_SAMPLER_CACHE_SIZE;
+    _sg.gl.cache.multi_bind.last_texture_sampler = -1;
+    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
+        _sg.gl.cache.multi_bind.first_storage_buffer[stage] = SG_MAX_SHADERSTAGE_STORAGEBUFFERS;
+        _sg.gl.cache.multi_bind.last_storage_buffer[stage] = -1;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_cache_multi_bind_texture_sampler(int slot_index, GLenum target, GLuint texture, GLuint sampler) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _SG_GL_TEXTURE_SAMPLER_CACHE_SIZE));
+    if (slot_index >= _sg.limits.gl_max_combined_texture_image_units) {
+        return;
+    }
+    _sg_gl_cache_texture_sampler_bind_slot* slot = &_sg.gl.cache.texture_samplers[slot_index];
+    if ((slot->target != target) || (slot->texture != texture) || (slot->sampler != sampler)) {
+        slot->target = target;
+        slot->texture = texture;
+        slot->sampler = sampler;
+        _sg.gl.cache.multi_bind.first_texture_sampler = _sg_min(_sg.gl.cache.multi_bind.first_texture_sampler, slot_index);
+        _sg.gl.cache.multi_bind.last_texture_sampler = _sg_max(_sg.gl.cache.multi_bind.last_texture_sampler, slot_index);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_cache_multi_bind_storage_buffer(int stage, int slot, GLuint buffer) {
+    SOKOL_ASSERT((stage >= 0) && (stage < SG_NUM_SHADER_STAGES));
+    SOKOL_ASSERT((slot >= 0) && (slot < SG_MAX_SHADERSTAGE_STORAGEBUFFERS));
+    if (_sg.gl.cache.stage_storage_buffers[stage][slot] != buffer) {
+        _sg.gl.cache.stage_storage_buffers[stage][slot] = buffer;
+        _sg.gl.cache.multi_bind.first_storage_buffer[stage] = _sg_min(_sg.gl.cache.multi_bind.first_storage_buffer[stage], slot);
+        _sg.gl.cache.multi_bind.last_storage_buffer[stage] = _sg_max(_sg.gl.cache.multi_bind.last_storage_buffer[stage], slot);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_cache_flush_multi_bind(void) {
+    #if defined(_SOKOL_GL_HAS_MULTI_BIND)
+    _SG_GL_CHECK_ERROR();
+    const int first_ts = _sg.gl.cache.multi_bind.first_texture_sampler;
+    const int last_ts = _sg.gl.cache.multi_bind.last_texture_sampler;
+    if (first_ts <= last_ts) {
+        GLuint textures[_SG_GL_TEXTURE_SAMPLER_CACHE_SIZE];
+        GLuint samplers[_SG_GL_TEXTURE_SAMPLER_CACHE_SIZE];
+        const int count = last_ts - first_ts + 1;
+        for (int i = 0; i < count; i++) {
+            const _sg_gl_cache_texture_sampler_bind_slot* slot = &_sg.gl.cache.texture_samplers[first_ts + i];
+            textures[i] = slot->texture;
+            samplers[i] = slot->sampler;
+        }
+        glBindTextures((GLuint)first_ts, count, textures);
+        _SG_GL_CHECK_ERROR();
+        _sg_stats_add(gl.num_multi_bind_textures, 1);
+        glBindSamplers((GLuint)first_ts, count, samplers);
+        _SG_GL_CHECK_ERROR();
+        _sg_stats_add(gl.num_multi_bind_samplers, 1);
+    }
+    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
+        const int first_sb = _sg.gl.cache.multi_bind.first_storage_buffer[stage];
+        const int last_sb = _sg.gl.cache.multi_bind.last_storage_buffer[stage];
+        if ((first_sb <= last_sb) && _sg.features.storage_buffer) {
+            // NOTE: unlike glBindBufferBase(), glBindBuffersBase() doesn't affect the generic binding point
+            const GLuint first_bind_index = _sg_gl_storagebuffer_bind_index(stage, first_sb);
+            glBindBuffersBase(GL_SHADER_STORAGE_BUFFER, first_bind_index, last_sb - first_sb + 1, &_sg.gl.cache.stage_storage_buffers[stage][first_sb]);
+            _SG_GL_CHECK_ERROR();
+            _sg_stats_add(gl.num_multi_bind_buffers, 1);
+        }
+    }
+    #endif
+    _sg_gl_cache_reset_multi_bind();
+}
+
 // called from _sg_gl_discard_texture() and _sg_gl_discard_sampler()
 _SOKOL_PRIVATE void _sg_gl_cache_invalidate_texture_sampler(GLuint tex, GLuint smp) {
     _SG_GL_CHECK_ERROR();
@@ -8092,6 +10606,8 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
     _sg_clear(&_sg.gl.cache, sizeof(_sg.gl.cache));
+    _sg.gl.cache.cur_vao = _sg.gl.vao;
+    _sg_gl_cache_reset_multi_bind();
     _sg_gl_cache_clear_buffer_bindings(true);
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_clear_texture_sampler_bindings(true);
@@ -8167,11 +10683,184 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
     #endif
 }
 
-_SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
+//-- GL texture upload staging ring buffer -------------------------------------
+_SOKOL_PRIVATE void _sg_gl_staging_init(const sg_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->gl_staging_buffer_size >= 0));
+    SOKOL_ASSERT(0 == _sg.gl.staging.pbo);
+    // NOTE: on WebGL2, glMapBufferRange() is emulated, which defeats the purpose
+    #if !defined(__EMSCRIPTEN__)
+    if (desc->gl_staging_buffer_size > 0) {
+        _sg.gl.staging.size = _sg_roundup(desc->gl_staging_buffer_size, _SG_GL_STAGING_ALIGN);
+        glGenBuffers(1, &_sg.gl.staging.pbo);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _sg.gl.staging.pbo);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, _sg.gl.staging.size, 0, GL_STREAM_DRAW);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        _SG_GL_CHECK_ERROR();
+    }
+    #else
     _SOKOL_UNUSED(desc);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_staging_discard(void) {
+    for (int i = 0; i < _SG_GL_STAGING_MAX_FENCES; i++) {
+        if (_sg.gl.staging.fences[i].fence) {
+            glDeleteSync(_sg.gl.staging.fences[i].fence);
+        }
+    }
+    if (_sg.gl.staging.pbo) {
+        glDeleteBuffers(1, &_sg.gl.staging.pbo);
+    }
+    _sg_clear(&_sg.gl.staging, sizeof(_sg.gl.staging));
+}
+
+// release staging space of finished uploads, if wait is true, block until the oldest fence is signalled
+_SOKOL_PRIVATE void _sg_gl_staging_retire(bool wait) {
+    while (_sg.gl.staging.num_fences > 0) {
+        _sg_gl_staging_fence_t* f = &_sg.gl.staging.fences[_sg.gl.staging.fence_tail];
+        SOKOL_ASSERT(f->fence);
+        GLenum wait_res = glClientWaitSync(f->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (wait_res == GL_TIMEOUT_EXPIRED) {
+            if (!wait) {
+                break;
+            }
+            _sg_stats_add(gl.num_staging_stalls, 1);
+            do {
+                wait_res = glClientWaitSync(f->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (wait_res == GL_TIMEOUT_EXPIRED);
+        }
+        // NOTE: on GL_WAIT_FAILED the staging space is reused anyway, this may cause rendering
+        // artefacts but is better than blocking forever
+        glDeleteSync(f->fence);
+        _sg.gl.staging.tail = f->pos;
+        _sg_clear(f, sizeof(_sg_gl_staging_fence_t));
+        _sg.gl.staging.fence_tail = (_sg.gl.staging.fence_tail + 1) % _SG_GL_STAGING_MAX_FENCES;
+        _sg.gl.staging.num_fences--;
+        wait = false;
+    }
+}
+
+// insert a fence after all staging buffer writes so far (called from sg_commit() or when the ring is full)
+_SOKOL_PRIVATE void _sg_gl_staging_push_fence(void) {
+    if (_sg.gl.staging.head == _sg.gl.staging.fenced) {
+        return;
+    }
+    if (_sg.gl.staging.num_fences == _SG_GL_STAGING_MAX_FENCES) {
+        _sg_gl_staging_retire(true);
+    }
+    _sg_gl_staging_fence_t* f = &_sg.gl.staging.fences[_sg.gl.staging.fence_head];
+    SOKOL_ASSERT(0 == f->fence);
+    f->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    f->pos = _sg.gl.staging.head;
+    _sg.gl.staging.fenced = _sg.gl.staging.head;
+    _sg.gl.staging.fence_head = (_sg.gl.staging.fence_head + 1) % _SG_GL_STAGING_MAX_FENCES;
+    _sg.gl.staging.num_fences++;
+}
+
+// allocate contiguous staging space, may block until the GPU has finished with older uploads
+_SOKOL_PRIVATE bool _sg_gl_staging_alloc(size_t num_bytes, GLintptr* out_offset) {
+    SOKOL_ASSERT(out_offset);
+    if ((0 == _sg.gl.staging.pbo) || (0 == num_bytes) || (num_bytes > (size_t)_sg.gl.staging.size)) {
+        return false;
+    }
+    const uint64_t size = (uint64_t)_sg.gl.staging.size;
+    _sg_gl_staging_retire(false);
+    uint64_t pad = 0;
+    while (true) {
+        const uint64_t offset = _sg.gl.staging.head % size;
+        if ((_sg.gl.staging.head == _sg.gl.staging.tail) && (offset != 0)) {
+            // staging buffer is idle, restart at the start of the buffer
+            _sg.gl.staging.head += size - offset;
+            _sg.gl.staging.tail = _sg.gl.staging.fenced = _sg.gl.staging.head;
+            continue;
+        }
+        pad = ((offset + (uint64_t)num_bytes) > size) ? (size - offset) : 0;
+        if ((_sg.gl.staging.head + pad + (uint64_t)num_bytes - _sg.gl.staging.tail) <= size) {
+            break;
+        }
+        // not enough free space, need to wait for the GPU
+        _sg_gl_staging_push_fence();
+        _sg_gl_staging_retire(true);
+    }
+    _sg.gl.staging.head += pad;
+    *out_offset = (GLintptr)(_sg.gl.staging.head % size);
+    _sg.gl.staging.head += (uint64_t)num_bytes;
+    return true;
+}
+
+/*
+    Copy texture data into the staging buffer. On success, the staging
+    buffer is bound to GL_PIXEL_UNPACK_BUFFER and the data 'pointers' for
+    the glTex*Image*() calls are written to out_ptrs[face][mip] (these are
+    actually offsets into the staging buffer). The caller must call
+    _sg_gl_staging_end() after issuing the glTex*Image*() calls.
+*/
+_SOKOL_PRIVATE bool _sg_gl_staging_begin(const sg_image_data* data, int num_faces, int num_mips, const GLvoid* out_ptrs[SG_CUBEFACE_NUM][SG_MAX_MIPMAPS]) {
+    SOKOL_ASSERT(data && (num_faces <= SG_CUBEFACE_NUM) && (num_mips <= SG_MAX_MIPMAPS));
+    if (0 == _sg.gl.staging.pbo) {
+        return false;
+    }
+    // NOTE: accumulated as size_t, the sum of all subimages may not fit into an int
+    size_t num_bytes = 0;
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
+            const sg_range* sub = &data->subimage[face_index][mip_index];
+            if ((0 == sub->ptr) || (0 == sub->size)) {
+                return false;
+            }
+            num_bytes += (size_t)_sg_roundup_u64((uint64_t)sub->size, _SG_GL_STAGING_ALIGN);
+        }
+    }
+    GLintptr offset = 0;
+    if (!_sg_gl_staging_alloc(num_bytes, &offset)) {
+        return false;
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _sg.gl.staging.pbo);
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    uint8_t* dst = (uint8_t*) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, (GLsizeiptr)num_bytes, access);
+    if (0 == dst) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        _SG_GL_CHECK_ERROR();
+        return false;
+    }
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
+            const sg_range* sub = &data->subimage[face_index][mip_index];
+            memcpy(dst, sub->ptr, sub->size);
+            out_ptrs[face_index][mip_index] = (const GLvoid*)offset;
+            const size_t aligned_size = (size_t)_sg_roundup_u64((uint64_t)sub->size, _SG_GL_STAGING_ALIGN);
+            dst += aligned_size;
+            offset += (GLintptr)aligned_size;
+        }
+    }
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    _SG_GL_CHECK_ERROR();
+    _sg_stats_add(gl.num_staging_uploads, 1);
+    _sg_stats_add(gl.size_staging, (uint32_t)num_bytes);
+    return true;
+}
+
+_SOKOL_PRIVATE void _sg_gl_staging_end(void) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+_SOKOL_PRIVATE size_t _sg_gl_image_data_size(const sg_image_data* data, int num_faces, int num_mips) {
+    size_t num_bytes = 0;
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
+            num_bytes += data->subimage[face_index][mip_index].size;
+        }
+    }
+    return num_bytes;
+}
+
+_SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->readback_pool_size > 0));
 
     // assumes that _sg.gl is already zero-initialized
     _sg.gl.valid = true;
+    _sg.gl.readback.num_slots = desc->readback_pool_size;
+    _sg.gl.readback.slots = (_sg_gl_readback_t*)_sg_malloc_clear((size_t)desc->readback_pool_size * sizeof(_sg_gl_readback_t));
 
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
     _sg_gl_load_opengl();
@@ -8190,8 +10879,12 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
     glGenVertexArrays(1, &_sg.gl.vao);
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
-    // incoming texture data is generally expected to be packed tightly
+    _sg_gl_vao_cache_init(desc);
+    _sg_gl_staging_init(desc);
+    // incoming texture data is generally expected to be packed tightly,
+    // and image readback data is delivered tightly packed
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
     #if defined(SOKOL_GLCORE)
         // enable seamless cubemap sampling (only desktop GL)
         glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
@@ -8201,9 +10894,32 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
 
 _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
     SOKOL_ASSERT(_sg.gl.valid);
+    _sg_gl_vao_cache_discard();
+    _sg_gl_staging_discard();
+    for (int i = 0; i < _SG_MAX_FRAME_FENCES; i++) {
+        if (_sg.gl.frame_fences[i]) {
+            glDeleteSync(_sg.gl.frame_fences[i]);
+            _sg.gl.frame_fences[i] = 0;
+        }
+    }
     if (_sg.gl.vao) {
         glDeleteVertexArrays(1, &_sg.gl.vao);
     }
+    // pending readbacks are dropped
+    for (int i = 0; i < _sg.gl.readback.num_slots; i++) {
+        _sg_gl_readback_t* rb = &_sg.gl.readback.slots[i];
+        if (rb->fence) {
+            glDeleteSync(rb->fence);
+        }
+        if (rb->pbo) {
+            glDeleteBuffers(1, &rb->pbo);
+        }
+    }
+    if (_sg.gl.readback.fb) {
+        glDeleteFramebuffers(1, &_sg.gl.readback.fb);
+    }
+    _sg_free(_sg.gl.readback.slots);
+    _sg.gl.readback.slots = 0;
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
     _sg_gl_unload_opengl();
     #endif
@@ -8305,7 +11021,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
             // should be rewritten to use glTexStorage + glTexSubImage
             bool tex_storage_allocated = false;
             #if defined(__EMSCRIPTEN__)
-                if (desc->data.subimage[0][0].ptr == 0) {
+                if ((desc->data.subimage[0][0].ptr == 0) && (img->cmn.base_mip_level == 0)) {
                     tex_storage_allocated = true;
                     if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
                         glTexStorage2D(img->gl.target, img->cmn.num_mipmaps, gl_internal_format, img->cmn.width, img->cmn.height);
@@ -8316,6 +11032,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
             #endif
             if (!tex_storage_allocated) {
                 const int num_faces = img->cmn.type == SG_IMAGETYPE_CUBE ? 6 : 1;
+                // large immutable images are uploaded through the staging buffer
+                const GLvoid* staged_ptrs[SG_CUBEFACE_NUM][SG_MAX_MIPMAPS];
+                bool staged = false;
+                if ((img->cmn.usage == SG_USAGE_IMMUTABLE) && (_sg_gl_image_data_size(&desc->data, num_faces, img->cmn.num_mipmaps) >= (size_t)_SG_GL_STAGING_MIN_IMMUTABLE_SIZE)) {
+                    staged = _sg_gl_staging_begin(&desc->data, num_faces, img->cmn.num_mipmaps, staged_ptrs);
+                }
                 int data_index = 0;
                 for (int face_index = 0; face_index < num_faces; face_index++) {
                     for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++, data_index++) {
@@ -8323,12 +11045,17 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
                         if (SG_IMAGETYPE_CUBE == img->cmn.type) {
                             gl_img_target = _sg_gl_cubeface_target(face_index);
                         }
-                        const GLvoid* data_ptr = desc->data.subimage[face_index][mip_index].ptr;
+                        const GLvoid* data_ptr = staged ? staged_ptrs[face_index][mip_index] : desc->data.subimage[face_index][mip_index].ptr;
                         const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
                         const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+                        // non-resident mipmaps of streamed images are allocated without data,
+                        // but compressed formats still need the exact data size
+                        const bool resident = 0 != (img->cmn.resident_mips & (1u << mip_index));
                         if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
                             if (is_compressed) {
-                                const GLsizei data_size = (GLsizei) desc->data.subimage[face_index][mip_index].size;
+                                const GLsizei data_size = resident
+                                    ? (GLsizei) desc->data.subimage[face_index][mip_index].size
+                                    : (GLsizei) _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
                                 glCompressedTexImage2D(gl_img_target, mip_index, gl_internal_format,
                                     mip_width, mip_height, 0, data_size, data_ptr);
                             } else {
@@ -8342,7 +11069,9 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
                                 mip_depth = _sg_miplevel_dim(mip_depth, mip_index);
                             }
                             if (is_compressed) {
-                                const GLsizei data_size = (GLsizei) desc->data.subimage[face_index][mip_index].size;
+                                const GLsizei data_size = resident
+                                    ? (GLsizei) desc->data.subimage[face_index][mip_index].size
+                                    : (GLsizei) (_sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1) * mip_depth);
                                 glCompressedTexImage3D(gl_img_target, mip_index, gl_internal_format,
                                     mip_width, mip_height, mip_depth, 0, data_size, data_ptr);
                             } else {
@@ -8353,6 +11082,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
                         }
                     }
                 }
+                if (staged) {
+                    _sg_gl_staging_end();
+                }
+            }
+            if (img->cmn.base_mip_level > 0) {
+                glTexParameteri(img->gl.target, GL_TEXTURE_BASE_LEVEL, img->cmn.base_mip_level);
             }
             _sg_gl_cache_restore_texture_sampler_binding(0);
         }
@@ -8479,17 +11214,29 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
         _sg_strcpy(&shd->gl.attrs[i].name, desc->attrs[i].name);
     }
 
-    GLuint gl_vs = _sg_gl_compile_shader(SG_SHADERSTAGE_VS, desc->vs.source);
-    GLuint gl_fs = _sg_gl_compile_shader(SG_SHADERSTAGE_FS, desc->fs.source);
-    if (!(gl_vs && gl_fs)) {
-        return SG_RESOURCESTATE_FAILED;
+    GLuint gl_prog = 0;
+    if (shd->cmn.is_compute) {
+        GLuint gl_cs = _sg_gl_compile_shader(SG_SHADERSTAGE_CS, desc->cs.source);
+        if (!gl_cs) {
+            return SG_RESOURCESTATE_FAILED;
+        }
+        gl_prog = glCreateProgram();
+        glAttachShader(gl_prog, gl_cs);
+        glLinkProgram(gl_prog);
+        glDeleteShader(gl_cs);
+    } else {
+        GLuint gl_vs = _sg_gl_compile_shader(SG_SHADERSTAGE_VS, desc->vs.source);
+        GLuint gl_fs = _sg_gl_compile_shader(SG_SHADERSTAGE_FS, desc->fs.source);
+        if (!(gl_vs && gl_fs)) {
+            return SG_RESOURCESTATE_FAILED;
+        }
+        gl_prog = glCreateProgram();
+        glAttachShader(gl_prog, gl_vs);
+        glAttachShader(gl_prog, gl_fs);
+        glLinkProgram(gl_prog);
+        glDeleteShader(gl_vs);
+        glDeleteShader(gl_fs);
     }
-    GLuint gl_prog = glCreateProgram();
-    glAttachShader(gl_prog, gl_vs);
-    glAttachShader(gl_prog, gl_fs);
-    glLinkProgram(gl_prog);
-    glDeleteShader(gl_vs);
-    glDeleteShader(gl_fs);
     _SG_GL_CHECK_ERROR();
 
     GLint link_status;
@@ -8512,7 +11259,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
     // resolve uniforms
     _SG_GL_CHECK_ERROR();
     for (int stage_index = 0; stage_index < SG_NUM_SHADER_STAGES; stage_index++) {
-        const sg_shader_stage_desc* stage_desc = (stage_index == SG_SHADERSTAGE_VS)? &desc->vs : &desc->fs;
+        const sg_shader_stage_desc* stage_desc = _sg_shader_desc_stage(desc, stage_index);
         const _sg_shader_stage_t* stage = &shd->cmn.stage[stage_index];
         _sg_gl_shader_stage_t* gl_stage = &shd->gl.stage[stage_index];
         for (int ub_index = 0; ub_index < stage->num_uniform_blocks; ub_index++) {
@@ -8556,7 +11303,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
     glUseProgram(gl_prog);
     int gl_tex_slot = 0;
     for (int stage_index = 0; stage_index < SG_NUM_SHADER_STAGES; stage_index++) {
-        const sg_shader_stage_desc* stage_desc = (stage_index == SG_SHADERSTAGE_VS)? &desc->vs : &desc->fs;
+        const sg_shader_stage_desc* stage_desc = _sg_shader_desc_stage(desc, stage_index);
         const _sg_shader_stage_t* stage = &shd->cmn.stage[stage_index];
         _sg_gl_shader_stage_t* gl_stage = &shd->gl.stage[stage_index];
         for (int img_smp_index = 0; img_smp_index < stage->num_image_samplers; img_smp_index++) {
@@ -9034,6 +11781,18 @@ _SOKOL_PRIVATE void _sg_gl_end_pass(void) {
     _SG_GL_CHECK_ERROR();
 }
 
+_SOKOL_PRIVATE void _sg_gl_end_compute_pass(void) {
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    // make the results of the compute pass visible to all following GPU operations
+    if (_sg.gl.compute_barrier_pending) {
+        _sg.gl.compute_barrier_pending = false;
+        glMemoryBarrier(GL_ALL_BARRIER_BITS);
+        _sg_stats_add(gl.num_memory_barrier, 1);
+    }
+    #endif
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE void _sg_gl_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
     y = origin_top_left ? (_sg.cur_pass.height - (y+h)) : y;
     glViewport(x, y, w, h);
@@ -9048,6 +11807,18 @@ _SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
     SOKOL_ASSERT(pip->shader && (pip->cmn.shader_id.id == pip->shader->slot.id));
     _SG_GL_CHECK_ERROR();
+    if (pip->cmn.is_compute) {
+        // compute pipelines don't have render state, only the shader program
+        _sg.gl.cache.cur_pipeline = pip;
+        _sg.gl.cache.cur_pipeline_id.id = pip->slot.id;
+        if (pip->shader->gl.prog != _sg.gl.cache.prog) {
+            _sg.gl.cache.prog = pip->shader->gl.prog;
+            glUseProgram(pip->shader->gl.prog);
+            _sg_stats_add(gl.num_use_program, 1);
+        }
+        _SG_GL_CHECK_ERROR();
+        return;
+    }
     if ((_sg.gl.cache.cur_pipeline != pip) || (_sg.gl.cache.cur_pipeline_id.id != pip->slot.id)) {
         _sg.gl.cache.cur_pipeline = pip;
         _sg.gl.cache.cur_pipeline_id.id = pip->slot.id;
@@ -9269,6 +12040,109 @@ _SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
     _SG_GL_CHECK_ERROR();
 }
 
+_SOKOL_PRIVATE uint64_t _sg_gl_vao_cache_hash(const uint32_t* items, int num_items) {
+    // FNV-1a over 32-bit items
+    uint64_t hash = 0xcbf29ce484222325;
+    for (int i = 0; i < num_items; i++) {
+        hash ^= items[i];
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_init_key(_sg_gl_vao_cache_key_t* key, const _sg_bindings_t* bnd, GLuint gl_ib) {
+    _sg_clear(key, sizeof(_sg_gl_vao_cache_key_t));
+    key->items[0] = gl_ib;
+    for (int attr_index = 0; attr_index < _sg.limits.max_vertex_attrs; attr_index++) {
+        const _sg_gl_attr_t* attr = &bnd->pip->gl.attrs[attr_index];
+        if (attr->vb_index >= 0) {
+            SOKOL_ASSERT(attr->vb_index < bnd->num_vbs);
+            const _sg_buffer_t* vb = bnd->vbs[attr->vb_index];
+            SOKOL_ASSERT(vb);
+            // NOTE: each attribute property gets its own key item, so that the
+            // key doesn't depend on the value ranges of the individual properties
+            uint32_t* items = &key->items[1 + _SG_GL_VAOCACHE_ATTR_ITEMS * attr_index];
+            items[0] = vb->gl.buf[vb->cmn.active_slot];
+            items[1] = (uint32_t)(bnd->vb_offsets[attr->vb_index] + attr->offset);
+            items[2] = (uint32_t)attr->stride;
+            items[3] = (uint32_t)attr->divisor;
+            // the high bit marks the attribute as enabled
+            items[4] = 0x80000000 | ((uint32_t)attr->size << 8) | (uint32_t)attr->normalized;
+            items[5] = attr->type;
+        }
+    }
+    key->hash = _sg_gl_vao_cache_hash(key->items, _SG_GL_VAOCACHE_NUM_ITEMS);
+}
+
+// returns item index, or -1
+_SOKOL_PRIVATE int _sg_gl_vao_cache_lookup(const _sg_gl_vao_cache_key_t* key) {
+    const _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    for (int i = c->buckets[_sg_gl_vao_cache_bucket(key->hash)]; i >= 0; i = c->items[i].bucket_next) {
+        const _sg_gl_vao_cache_item_t* item = &c->items[i];
+        SOKOL_ASSERT(item->vao != 0);
+        if ((item->key.hash == key->hash) && (0 == memcmp(item->key.items, key->items, sizeof(key->items)))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// returns the index of a free cache item, evicts the least recently used item if necessary
+_SOKOL_PRIVATE int _sg_gl_vao_cache_alloc(void) {
+    const int item_index = _sg.gl.vao_cache.lru_tail;
+    SOKOL_ASSERT(item_index >= 0);
+    if (_sg.gl.vao_cache.items[item_index].vao) {
+        _sg_gl_vao_cache_evict(item_index);
+    }
+    return item_index;
+}
+
+_SOKOL_PRIVATE void _sg_gl_apply_cached_vertex_array(const _sg_bindings_t* bnd, GLuint gl_ib) {
+    _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    _sg_gl_vao_cache_key_t key;
+    _sg_gl_vao_cache_init_key(&key, bnd, gl_ib);
+    int item_index = _sg_gl_vao_cache_lookup(&key);
+    _sg_gl_vao_cache_item_t* item = 0;
+    if (item_index >= 0) {
+        item = &c->items[item_index];
+        _sg_stats_add(gl.num_vao_cache_hits, 1);
+        if (item->vao != _sg.gl.cache.cur_vao) {
+            _sg_gl_cache_bind_vertex_array(item->vao);
+            // the element array buffer binding is part of the VAO state
+            _sg.gl.cache.index_buffer = gl_ib;
+        }
+    } else {
+        _sg_stats_add(gl.num_vao_cache_misses, 1);
+        item_index = _sg_gl_vao_cache_alloc();
+        item = &c->items[item_index];
+        glGenVertexArrays(1, &item->vao);
+        _sg_gl_cache_bind_vertex_array(item->vao);
+        _sg.gl.cache.index_buffer = 0;
+        _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
+        for (GLuint attr_index = 0; attr_index < (GLuint)_sg.limits.max_vertex_attrs; attr_index++) {
+            const _sg_gl_attr_t* attr = &bnd->pip->gl.attrs[attr_index];
+            if (attr->vb_index >= 0) {
+                const uint32_t* items = &key.items[1 + _SG_GL_VAOCACHE_ATTR_ITEMS * attr_index];
+                _sg_gl_cache_bind_buffer(GL_ARRAY_BUFFER, items[0]);
+                glVertexAttribPointer(attr_index, attr->size, attr->type, attr->normalized, attr->stride, (const GLvoid*)(GLintptr)items[1]);
+                _sg_stats_add(gl.num_vertex_attrib_pointer, 1);
+                glVertexAttribDivisor(attr_index, (GLuint)attr->divisor);
+                _sg_stats_add(gl.num_vertex_attrib_divisor, 1);
+                glEnableVertexAttribArray(attr_index);
+                _sg_stats_add(gl.num_enable_vertex_attrib_array, 1);
+            }
+        }
+        item->key = key;
+        const int bucket = _sg_gl_vao_cache_bucket(key.hash);
+        item->bucket_next = c->buckets[bucket];
+        c->buckets[bucket] = item_index;
+    }
+    if (c->lru_head != item_index) {
+        _sg_gl_vao_cache_lru_unlink(item_index);
+        _sg_gl_vao_cache_lru_push_front(item_index);
+    }
+}
+
 _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_t* bnd) {
     SOKOL_ASSERT(bnd);
     SOKOL_ASSERT(bnd->pip);
@@ -9297,7 +12171,11 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_t* bnd) {
                 const GLenum gl_tgt = img->gl.target;
                 const GLuint gl_tex = img->gl.tex[img->cmn.active_slot];
                 const GLuint gl_smp = smp->gl.smp;
-                _sg_gl_cache_bind_texture_sampler(gl_tex_slot, gl_tgt, gl_tex, gl_smp);
+                if (_sg.gl.ext_multi_bind) {
+                    _sg_gl_cache_multi_bind_texture_sampler(gl_tex_slot, gl_tgt, gl_tex, gl_smp);
+                } else {
+                    _sg_gl_cache_bind_texture_sampler(gl_tex_slot, gl_tgt, gl_tex, gl_smp);
+                }
             }
         }
     }
@@ -9307,18 +12185,55 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_t* bnd) {
     for (int slot = 0; slot < bnd->num_vs_sbufs; slot++) {
         _sg_buffer_t* sb = bnd->vs_sbufs[slot];
         GLuint gl_sb = sb->gl.buf[sb->cmn.active_slot];
-        _sg_gl_cache_bind_storage_buffer(SG_SHADERSTAGE_VS, slot, gl_sb);
+        if (_sg.gl.ext_multi_bind) {
+            _sg_gl_cache_multi_bind_storage_buffer(SG_SHADERSTAGE_VS, slot, gl_sb);
+        } else {
+            _sg_gl_cache_bind_storage_buffer(SG_SHADERSTAGE_VS, slot, gl_sb);
+        }
     }
     for (int slot = 0; slot < bnd->num_fs_sbufs; slot++) {
         _sg_buffer_t* sb = bnd->fs_sbufs[slot];
         GLuint gl_sb = sb->gl.buf[sb->cmn.active_slot];
-        _sg_gl_cache_bind_storage_buffer(SG_SHADERSTAGE_FS, slot, gl_sb);
+        if (_sg.gl.ext_multi_bind) {
+            _sg_gl_cache_multi_bind_storage_buffer(SG_SHADERSTAGE_FS, slot, gl_sb);
+        } else {
+            _sg_gl_cache_bind_storage_buffer(SG_SHADERSTAGE_FS, slot, gl_sb);
+        }
+    }
+    if (_sg.gl.ext_multi_bind) {
+        _sg_gl_cache_flush_multi_bind();
+    }
+
+    // bind storage images (compute stage only, the image unit is the storage image slot)
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    for (int slot = 0; slot < bnd->num_simgs; slot++) {
+        const _sg_shader_storage_image_t* simg = &bnd->pip->shader->cmn.stage[SG_SHADERSTAGE_VS].storage_images[slot];
+        _sg_image_t* img = bnd->simgs[slot];
+        const GLuint gl_tex = img->gl.tex[img->cmn.active_slot];
+        const GLboolean layered = (img->cmn.type != SG_IMAGETYPE_2D) ? GL_TRUE : GL_FALSE;
+        const GLenum access = simg->readonly ? GL_READ_ONLY : GL_READ_WRITE;
+        glBindImageTexture((GLuint)slot, gl_tex, 0, layered, 0, access, _sg_gl_teximage_internal_format(simg->access_format));
+        _sg_stats_add(gl.num_bind_image_texture, 1);
+    }
+    #else
+    SOKOL_ASSERT(bnd->num_simgs == 0);
+    #endif
+    if (bnd->pip->cmn.is_compute) {
+        // compute pipelines have no vertex inputs
+        _SG_GL_CHECK_ERROR();
+        return true;
     }
 
     // index buffer (can be 0)
     const GLuint gl_ib = bnd->ib ? bnd->ib->gl.buf[bnd->ib->cmn.active_slot] : 0;
-    _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
     _sg.gl.cache.cur_ib_offset = bnd->ib_offset;
+    if (_sg.gl.vao_cache.num > 0) {
+        // index buffer and vertex attributes via the VAO cache
+        _sg_gl_apply_cached_vertex_array(bnd, gl_ib);
+        _SG_GL_CHECK_ERROR();
+        return true;
+    }
+    _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
 
     // vertex attributes
     for (GLuint attr_index = 0; attr_index < (GLuint)_sg.limits.max_vertex_attrs; attr_index++) {
@@ -9426,6 +12341,24 @@ _SOKOL_PRIVATE void _sg_gl_apply_uniforms(sg_shader_stage stage_index, int ub_in
     }
 }
 
+_SOKOL_PRIVATE void _sg_gl_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    SOKOL_ASSERT(_sg.gl.cache.cur_pipeline && _sg.gl.cache.cur_pipeline->cmn.is_compute);
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    // a dispatch may read the results of the previous dispatch in the same pass
+    if (_sg.gl.compute_barrier_pending) {
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        _sg_stats_add(gl.num_memory_barrier, 1);
+    }
+    glDispatchCompute((GLuint)num_groups_x, (GLuint)num_groups_y, (GLuint)num_groups_z);
+    _sg.gl.compute_barrier_pending = true;
+    #else
+    _SOKOL_UNUSED(num_groups_x);
+    _SOKOL_UNUSED(num_groups_y);
+    _SOKOL_UNUSED(num_groups_z);
+    #endif
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_instances) {
     SOKOL_ASSERT(_sg.gl.cache.cur_pipeline);
     const GLenum i_type = _sg.gl.cache.cur_index_type;
@@ -9451,39 +12384,204 @@ _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_inst
     }
 }
 
+// deliver finished readbacks in the order they were started, readbacks
+// older than sg_desc.num_inflight_frames frames are waited for
+_SOKOL_PRIVATE void _sg_gl_deliver_readbacks(void) {
+    while (_sg.gl.readback.num_pending > 0) {
+        _sg_gl_readback_t* rb = &_sg.gl.readback.slots[_sg.gl.readback.tail];
+        SOKOL_ASSERT(rb->fence);
+        GLenum wait_res = glClientWaitSync(rb->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (wait_res == GL_TIMEOUT_EXPIRED) {
+            if ((_sg.frame_index - rb->frame_index) < (uint32_t)_sg.desc.num_inflight_frames) {
+                break;
+            }
+            _sg_stats_add(gl.num_readback_fence_waits, 1);
+            do {
+                wait_res = glClientWaitSync(rb->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (wait_res == GL_TIMEOUT_EXPIRED);
+        }
+        if (wait_res == GL_WAIT_FAILED) {
+            _SG_ERROR(GL_READBACK_FENCE_WAIT_FAILED);
+        } else {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+            void* ptr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rb->num_bytes, GL_MAP_READ_BIT);
+            if (ptr) {
+                rb->info.data.ptr = ptr;
+                rb->info.data.size = (size_t)rb->num_bytes;
+                rb->callback(&rb->info);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                _sg_stats_add(size_read_image_async, (uint32_t)rb->num_bytes);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        glDeleteSync(rb->fence);
+        rb->fence = 0;
+        _sg_clear(&rb->info, sizeof(rb->info));
+        _sg.gl.readback.tail = (_sg.gl.readback.tail + 1) % _sg.gl.readback.num_slots;
+        _sg.gl.readback.num_pending--;
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE void _sg_gl_commit(void) {
     // "soft" clear bindings (only those that are actually bound)
     _sg_gl_cache_clear_buffer_bindings(false);
     _sg_gl_cache_clear_texture_sampler_bindings(false);
+    _sg_gl_deliver_readbacks();
+    if (_sg.gl.staging.pbo) {
+        _sg_gl_staging_push_fence();
+        _sg_gl_staging_retire(false);
+    }
 }
 
-_SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
-    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    // only one update per buffer per frame allowed
-    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
-        buf->cmn.active_slot = 0;
+_SOKOL_PRIVATE void _sg_gl_insert_frame_fence(int slot) {
+    SOKOL_ASSERT((slot >= 0) && (slot < _SG_MAX_FRAME_FENCES));
+    if (_sg.gl.frame_fences[slot]) {
+        glDeleteSync(_sg.gl.frame_fences[slot]);
     }
-    GLenum gl_tgt = _sg_gl_buffer_target(buf->cmn.type);
-    SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
-    GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
-    SOKOL_ASSERT(gl_buf);
-    _SG_GL_CHECK_ERROR();
-    _sg_gl_cache_store_buffer_binding(gl_tgt);
-    _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
-    glBufferSubData(gl_tgt, 0, (GLsizeiptr)data->size, data->ptr);
-    _sg_gl_cache_restore_buffer_binding(gl_tgt);
+    _sg.gl.frame_fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     _SG_GL_CHECK_ERROR();
 }
 
-_SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
-    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    if (new_frame) {
+// returns true if the GPU has passed the frame fence, if wait is true, blocks until it has
+_SOKOL_PRIVATE bool _sg_gl_frame_fence_signaled(int slot, bool wait) {
+    SOKOL_ASSERT((slot >= 0) && (slot < _SG_MAX_FRAME_FENCES));
+    GLsync fence = _sg.gl.frame_fences[slot];
+    if (0 == fence) {
+        return true;
+    }
+    GLenum wait_res = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    #if defined(__EMSCRIPTEN__)
+        // WebGL doesn't allow blocking waits, the browser is doing the frame pacing
+        _SOKOL_UNUSED(wait);
+    #else
+        if (wait) {
+            while (wait_res == GL_TIMEOUT_EXPIRED) {
+                wait_res = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            }
+        }
+    #endif
+    if (wait_res == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+    if (wait_res == GL_WAIT_FAILED) {
+        _SG_ERROR(GL_FRAME_FENCE_WAIT_FAILED);
+    }
+    glDeleteSync(fence);
+    _sg.gl.frame_fences[slot] = 0;
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_gl_read_image_async(_sg_image_t* img, const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(img && desc && desc->callback);
+    SOKOL_ASSERT(img->cmn.type == SG_IMAGETYPE_2D);
+    if (_sg.gl.readback.num_pending == _sg.gl.readback.num_slots) {
+        _SG_ERROR(READBACK_POOL_EXHAUSTED);
+        return false;
+    }
+    _SG_GL_CHECK_ERROR();
+    if (0 == _sg.gl.readback.fb) {
+        glGenFramebuffers(1, &_sg.gl.readback.fb);
+    }
+    GLuint gl_orig_fb;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, (GLint*)&gl_orig_fb);
+    glBindFramebuffer(GL_FRAMEBUFFER, _sg.gl.readback.fb);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, img->gl.tex[img->cmn.active_slot], 0);
+    bool result = false;
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        _SG_ERROR(GL_READBACK_FRAMEBUFFER_INCOMPLETE);
+    } else {
+        _sg_gl_readback_t* rb = &_sg.gl.readback.slots[_sg.gl.readback.head];
+        SOKOL_ASSERT(0 == rb->fence);
+        const sg_pixel_format fmt = img->cmn.pixel_format;
+        rb->num_bytes = _sg_surface_pitch(fmt, desc->width, desc->height, 1);
+        if (0 == rb->pbo) {
+            glGenBuffers(1, &rb->pbo);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        if (rb->num_bytes > rb->pbo_size) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, rb->num_bytes, 0, GL_STREAM_READ);
+            rb->pbo_size = rb->num_bytes;
+        }
+        glReadPixels(desc->x, desc->y, desc->width, desc->height, _sg_gl_teximage_format(fmt), _sg_gl_teximage_type(fmt), 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        rb->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        rb->frame_index = _sg.frame_index;
+        rb->callback = desc->callback;
+        rb->info.image.id = img->slot.id;
+        rb->info.x = desc->x;
+        rb->info.y = desc->y;
+        rb->info.width = desc->width;
+        rb->info.height = desc->height;
+        rb->info.pixel_format = fmt;
+        rb->info.user_data = desc->user_data;
+        _sg.gl.readback.head = (_sg.gl.readback.head + 1) % _sg.gl.readback.num_slots;
+        _sg.gl.readback.num_pending++;
+        result = true;
+    }
+    // detach the image again so that it doesn't linger in the readback framebuffer
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, gl_orig_fb);
+    _SG_GL_CHECK_ERROR();
+    return result;
+}
+
+_SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    // only one update per buffer per frame allowed
+    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+        buf->cmn.active_slot = 0;
+    }
+    GLenum gl_tgt = _sg_gl_buffer_target(buf->cmn.type);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES);
+    GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+    SOKOL_ASSERT(gl_buf);
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_cache_store_buffer_binding(gl_tgt);
+    _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+    glBufferSubData(gl_tgt, 0, (GLsizeiptr)data->size, data->ptr);
+    _sg_gl_cache_restore_buffer_binding(gl_tgt);
+    _SG_GL_CHECK_ERROR();
+}
+
+_SOKOL_PRIVATE void _sg_gl_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (new_frame) {
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+    }
+    GLenum gl_tgt = _sg_gl_buffer_target(buf->cmn.type);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES);
+    GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+    SOKOL_ASSERT(gl_buf);
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_cache_store_buffer_binding(gl_tgt);
+    _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+    if (new_frame) {
+        // bring the newly activated buffer copy up to date with the shadow copy
+        for (int i = 0; i < buf->cmn.dirty[buf->cmn.active_slot].num; i++) {
+            const _sg_buffer_range_t* r = &buf->cmn.dirty[buf->cmn.active_slot].ranges[i];
+            glBufferSubData(gl_tgt, r->offset, r->size, buf->cmn.shadow + r->offset);
+            _sg_stats_add(size_sync_buffer_range, (uint32_t)r->size);
+        }
+        buf->cmn.dirty[buf->cmn.active_slot].num = 0;
+    }
+    glBufferSubData(gl_tgt, offset, (GLsizeiptr)data->size, data->ptr);
+    _sg_gl_cache_restore_buffer_binding(gl_tgt);
+    _SG_GL_CHECK_ERROR();
+    _sg_buffer_common_track_update(&buf->cmn, offset, data);
+}
+
+_SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (new_frame) {
         if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
             buf->cmn.active_slot = 0;
         }
     }
     GLenum gl_tgt = _sg_gl_buffer_target(buf->cmn.type);
-    SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
     _SG_GL_CHECK_ERROR();
@@ -9494,13 +12592,50 @@ _SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data
     _SG_GL_CHECK_ERROR();
 }
 
+// NOTE: the copy targets aren't tracked in the buffer binding cache
+_SOKOL_PRIVATE void _sg_gl_copy_buffer(_sg_buffer_t* dst, int dst_offset, _sg_buffer_t* src, int src_offset, int size) {
+    SOKOL_ASSERT(dst && src && (size > 0));
+    SOKOL_ASSERT((dst->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES) && (src->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES));
+    GLuint gl_dst = dst->gl.buf[dst->cmn.active_slot];
+    GLuint gl_src = src->gl.buf[src->cmn.active_slot];
+    SOKOL_ASSERT(gl_dst && gl_src);
+    _SG_GL_CHECK_ERROR();
+    glBindBuffer(GL_COPY_READ_BUFFER, gl_src);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, gl_dst);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, src_offset, dst_offset, size);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    _SG_GL_CHECK_ERROR();
+}
+
+_SOKOL_PRIVATE void _sg_gl_copy_image_region(_sg_image_t* dst, _sg_image_t* src, const sg_image_copy_desc* desc) {
+    SOKOL_ASSERT(dst && src && desc);
+    #if defined(_SOKOL_GL_HAS_COPY_IMAGE)
+    SOKOL_ASSERT((dst->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES) && (src->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES));
+    GLuint gl_dst = dst->gl.tex[dst->cmn.active_slot];
+    GLuint gl_src = src->gl.tex[src->cmn.active_slot];
+    SOKOL_ASSERT(gl_dst && gl_src);
+    _SG_GL_CHECK_ERROR();
+    // NOTE: for cubemaps the z coordinate is the cube face index
+    glCopyImageSubData(
+        gl_src, src->gl.target, desc->src.mip_level, desc->src.x, desc->src.y, desc->src.slice,
+        gl_dst, dst->gl.target, desc->dst.mip_level, desc->dst.x, desc->dst.y, desc->dst.slice,
+        desc->width, desc->height, desc->num_slices);
+    _SG_GL_CHECK_ERROR();
+    #else
+    _SOKOL_UNUSED(dst);
+    _SOKOL_UNUSED(src);
+    _SOKOL_UNUSED(desc);
+    #endif
+}
+
 _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
     // only one update per image per frame allowed
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
     }
-    SOKOL_ASSERT(img->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_INFLIGHT_FRAMES);
     SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
     _sg_gl_cache_store_texture_sampler_binding(0);
     _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
@@ -9508,13 +12643,15 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
     const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
     const int num_faces = img->cmn.type == SG_IMAGETYPE_CUBE ? 6 : 1;
     const int num_mips = img->cmn.num_mipmaps;
+    const GLvoid* staged_ptrs[SG_CUBEFACE_NUM][SG_MAX_MIPMAPS];
+    const bool staged = _sg_gl_staging_begin(data, num_faces, num_mips, staged_ptrs);
     for (int face_index = 0; face_index < num_faces; face_index++) {
         for (int mip_index = 0; mip_index < num_mips; mip_index++) {
             GLenum gl_img_target = img->gl.target;
             if (SG_IMAGETYPE_CUBE == img->cmn.type) {
                 gl_img_target = _sg_gl_cubeface_target(face_index);
             }
-            const GLvoid* data_ptr = data->subimage[face_index][mip_index].ptr;
+            const GLvoid* data_ptr = staged ? staged_ptrs[face_index][mip_index] : data->subimage[face_index][mip_index].ptr;
             int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
             int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
             if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
@@ -9537,7 +12674,54 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
             }
         }
     }
+    if (staged) {
+        _sg_gl_staging_end();
+    }
+    _sg_gl_cache_restore_texture_sampler_binding(0);
+}
+
+// upload a non-resident mipmap of a streamed image and move the texture base level
+_SOKOL_PRIVATE void _sg_gl_update_image_mip(_sg_image_t* img, int mip_index, const sg_image_data* data) {
+    SOKOL_ASSERT(img && data);
+    SOKOL_ASSERT(img->cmn.num_slots == 1);
+    SOKOL_ASSERT(0 != img->gl.tex[0]);
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_cache_store_texture_sampler_binding(0);
+    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[0], 0);
+    const bool is_compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
+    const GLenum gl_internal_format = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
+    const GLenum gl_img_format = _sg_gl_teximage_format(img->cmn.pixel_format);
+    const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
+    const int num_faces = img->cmn.type == SG_IMAGETYPE_CUBE ? 6 : 1;
+    const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
+    const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        GLenum gl_img_target = img->gl.target;
+        if (SG_IMAGETYPE_CUBE == img->cmn.type) {
+            gl_img_target = _sg_gl_cubeface_target(face_index);
+        }
+        const sg_range* sub = &data->subimage[face_index][mip_index];
+        if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
+            if (is_compressed) {
+                glCompressedTexSubImage2D(gl_img_target, mip_index, 0, 0, mip_width, mip_height, gl_internal_format, (GLsizei)sub->size, sub->ptr);
+            } else {
+                glTexSubImage2D(gl_img_target, mip_index, 0, 0, mip_width, mip_height, gl_img_format, gl_img_type, sub->ptr);
+            }
+        } else if ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type)) {
+            int mip_depth = img->cmn.num_slices;
+            if (SG_IMAGETYPE_3D == img->cmn.type) {
+                mip_depth = _sg_miplevel_dim(img->cmn.num_slices, mip_index);
+            }
+            if (is_compressed) {
+                glCompressedTexSubImage3D(gl_img_target, mip_index, 0, 0, 0, mip_width, mip_height, mip_depth, gl_internal_format, (GLsizei)sub->size, sub->ptr);
+            } else {
+                glTexSubImage3D(gl_img_target, mip_index, 0, 0, 0, mip_width, mip_height, mip_depth, gl_img_format, gl_img_type, sub->ptr);
+            }
+        }
+    }
+    glTexParameteri(img->gl.target, GL_TEXTURE_BASE_LEVEL, img->cmn.base_mip_level);
     _sg_gl_cache_restore_texture_sampler_binding(0);
+    _SG_GL_CHECK_ERROR();
 }
 
 // ██████  ██████  ██████   ██  ██     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
@@ -11436,6 +14620,29 @@ _SOKOL_PRIVATE void _sg_d3d11_update_buffer(_sg_buffer_t* buf, const sg_range* d
     }
 }
 
+// NOTE: dynamic D3D11 buffers can only be mapped with WRITE_DISCARD or
+// WRITE_NO_OVERWRITE and can't be the destination of a GPU-side copy, so
+// each ranged update writes the entire shadow copy into a discarded buffer,
+// D3D11 takes care of buffer renaming internally
+_SOKOL_PRIVATE void _sg_d3d11_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(buf->d3d11.buf);
+    _SOKOL_UNUSED(new_frame);
+    _sg_buffer_common_track_update(&buf->cmn, offset, data);
+    D3D11_MAPPED_SUBRESOURCE d3d11_msr;
+    HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, D3D11_MAP_WRITE_DISCARD, 0, &d3d11_msr);
+    _sg_stats_add(d3d11.num_map, 1);
+    if (SUCCEEDED(hr)) {
+        memcpy(d3d11_msr.pData, buf->cmn.shadow, (size_t)buf->cmn.size);
+        _sg_d3d11_Unmap(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0);
+        _sg_stats_add(d3d11.num_unmap, 1);
+        _sg_stats_add(size_sync_buffer_range, (uint32_t)buf->cmn.size - (uint32_t)data->size);
+    } else {
+        _SG_ERROR(D3D11_MAP_FOR_UPDATE_BUFFER_FAILED);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_d3d11_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     SOKOL_ASSERT(_sg.d3d11.ctx);
@@ -11897,8 +15104,8 @@ _SOKOL_PRIVATE MTLSamplerMipFilter _sg_mtl_mipmap_filter(sg_filter f) {
 _SOKOL_PRIVATE void _sg_mtl_init_pool(const sg_desc* desc) {
     _sg.mtl.idpool.num_slots = 2 *
         (
-            2 * desc->buffer_pool_size +
-            4 * desc->image_pool_size +
+            desc->num_inflight_frames * desc->buffer_pool_size +
+            (desc->num_inflight_frames + 2) * desc->image_pool_size +
             1 * desc->sampler_pool_size +
             4 * desc->shader_pool_size +
             2 * desc->pipeline_pool_size +
@@ -11983,7 +15190,7 @@ _SOKOL_PRIVATE void _sg_mtl_release_resource(uint32_t frame_index, int slot_inde
     // release queue full?
     SOKOL_ASSERT(_sg.mtl.idpool.release_queue_front != _sg.mtl.idpool.release_queue_back);
     SOKOL_ASSERT(0 == _sg.mtl.idpool.release_queue[release_index].frame_index);
-    const uint32_t safe_to_release_frame_index = frame_index + SG_NUM_INFLIGHT_FRAMES + 1;
+    const uint32_t safe_to_release_frame_index = frame_index + (uint32_t)_sg.desc.num_inflight_frames + 1;
     _sg.mtl.idpool.release_queue[release_index].frame_index = safe_to_release_frame_index;
     _sg.mtl.idpool.release_queue[release_index].slot_index = slot_index;
 }
@@ -12192,11 +15399,11 @@ _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
     _sg_mtl_clear_state_cache();
     _sg.mtl.valid = true;
     _sg.mtl.ub_size = desc->uniform_buffer_size;
-    _sg.mtl.sem = dispatch_semaphore_create(SG_NUM_INFLIGHT_FRAMES);
+    _sg.mtl.sem = dispatch_semaphore_create(desc->num_inflight_frames);
     _sg.mtl.device = (__bridge id<MTLDevice>) desc->environment.metal.device;
     _sg.mtl.cmd_queue = [_sg.mtl.device newCommandQueue];
 
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < desc->num_inflight_frames; i++) {
         _sg.mtl.uniform_buffers[i] = [_sg.mtl.device
             newBufferWithLength:(NSUInteger)_sg.mtl.ub_size
             options:MTLResourceCPUCacheModeWriteCombined|MTLResourceStorageModeShared
@@ -12230,21 +15437,21 @@ _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
 _SOKOL_PRIVATE void _sg_mtl_discard_backend(void) {
     SOKOL_ASSERT(_sg.mtl.valid);
     // wait for the last frame to finish
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < _sg.desc.num_inflight_frames; i++) {
         dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_FOREVER);
     }
     // semaphore must be "relinquished" before destruction
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < _sg.desc.num_inflight_frames; i++) {
         dispatch_semaphore_signal(_sg.mtl.sem);
     }
-    _sg_mtl_garbage_collect(_sg.frame_index + SG_NUM_INFLIGHT_FRAMES + 2);
+    _sg_mtl_garbage_collect(_sg.frame_index + (uint32_t)_sg.desc.num_inflight_frames + 2);
     _sg_mtl_destroy_pool();
     _sg.mtl.valid = false;
 
     _SG_OBJC_RELEASE(_sg.mtl.sem);
     _SG_OBJC_RELEASE(_sg.mtl.device);
     _SG_OBJC_RELEASE(_sg.mtl.cmd_queue);
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < _sg.desc.num_inflight_frames; i++) {
         _SG_OBJC_RELEASE(_sg.mtl.uniform_buffers[i]);
     }
     // NOTE: MTLCommandBuffer and MTLRenderCommandEncoder are auto-released
@@ -12415,7 +15622,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_mtl_create_image(_sg_image_t* img, const sg
     const bool injected = (0 != desc->mtl_textures[0]);
 
     // first initialize all Metal resource pool slots to 'empty'
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
         img->mtl.tex[i] = _sg_mtl_add_resource(nil);
     }
 
@@ -12844,7 +16051,12 @@ _SOKOL_PRIVATE void _sg_mtl_begin_pass(const sg_pass* pass) {
     */
     if (nil == _sg.mtl.cmd_buffer) {
         // block until the oldest frame in flight has finished
-        dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_FOREVER);
+        if (0 != dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_NOW)) {
+            const double wait_start_ms = _sg_time_ms();
+            dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_FOREVER);
+            _sg.pacing.backend_wait_ms += _sg_time_ms() - wait_start_ms;
+            _sg.pacing.backend_waited = true;
+        }
         if (_sg.desc.mtl_use_command_buffer_with_retained_references) {
             _sg.mtl.cmd_buffer = [_sg.mtl.cmd_queue commandBuffer];
         } else {
@@ -13043,7 +16255,7 @@ _SOKOL_PRIVATE void _sg_mtl_commit(void) {
     _sg_mtl_garbage_collect(_sg.frame_index);
 
     // rotate uniform buffer slot
-    if (++_sg.mtl.cur_frame_rotate_index >= SG_NUM_INFLIGHT_FRAMES) {
+    if (++_sg.mtl.cur_frame_rotate_index >= _sg.desc.num_inflight_frames) {
         _sg.mtl.cur_frame_rotate_index = 0;
     }
     _sg.mtl.cur_ub_offset = 0;
@@ -13278,6 +16490,41 @@ _SOKOL_PRIVATE void _sg_mtl_update_buffer(_sg_buffer_t* buf, const sg_range* dat
     #endif
 }
 
+_SOKOL_PRIVATE void _sg_mtl_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (new_frame) {
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+    }
+    __unsafe_unretained id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+    uint8_t* dst_ptr = (uint8_t*) [mtl_buf contents];
+    #if defined(_SG_TARGET_MACOS)
+    const bool managed = _sg_mtl_resource_options_storage_mode_managed_or_shared() == MTLResourceStorageModeManaged;
+    #endif
+    if (new_frame) {
+        // bring the newly activated buffer copy up to date with the shadow copy
+        for (int i = 0; i < buf->cmn.dirty[buf->cmn.active_slot].num; i++) {
+            const _sg_buffer_range_t* r = &buf->cmn.dirty[buf->cmn.active_slot].ranges[i];
+            memcpy(dst_ptr + r->offset, buf->cmn.shadow + r->offset, (size_t)r->size);
+            #if defined(_SG_TARGET_MACOS)
+            if (managed) {
+                [mtl_buf didModifyRange:NSMakeRange((NSUInteger)r->offset, (NSUInteger)r->size)];
+            }
+            #endif
+            _sg_stats_add(size_sync_buffer_range, (uint32_t)r->size);
+        }
+        buf->cmn.dirty[buf->cmn.active_slot].num = 0;
+    }
+    memcpy(dst_ptr + offset, data->ptr, data->size);
+    #if defined(_SG_TARGET_MACOS)
+    if (managed) {
+        [mtl_buf didModifyRange:NSMakeRange((NSUInteger)offset, (NSUInteger)data->size)];
+    }
+    #endif
+    _sg_buffer_common_track_update(&buf->cmn, offset, data);
+}
+
 _SOKOL_PRIVATE void _sg_mtl_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     if (new_frame) {
@@ -13971,11 +17218,8 @@ _SOKOL_PRIVATE _sg_wgpu_bindgroup_t* _sg_wgpu_lookup_bindgroup(uint32_t bg_id) {
 _SOKOL_PRIVATE _sg_wgpu_bindgroup_handle_t _sg_wgpu_alloc_bindgroup(void) {
     _sg_wgpu_bindgroups_pool_t* p = &_sg.wgpu.bindgroups_pool;
     _sg_wgpu_bindgroup_handle_t res;
-    int slot_index = _sg_pool_alloc_index(&p->pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&p->pool, &p->bindgroups[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&p->pool, p->bindgroups, sizeof(_sg_wgpu_bindgroup_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(WGPU_BINDGROUPS_POOL_EXHAUSTED);
     }
     return res;
@@ -13984,8 +17228,7 @@ _SOKOL_PRIVATE _sg_wgpu_bindgroup_handle_t _sg_wgpu_alloc_bindgroup(void) {
 _SOKOL_PRIVATE void _sg_wgpu_dealloc_bindgroup(_sg_wgpu_bindgroup_t* bg) {
     SOKOL_ASSERT(bg && (bg->slot.state == SG_RESOURCESTATE_ALLOC) && (bg->slot.id != SG_INVALID_ID));
     _sg_wgpu_bindgroups_pool_t* p = &_sg.wgpu.bindgroups_pool;
-    _sg_pool_free_index(&p->pool, _sg_slot_index(bg->slot.id));
-    _sg_reset_slot(&bg->slot);
+    _sg_pool_free_slot(&p->pool, &bg->slot);
 }
 
 _SOKOL_PRIVATE void _sg_wgpu_reset_bindgroup_to_alloc_state(_sg_wgpu_bindgroup_t* bg) {
@@ -15221,6 +18464,18 @@ _SOKOL_PRIVATE void _sg_wgpu_update_buffer(_sg_buffer_t* buf, const sg_range* da
     _sg_wgpu_copy_buffer_data(buf, 0, data);
 }
 
+// WebGPU buffers are not multi-buffered, queue writes are ordered
+// with the GPU work, so no shadow copy is needed
+// NOTE: the size must be a multiple of 4, otherwise _sg_wgpu_copy_buffer_data()
+// would write a padded tail past the end of the range
+_SOKOL_PRIVATE void _sg_wgpu_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    SOKOL_ASSERT(((offset & 3) == 0) && ((data->size & 3) == 0));
+    SOKOL_ASSERT(buf);
+    _SOKOL_UNUSED(new_frame);
+    _sg_wgpu_copy_buffer_data(buf, (uint64_t)offset, data);
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(new_frame);
@@ -15656,6 +18911,27 @@ static inline void _sg_draw(int base_element, int num_elements, int num_instance
     #endif
 }
 
+static inline void _sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_dispatch(num_groups_x, num_groups_y, num_groups_z);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_dispatch(num_groups_x, num_groups_y, num_groups_z);
+    #else
+    // not supported on this backend, see sg_features.compute
+    _SOKOL_UNUSED(num_groups_x);
+    _SOKOL_UNUSED(num_groups_y);
+    _SOKOL_UNUSED(num_groups_z);
+    #endif
+}
+
+static inline void _sg_end_compute_pass(void) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_end_compute_pass();
+    #else
+    // nothing to do on the dummy backend, and not supported on other backends
+    #endif
+}
+
 static inline void _sg_commit(void) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_commit();
@@ -15672,6 +18948,29 @@ static inline void _sg_commit(void) {
     #endif
 }
 
+static inline void _sg_insert_frame_fence(int slot) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_insert_frame_fence(slot);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_insert_frame_fence(slot);
+    #else
+    // frame pacing is done by the backend 3D API
+    _SOKOL_UNUSED(slot);
+    #endif
+}
+
+static inline bool _sg_frame_fence_signaled(int slot, bool wait) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_frame_fence_signaled(slot, wait);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_frame_fence_signaled(slot, wait);
+    #else
+    _SOKOL_UNUSED(slot);
+    _SOKOL_UNUSED(wait);
+    return true;
+    #endif
+}
+
 static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_update_buffer(buf, data);
@@ -15688,6 +18987,22 @@ static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     #endif
 }
 
+static inline void _sg_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_buffer_range(buf, offset, data, new_frame);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
 static inline void _sg_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_append_buffer(buf, data, new_frame);
@@ -15704,6 +19019,47 @@ static inline void _sg_append_buffer(_sg_buffer_t* buf, const sg_range* data, bo
     #endif
 }
 
+static inline bool _sg_read_image_async(_sg_image_t* img, const sg_read_image_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_read_image_async(img, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_read_image_async(img, desc);
+    #else
+    // not yet supported on this backend, see sg_features.image_readback
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(desc);
+    return false;
+    #endif
+}
+
+static inline void _sg_copy_buffer(_sg_buffer_t* dst, int dst_offset, _sg_buffer_t* src, int src_offset, int size) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_copy_buffer(dst, dst_offset, src, src_offset, size);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_copy_buffer(dst, dst_offset, src, src_offset, size);
+    #else
+    // not yet supported on this backend, see sg_features.copy_buffer
+    _SOKOL_UNUSED(dst);
+    _SOKOL_UNUSED(dst_offset);
+    _SOKOL_UNUSED(src);
+    _SOKOL_UNUSED(src_offset);
+    _SOKOL_UNUSED(size);
+    #endif
+}
+
+static inline void _sg_copy_image_region(_sg_image_t* dst, _sg_image_t* src, const sg_image_copy_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_copy_image_region(dst, src, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_copy_image_region(dst, src, desc);
+    #else
+    // not yet supported on this backend, see sg_features.copy_image
+    _SOKOL_UNUSED(dst);
+    _SOKOL_UNUSED(src);
+    _SOKOL_UNUSED(desc);
+    #endif
+}
+
 static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_update_image(img, data);
@@ -15720,6 +19076,19 @@ static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data)
     #endif
 }
 
+static inline void _sg_update_image_mip(_sg_image_t* img, int mip_index, const sg_image_data* data) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_image_mip(img, mip_index, data);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_image_mip(img, mip_index, data);
+    #else
+    // not yet supported on this backend, see sg_features.mip_streaming
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(mip_index);
+    _SOKOL_UNUSED(data);
+    #endif
+}
+
 static inline void _sg_push_debug_group(const char* name) {
     #if defined(SOKOL_METAL)
     _sg_mtl_push_debug_group(name);
@@ -15741,6 +19110,65 @@ static inline void _sg_pop_debug_group(void) {
 // ██       ██████   ██████  ███████
 //
 // >>pool
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+#if defined(_SG_PTHREADS)
+_SOKOL_PRIVATE void _sg_mutex_init(_sg_mutex_t* m) {
+    pthread_mutex_init(&m->mutex, NULL);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_destroy(_sg_mutex_t* m) {
+    pthread_mutex_destroy(&m->mutex);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_lock(_sg_mutex_t* m) {
+    pthread_mutex_lock(&m->mutex);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_unlock(_sg_mutex_t* m) {
+    pthread_mutex_unlock(&m->mutex);
+}
+
+_SOKOL_PRIVATE _sg_thread_id_t _sg_thread_self(void) {
+    return pthread_self();
+}
+
+_SOKOL_PRIVATE bool _sg_thread_equal(_sg_thread_id_t a, _sg_thread_id_t b) {
+    return 0 != pthread_equal(a, b);
+}
+#elif defined(_SG_WINTHREADS)
+_SOKOL_PRIVATE void _sg_mutex_init(_sg_mutex_t* m) {
+    InitializeCriticalSection(&m->critsec);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_destroy(_sg_mutex_t* m) {
+    DeleteCriticalSection(&m->critsec);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_lock(_sg_mutex_t* m) {
+    EnterCriticalSection(&m->critsec);
+}
+
+_SOKOL_PRIVATE void _sg_mutex_unlock(_sg_mutex_t* m) {
+    LeaveCriticalSection(&m->critsec);
+}
+
+_SOKOL_PRIVATE _sg_thread_id_t _sg_thread_self(void) {
+    return GetCurrentThreadId();
+}
+
+_SOKOL_PRIVATE bool _sg_thread_equal(_sg_thread_id_t a, _sg_thread_id_t b) {
+    return a == b;
+}
+#else
+_SOKOL_PRIVATE void _sg_mutex_init(_sg_mutex_t* m) { _SOKOL_UNUSED(m); }
+_SOKOL_PRIVATE void _sg_mutex_destroy(_sg_mutex_t* m) { _SOKOL_UNUSED(m); }
+_SOKOL_PRIVATE void _sg_mutex_lock(_sg_mutex_t* m) { _SOKOL_UNUSED(m); }
+_SOKOL_PRIVATE void _sg_mutex_unlock(_sg_mutex_t* m) { _SOKOL_UNUSED(m); }
+_SOKOL_PRIVATE _sg_thread_id_t _sg_thread_self(void) { return 0; }
+_SOKOL_PRIVATE bool _sg_thread_equal(_sg_thread_id_t a, _sg_thread_id_t b) { return a == b; }
+#endif
+#endif // SOKOL_THREADSAFE_RESOURCES
+
 _SOKOL_PRIVATE void _sg_init_pool(_sg_pool_t* pool, int num) {
     SOKOL_ASSERT(pool && (num >= 1));
     // slot 0 is reserved for the 'invalid id', so bump the pool size by 1
@@ -15755,11 +19183,17 @@ _SOKOL_PRIVATE void _sg_init_pool(_sg_pool_t* pool, int num) {
     for (int i = pool->size-1; i >= 1; i--) {
         pool->free_queue[pool->queue_top++] = i;
     }
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_mutex_init(&pool->mutex);
+    #endif
 }
 
 _SOKOL_PRIVATE void _sg_discard_pool(_sg_pool_t* pool) {
     SOKOL_ASSERT(pool);
     SOKOL_ASSERT(pool->free_queue);
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_mutex_destroy(&pool->mutex);
+    #endif
     _sg_free(pool->free_queue);
     pool->free_queue = 0;
     SOKOL_ASSERT(pool->gen_ctrs);
@@ -15769,19 +19203,36 @@ _SOKOL_PRIVATE void _sg_discard_pool(_sg_pool_t* pool) {
     pool->queue_top = 0;
 }
 
+_SOKOL_PRIVATE void _sg_pool_lock(_sg_pool_t* pool) {
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_mutex_lock(&pool->mutex);
+    #else
+    _SOKOL_UNUSED(pool);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_pool_unlock(_sg_pool_t* pool) {
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_mutex_unlock(&pool->mutex);
+    #else
+    _SOKOL_UNUSED(pool);
+    #endif
+}
+
+// NOTE: must be called with the pool lock held
 _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool) {
     SOKOL_ASSERT(pool);
     SOKOL_ASSERT(pool->free_queue);
+    int slot_index = _SG_INVALID_SLOT_INDEX;
     if (pool->queue_top > 0) {
-        int slot_index = pool->free_queue[--pool->queue_top];
+        slot_index = pool->free_queue[--pool->queue_top];
         SOKOL_ASSERT((slot_index > 0) && (slot_index < pool->size));
-        return slot_index;
-    } else {
-        // pool exhausted
-        return _SG_INVALID_SLOT_INDEX;
     }
+    // _SG_INVALID_SLOT_INDEX if pool is exhausted
+    return slot_index;
 }
 
+// NOTE: must be called with the pool lock held
 _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index) {
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < pool->size));
     SOKOL_ASSERT(pool);
@@ -15923,6 +19374,33 @@ _SOKOL_PRIVATE uint32_t _sg_slot_alloc(_sg_pool_t* pool, _sg_slot_t* slot, int s
     return slot->id;
 }
 
+/* pop a free slot index and allocate the slot at that index in one go
+    while holding the pool lock, so that pool walks on the render thread never
+    see a half-initialized slot (items is the pool's item array, each item
+    must start with its _sg_slot_t), returns SG_INVALID_ID if the pool is exhausted
+*/
+_SOKOL_PRIVATE uint32_t _sg_pool_alloc_slot(_sg_pool_t* pool, void* items, size_t item_size) {
+    SOKOL_ASSERT(pool && items && (item_size >= sizeof(_sg_slot_t)));
+    uint32_t id = SG_INVALID_ID;
+    _sg_pool_lock(pool);
+    int slot_index = _sg_pool_alloc_index(pool);
+    if (_SG_INVALID_SLOT_INDEX != slot_index) {
+        _sg_slot_t* slot = (_sg_slot_t*)((uint8_t*)items + (size_t)slot_index * item_size);
+        id = _sg_slot_alloc(pool, slot, slot_index);
+    }
+    _sg_pool_unlock(pool);
+    return id;
+}
+
+// reset the slot and return its index to the free queue while holding the pool lock
+_SOKOL_PRIVATE void _sg_pool_free_slot(_sg_pool_t* pool, _sg_slot_t* slot) {
+    SOKOL_ASSERT(pool && slot);
+    _sg_pool_lock(pool);
+    _sg_pool_free_index(pool, _sg_slot_index(slot->id));
+    _sg_reset_slot(slot);
+    _sg_pool_unlock(pool);
+}
+
 // extract slot index from id
 _SOKOL_PRIVATE int _sg_slot_index(uint32_t id) {
     int slot_index = (int) (id & _SG_SLOT_MASK);
@@ -15930,10 +19408,49 @@ _SOKOL_PRIVATE int _sg_slot_index(uint32_t id) {
     return slot_index;
 }
 
-// returns pointer to resource by id without matching id check
-_SOKOL_PRIVATE _sg_buffer_t* _sg_buffer_at(const _sg_pools_t* p, uint32_t buf_id) {
-    SOKOL_ASSERT(p && (SG_INVALID_ID != buf_id));
-    int slot_index = _sg_slot_index(buf_id);
+#if defined(SOKOL_TRACK_RESOURCE_USAGE)
+// records a use of a resource in the current frame, the per-frame
+// counters are rolled over lazily on the first use in a new frame
+_SOKOL_PRIVATE void _sg_slot_track_use(_sg_slot_t* slot) {
+    _sg_slot_usage_t* usage = &slot->usage;
+    if (usage->use_frame_index != _sg.frame_index) {
+        usage->num_uses_prev_frame = (usage->use_frame_index == (_sg.frame_index - 1)) ? usage->num_uses : 0;
+        usage->num_uses = 0;
+        usage->use_frame_index = _sg.frame_index;
+    }
+    usage->num_uses++;
+    usage->num_uses_total++;
+}
+
+_SOKOL_PRIVATE void _sg_slot_track_update(_sg_slot_t* slot, size_t num_bytes) {
+    slot->usage.num_updated_bytes += num_bytes;
+}
+#endif
+
+_SOKOL_PRIVATE sg_resource_usage _sg_slot_query_usage(const _sg_slot_t* slot) {
+    sg_resource_usage res;
+    _sg_clear(&res, sizeof(res));
+    #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+        const _sg_slot_usage_t* usage = &slot->usage;
+        res.last_used_frame_index = usage->use_frame_index;
+        if (usage->use_frame_index == _sg.frame_index) {
+            res.num_binds = usage->num_uses;
+            res.num_binds_prev_frame = usage->num_uses_prev_frame;
+        } else if (usage->use_frame_index == (_sg.frame_index - 1)) {
+            res.num_binds_prev_frame = usage->num_uses;
+        }
+        res.num_binds_total = usage->num_uses_total;
+        res.num_updated_bytes = usage->num_updated_bytes;
+    #else
+        _SOKOL_UNUSED(slot);
+    #endif
+    return res;
+}
+
+// returns pointer to resource by id without matching id check
+_SOKOL_PRIVATE _sg_buffer_t* _sg_buffer_at(const _sg_pools_t* p, uint32_t buf_id) {
+    SOKOL_ASSERT(p && (SG_INVALID_ID != buf_id));
+    int slot_index = _sg_slot_index(buf_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < p->buffer_pool.size));
     return &p->buffers[slot_index];
 }
@@ -16037,6 +19554,47 @@ _SOKOL_PRIVATE _sg_attachments_t* _sg_lookup_attachments(const _sg_pools_t* p, u
     return 0;
 }
 
+#if defined(SOKOL_TRACK_RESOURCE_USAGE)
+_SOKOL_PRIVATE void _sg_track_bindings_usage(_sg_bindings_t* bnd) {
+    for (int i = 0; i < bnd->num_vbs; i++) {
+        _sg_slot_track_use(&bnd->vbs[i]->slot);
+    }
+    if (bnd->ib) {
+        _sg_slot_track_use(&bnd->ib->slot);
+    }
+    for (int i = 0; i < bnd->num_vs_imgs; i++) {
+        _sg_slot_track_use(&bnd->vs_imgs[i]->slot);
+    }
+    for (int i = 0; i < bnd->num_vs_sbufs; i++) {
+        _sg_slot_track_use(&bnd->vs_sbufs[i]->slot);
+    }
+    for (int i = 0; i < bnd->num_fs_imgs; i++) {
+        _sg_slot_track_use(&bnd->fs_imgs[i]->slot);
+    }
+    for (int i = 0; i < bnd->num_fs_sbufs; i++) {
+        _sg_slot_track_use(&bnd->fs_sbufs[i]->slot);
+    }
+    for (int i = 0; i < bnd->num_simgs; i++) {
+        _sg_slot_track_use(&bnd->simgs[i]->slot);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_track_attachment_usage(const _sg_attachment_common_t* att) {
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, att->image_id.id);
+    if (img) {
+        _sg_slot_track_use(&img->slot);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_track_attachments_usage(const _sg_attachments_t* atts) {
+    for (int i = 0; i < atts->cmn.num_colors; i++) {
+        _sg_track_attachment_usage(&atts->cmn.colors[i]);
+        _sg_track_attachment_usage(&atts->cmn.resolves[i]);
+    }
+    _sg_track_attachment_usage(&atts->cmn.depth_stencil);
+}
+#endif
+
 _SOKOL_PRIVATE void _sg_discard_all_resources(_sg_pools_t* p) {
     /*  this is a bit dumb since it loops over all pool slots to
         find the occupied slots, on the other hand it is only ever
@@ -16049,6 +19607,7 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(_sg_pools_t* p) {
         sg_resource_state state = p->buffers[i].slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
             _sg_discard_buffer(&p->buffers[i]);
+            _sg_buffer_common_discard(&p->buffers[i].cmn);
         }
     }
     for (int i = 1; i < p->image_pool.size; i++) {
@@ -16107,6 +19666,30 @@ _SOKOL_PRIVATE bool _sg_validate_end(void) {
         return true;
     }
 }
+
+_SOKOL_PRIVATE bool _sg_validate_stage_bindings_empty(const sg_stage_bindings* stage_bnd) {
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGES; i++) {
+        if (stage_bnd->images[i].id != SG_INVALID_ID) {
+            return false;
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_SAMPLERS; i++) {
+        if (stage_bnd->samplers[i].id != SG_INVALID_ID) {
+            return false;
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++) {
+        if (stage_bnd->storage_buffers[i].id != SG_INVALID_ID) {
+            return false;
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEIMAGES; i++) {
+        if (stage_bnd->storage_images[i].id != SG_INVALID_ID) {
+            return false;
+        }
+    }
+    return true;
+}
 #endif
 
 _SOKOL_PRIVATE bool _sg_validate_buffer_desc(const sg_buffer_desc* desc) {
@@ -16136,22 +19719,35 @@ _SOKOL_PRIVATE bool _sg_validate_buffer_desc(const sg_buffer_desc* desc) {
             _SG_VALIDATE(_sg.features.storage_buffer, VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED);
             _SG_VALIDATE(_sg_multiple_u64(desc->size, 4), VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4);
         }
+        _SG_VALIDATE(desc->max_views >= 0, VALIDATE_BUFFERDESC_MAX_VIEWS);
+        if (desc->max_views > 0) {
+            _SG_VALIDATE((desc->view_alignment > 0) && _sg_ispow2(desc->view_alignment), VALIDATE_BUFFERDESC_VIEW_ALIGNMENT);
+        }
+        if (desc->max_size > 0) {
+            _SG_VALIDATE(desc->max_size >= desc->size, VALIDATE_BUFFERDESC_MAX_SIZE);
+            _SG_VALIDATE(desc->max_size <= (size_t)INT_MAX, VALIDATE_BUFFERDESC_MAX_SIZE_LIMIT);
+            _SG_VALIDATE(desc->usage != SG_USAGE_IMMUTABLE, VALIDATE_BUFFERDESC_MAX_SIZE_USAGE);
+            _SG_VALIDATE(!injected, VALIDATE_BUFFERDESC_MAX_SIZE_INJECTED);
+            _SG_VALIDATE(desc->max_views == 0, VALIDATE_BUFFERDESC_MAX_SIZE_VIEWS);
+        }
         return _sg_validate_end();
     #endif
 }
 
-_SOKOL_PRIVATE void _sg_validate_image_data(const sg_image_data* data, sg_pixel_format fmt, int width, int height, int num_faces, int num_mips, int num_slices) {
+// validates the data of the mipmaps [first_mip, num_mips)
+_SOKOL_PRIVATE void _sg_validate_image_data(const sg_image_data* data, sg_pixel_format fmt, int width, int height, int num_faces, int first_mip, int num_mips, int num_slices) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(data);
         _SOKOL_UNUSED(fmt);
         _SOKOL_UNUSED(width);
         _SOKOL_UNUSED(height);
         _SOKOL_UNUSED(num_faces);
+        _SOKOL_UNUSED(first_mip);
         _SOKOL_UNUSED(num_mips);
         _SOKOL_UNUSED(num_slices);
     #else
         for (int face_index = 0; face_index < num_faces; face_index++) {
-            for (int mip_index = 0; mip_index < num_mips; mip_index++) {
+            for (int mip_index = first_mip; mip_index < num_mips; mip_index++) {
                 const bool has_data = data->subimage[face_index][mip_index].ptr != 0;
                 const bool has_size = data->subimage[face_index][mip_index].size > 0;
                 _SG_VALIDATE(has_data && has_size, VALIDATE_IMAGEDATA_NODATA);
@@ -16188,6 +19784,23 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
         if (_sg_is_depth_or_depth_stencil_format(fmt)) {
             _SG_VALIDATE(desc->type != SG_IMAGETYPE_3D, VALIDATE_IMAGEDESC_DEPTH_3D_IMAGE);
         }
+        if (desc->storage_image) {
+            _SG_VALIDATE(_sg.features.compute, VALIDATE_IMAGEDESC_STORAGE_NOT_SUPPORTED);
+            _SG_VALIDATE(_sg_is_valid_storage_image_format(fmt), VALIDATE_IMAGEDESC_STORAGE_PIXELFORMAT);
+            _SG_VALIDATE(usage == SG_USAGE_IMMUTABLE, VALIDATE_IMAGEDESC_STORAGE_IMMUTABLE);
+            _SG_VALIDATE(desc->data.subimage[0][0].ptr==0, VALIDATE_IMAGEDESC_STORAGE_NO_DATA);
+            _SG_VALIDATE(desc->sample_count == 1, VALIDATE_IMAGEDESC_STORAGE_MSAA);
+        }
+        if (desc->evictable) {
+            SOKOL_ASSERT(((int)fmt >= 0) && ((int)fmt < _SG_PIXELFORMAT_NUM));
+            _SG_VALIDATE(!desc->render_target && !desc->storage_image, VALIDATE_IMAGEDESC_EVICTABLE_RT);
+            _SG_VALIDATE(_sg.formats[fmt].filter && !_sg_is_depth_or_depth_stencil_format(fmt), VALIDATE_IMAGEDESC_EVICTABLE_PIXELFORMAT);
+        }
+        _SG_VALIDATE((desc->num_resident_mipmaps >= 1) && (desc->num_resident_mipmaps <= desc->num_mipmaps), VALIDATE_IMAGEDESC_RESIDENT_MIPMAPS);
+        const bool streamed = desc->num_resident_mipmaps < desc->num_mipmaps;
+        if (streamed) {
+            _SG_VALIDATE((usage == SG_USAGE_IMMUTABLE) && !desc->render_target && !desc->storage_image && !injected, VALIDATE_IMAGEDESC_STREAMING_USAGE);
+        }
         if (desc->render_target) {
             SOKOL_ASSERT(((int)fmt >= 0) && ((int)fmt < _SG_PIXELFORMAT_NUM));
             _SG_VALIDATE(_sg.formats[fmt].render, VALIDATE_IMAGEDESC_RT_PIXELFORMAT);
@@ -16207,15 +19820,25 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
             if (is_compressed) {
                 _SG_VALIDATE(is_immutable, VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE);
             }
-            if (!injected && is_immutable) {
-                // image desc must have valid data
+            if (!injected && is_immutable && !desc->storage_image) {
+                // image desc must have valid data, except for non-resident mipmaps
+                const int num_faces = (desc->type == SG_IMAGETYPE_CUBE) ? 6 : 1;
+                const int first_resident_mip = _sg_max(desc->num_mipmaps - desc->num_resident_mipmaps, 0);
                 _sg_validate_image_data(&desc->data,
                     desc->pixel_format,
                     desc->width,
                     desc->height,
-                    (desc->type == SG_IMAGETYPE_CUBE) ? 6 : 1,
+                    num_faces,
+                    first_resident_mip,
                     desc->num_mipmaps,
                     desc->num_slices);
+                for (int face_index = 0; face_index < num_faces; face_index++) {
+                    for (int mip_index = 0; mip_index < first_resident_mip; mip_index++) {
+                        const bool no_data = 0 == desc->data.subimage[face_index][mip_index].ptr;
+                        const bool no_size = 0 == desc->data.subimage[face_index][mip_index].size;
+                        _SG_VALIDATE(no_data && no_size, VALIDATE_IMAGEDESC_STREAMING_NO_DATA);
+                    }
+                }
             } else {
                 // image desc must not have data
                 for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
@@ -16273,17 +19896,29 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
         _sg_validate_begin();
         _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_SHADERDESC_CANARY);
         _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_SHADERDESC_CANARY);
-        #if defined(SOKOL_GLCORE) || defined(SOKOL_GLES3) || defined(SOKOL_WGPU)
-            // on GL or WebGPU, must provide shader source code
-            _SG_VALIDATE(0 != desc->vs.source, VALIDATE_SHADERDESC_SOURCE);
-            _SG_VALIDATE(0 != desc->fs.source, VALIDATE_SHADERDESC_SOURCE);
-        #elif defined(SOKOL_METAL) || defined(SOKOL_D3D11)
-            // on Metal or D3D11, must provide shader source code or byte code
-            _SG_VALIDATE((0 != desc->vs.source)||(0 != desc->vs.bytecode.ptr), VALIDATE_SHADERDESC_SOURCE_OR_BYTECODE);
-            _SG_VALIDATE((0 != desc->fs.source)||(0 != desc->fs.bytecode.ptr), VALIDATE_SHADERDESC_SOURCE_OR_BYTECODE);
-        #else
-            // Dummy Backend, don't require source or bytecode
-        #endif
+        const bool is_compute = _sg_shader_desc_is_compute(desc);
+        if (is_compute) {
+            _SG_VALIDATE(_sg.features.compute, VALIDATE_SHADERDESC_COMPUTE_NOT_SUPPORTED);
+            const bool no_vs_fs = (0 == desc->vs.source) && (0 == desc->vs.bytecode.ptr)
+                               && (0 == desc->fs.source) && (0 == desc->fs.bytecode.ptr);
+            _SG_VALIDATE(no_vs_fs, VALIDATE_SHADERDESC_COMPUTE_VS_FS);
+            #if defined(SOKOL_GLCORE) || defined(SOKOL_GLES3) || defined(SOKOL_WGPU)
+                // on GL or WebGPU, must provide shader source code
+                _SG_VALIDATE(0 != desc->cs.source, VALIDATE_SHADERDESC_SOURCE);
+            #endif
+        } else {
+            #if defined(SOKOL_GLCORE) || defined(SOKOL_GLES3) || defined(SOKOL_WGPU)
+                // on GL or WebGPU, must provide shader source code
+                _SG_VALIDATE(0 != desc->vs.source, VALIDATE_SHADERDESC_SOURCE);
+                _SG_VALIDATE(0 != desc->fs.source, VALIDATE_SHADERDESC_SOURCE);
+            #elif defined(SOKOL_METAL) || defined(SOKOL_D3D11)
+                // on Metal or D3D11, must provide shader source code or byte code
+                _SG_VALIDATE((0 != desc->vs.source)||(0 != desc->vs.bytecode.ptr), VALIDATE_SHADERDESC_SOURCE_OR_BYTECODE);
+                _SG_VALIDATE((0 != desc->fs.source)||(0 != desc->fs.bytecode.ptr), VALIDATE_SHADERDESC_SOURCE_OR_BYTECODE);
+            #else
+                // Dummy Backend, don't require source or bytecode
+            #endif
+        }
         for (int i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
             if (desc->attrs[i].name) {
                 _SG_VALIDATE(strlen(desc->attrs[i].name) < _SG_STRING_SIZE, VALIDATE_SHADERDESC_ATTR_STRING_TOO_LONG);
@@ -16299,8 +19934,12 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
         if (0 != desc->fs.bytecode.ptr) {
             _SG_VALIDATE(desc->fs.bytecode.size > 0, VALIDATE_SHADERDESC_NO_BYTECODE_SIZE);
         }
+        if (0 != desc->cs.bytecode.ptr) {
+            _SG_VALIDATE(desc->cs.bytecode.size > 0, VALIDATE_SHADERDESC_NO_BYTECODE_SIZE);
+        }
         for (int stage_index = 0; stage_index < SG_NUM_SHADER_STAGES; stage_index++) {
-            const sg_shader_stage_desc* stage_desc = (stage_index == 0)? &desc->vs : &desc->fs;
+            const sg_shader_stage_desc* stage_desc = _sg_shader_desc_stage(desc, stage_index);
+            const bool is_compute_stage = is_compute && (stage_index == SG_SHADERSTAGE_VS);
             bool uniform_blocks_continuous = true;
             for (int ub_index = 0; ub_index < SG_MAX_SHADERSTAGE_UBS; ub_index++) {
                 const sg_shader_uniform_block_desc* ub_desc = &stage_desc->uniform_blocks[ub_index];
@@ -16349,11 +19988,22 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
                 const sg_shader_storage_buffer_desc* sbuf_desc = &stage_desc->storage_buffers[sbuf_index];
                 if (sbuf_desc->used) {
                     _SG_VALIDATE(storage_buffers_continuous, VALIDATE_SHADERDESC_NO_CONT_STORAGEBUFFERS);
-                    _SG_VALIDATE(sbuf_desc->readonly, VALIDATE_SHADERDESC_STORAGEBUFFER_READONLY);
+                    _SG_VALIDATE(sbuf_desc->readonly || is_compute_stage, VALIDATE_SHADERDESC_STORAGEBUFFER_READONLY);
                 } else {
                     storage_buffers_continuous = false;
                 }
             }
+            bool storage_images_continuous = true;
+            for (int simg_index = 0; simg_index < SG_MAX_SHADERSTAGE_STORAGEIMAGES; simg_index++) {
+                const sg_shader_storage_image_desc* simg_desc = &stage_desc->storage_images[simg_index];
+                if (simg_desc->used) {
+                    _SG_VALIDATE(is_compute_stage, VALIDATE_SHADERDESC_STORAGEIMAGE_COMPUTE_ONLY);
+                    _SG_VALIDATE(storage_images_continuous, VALIDATE_SHADERDESC_NO_CONT_STORAGEIMAGES);
+                    _SG_VALIDATE(_sg_is_valid_storage_image_format(simg_desc->access_format), VALIDATE_SHADERDESC_STORAGEIMAGE_FORMAT);
+                } else {
+                    storage_images_continuous = false;
+                }
+            }
             bool images_continuous = true;
             int num_images = 0;
             for (int img_index = 0; img_index < SG_MAX_SHADERSTAGE_IMAGES; img_index++) {
@@ -16452,6 +20102,10 @@ _SOKOL_PRIVATE bool _sg_validate_pipeline_desc(const sg_pipeline_desc* desc) {
         _SG_VALIDATE(0 != shd, VALIDATE_PIPELINEDESC_SHADER);
         if (shd) {
             _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_PIPELINEDESC_SHADER);
+            _SG_VALIDATE(desc->compute == shd->cmn.is_compute, VALIDATE_PIPELINEDESC_COMPUTE_SHADER);
+            if (desc->compute) {
+                _SG_VALIDATE(desc->layout.attrs[0].format == SG_VERTEXFORMAT_INVALID, VALIDATE_PIPELINEDESC_COMPUTE_NO_LAYOUT);
+            }
             bool attrs_cont = true;
             for (int attr_index = 0; attr_index < SG_MAX_VERTEX_ATTRIBUTES; attr_index++) {
                 const sg_vertex_attr_state* a_state = &desc->layout.attrs[attr_index];
@@ -16471,6 +20125,29 @@ _SOKOL_PRIVATE bool _sg_validate_pipeline_desc(const sg_pipeline_desc* desc) {
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_pipeline_variant_desc(const _sg_pipeline_t* base_pip, const sg_pipeline_variant_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(base_pip);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_PIPELINEVARIANTDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_PIPELINEVARIANTDESC_CANARY);
+        _SG_VALIDATE(base_pip && (base_pip->slot.state == SG_RESOURCESTATE_VALID), VALIDATE_PIPELINEVARIANTDESC_BASE);
+        if (base_pip) {
+            // the shader may have been destroyed after the base pipeline was created
+            const _sg_shader_t* shd = _sg_lookup_shader(&_sg.pools, base_pip->cmn.shader_id.id);
+            _SG_VALIDATE(shd && (shd->slot.state == SG_RESOURCESTATE_VALID), VALIDATE_PIPELINEVARIANTDESC_SHADER);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_attachments_desc(const sg_attachments_desc* desc) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(desc);
@@ -16584,7 +20261,17 @@ _SOKOL_PRIVATE bool _sg_validate_begin_pass(const sg_pass* pass) {
         _sg_validate_begin();
         _SG_VALIDATE(pass->_start_canary == 0, VALIDATE_BEGINPASS_CANARY);
         _SG_VALIDATE(pass->_end_canary == 0, VALIDATE_BEGINPASS_CANARY);
-        if (pass->attachments.id == SG_INVALID_ID) {
+        if (pass->compute) {
+            // a compute pass has no attachments and no swapchain
+            _SG_VALIDATE(_sg.features.compute, VALIDATE_BEGINPASS_COMPUTE_NOT_SUPPORTED);
+            _SG_VALIDATE(pass->attachments.id == SG_INVALID_ID, VALIDATE_BEGINPASS_COMPUTE_EXPECT_NO_ATTACHMENTS);
+            const bool no_swapchain = (pass->swapchain.width == 0)
+                                   && (pass->swapchain.height == 0)
+                                   && (pass->swapchain.sample_count == 0)
+                                   && (pass->swapchain.color_format == _SG_PIXELFORMAT_DEFAULT)
+                                   && (pass->swapchain.depth_format == _SG_PIXELFORMAT_DEFAULT);
+            _SG_VALIDATE(no_swapchain, VALIDATE_BEGINPASS_COMPUTE_EXPECT_NO_SWAPCHAIN);
+        } else if (pass->attachments.id == SG_INVALID_ID) {
             // this is a swapchain pass
             _SG_VALIDATE(pass->swapchain.width > 0, VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_WIDTH);
             _SG_VALIDATE(pass->swapchain.height > 0, VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_HEIGHT);
@@ -16704,6 +20391,11 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
         SOKOL_ASSERT(pip->shader);
         _SG_VALIDATE(pip->shader->slot.id == pip->cmn.shader_id.id, VALIDATE_APIP_SHADER_EXISTS);
         _SG_VALIDATE(pip->shader->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_APIP_SHADER_VALID);
+        // compute pipelines must be used in compute passes, render pipelines in render passes
+        _SG_VALIDATE(pip->cmn.is_compute == _sg.cur_pass.is_compute, VALIDATE_APIP_PASS_TYPE);
+        if (pip->cmn.is_compute || _sg.cur_pass.is_compute) {
+            return _sg_validate_end();
+        }
         // check that pipeline attributes match current pass attributes
         if (_sg.cur_pass.atts_id.id != SG_INVALID_ID) {
             // an offscreen pass
@@ -16755,6 +20447,26 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABND_PIPELINE_VALID);
         SOKOL_ASSERT(pip->shader && (pip->cmn.shader_id.id == pip->shader->slot.id));
 
+        // compute pipelines only use the compute-stage bindings, which are checked
+        // against the internal vertex stage slot
+        const sg_stage_bindings* vs_bnd = &bindings->vs;
+        if (pip->cmn.is_compute) {
+            bool no_render_bindings = (bindings->index_buffer.id == SG_INVALID_ID);
+            for (int i = 0; i < SG_MAX_VERTEX_BUFFERS; i++) {
+                no_render_bindings &= (bindings->vertex_buffers[i].id == SG_INVALID_ID);
+            }
+            no_render_bindings &= _sg_validate_stage_bindings_empty(&bindings->vs);
+            no_render_bindings &= _sg_validate_stage_bindings_empty(&bindings->fs);
+            _SG_VALIDATE(no_render_bindings, VALIDATE_ABND_COMPUTE_BINDINGS);
+            vs_bnd = &bindings->cs;
+        } else {
+            _SG_VALIDATE(_sg_validate_stage_bindings_empty(&bindings->cs), VALIDATE_ABND_UNEXPECTED_CS_BINDINGS);
+            for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEIMAGES; i++) {
+                _SG_VALIDATE(bindings->vs.storage_images[i].id == SG_INVALID_ID, VALIDATE_ABND_CS_UNEXPECTED_STORAGEIMAGE_BINDING);
+                _SG_VALIDATE(bindings->fs.storage_images[i].id == SG_INVALID_ID, VALIDATE_ABND_CS_UNEXPECTED_STORAGEIMAGE_BINDING);
+            }
+        }
+
         // has expected vertex buffers, and vertex buffers still exist
         for (int i = 0; i < SG_MAX_VERTEX_BUFFERS; i++) {
             if (bindings->vertex_buffers[i].id != SG_INVALID_ID) {
@@ -16764,7 +20476,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                 _SG_VALIDATE(buf != 0, VALIDATE_ABND_VB_EXISTS);
                 if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
                     _SG_VALIDATE(SG_BUFFERTYPE_VERTEXBUFFER == buf->cmn.type, VALIDATE_ABND_VB_TYPE);
-                    _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_VB_OVERFLOW);
+                    _SG_VALIDATE(!buf->cmn.append_overflow || _sg_buffer_common_can_grow(&buf->cmn), VALIDATE_ABND_VB_OVERFLOW);
                 }
             } else {
                 // vertex buffer provided in a slot which has no vertex layout in pipeline
@@ -16786,7 +20498,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
             _SG_VALIDATE(buf != 0, VALIDATE_ABND_IB_EXISTS);
             if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
                 _SG_VALIDATE(SG_BUFFERTYPE_INDEXBUFFER == buf->cmn.type, VALIDATE_ABND_IB_TYPE);
-                _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_IB_OVERFLOW);
+                _SG_VALIDATE(!buf->cmn.append_overflow || _sg_buffer_common_can_grow(&buf->cmn), VALIDATE_ABND_IB_OVERFLOW);
             }
         }
 
@@ -16794,9 +20506,9 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGES; i++) {
             const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[SG_SHADERSTAGE_VS];
             if (stage->images[i].image_type != _SG_IMAGETYPE_DEFAULT) {
-                _SG_VALIDATE(bindings->vs.images[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_IMAGE_BINDING);
-                if (bindings->vs.images[i].id != SG_INVALID_ID) {
-                    const _sg_image_t* img = _sg_lookup_image(&_sg.pools, bindings->vs.images[i].id);
+                _SG_VALIDATE(vs_bnd->images[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_IMAGE_BINDING);
+                if (vs_bnd->images[i].id != SG_INVALID_ID) {
+                    const _sg_image_t* img = _sg_lookup_image(&_sg.pools, vs_bnd->images[i].id);
                     _SG_VALIDATE(img != 0, VALIDATE_ABND_VS_IMG_EXISTS);
                     if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
                         _SG_VALIDATE(img->cmn.type == stage->images[i].image_type, VALIDATE_ABND_VS_IMAGE_TYPE_MISMATCH);
@@ -16815,7 +20527,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                     }
                 }
             } else {
-                _SG_VALIDATE(bindings->vs.images[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_IMAGE_BINDING);
+                _SG_VALIDATE(vs_bnd->images[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_IMAGE_BINDING);
             }
         }
 
@@ -16823,9 +20535,9 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         for (int i = 0; i < SG_MAX_SHADERSTAGE_SAMPLERS; i++) {
             const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[SG_SHADERSTAGE_VS];
             if (stage->samplers[i].sampler_type != _SG_SAMPLERTYPE_DEFAULT) {
-                _SG_VALIDATE(bindings->vs.samplers[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_SAMPLER_BINDING);
-                if (bindings->vs.samplers[i].id != SG_INVALID_ID) {
-                    const _sg_sampler_t* smp = _sg_lookup_sampler(&_sg.pools, bindings->vs.samplers[i].id);
+                _SG_VALIDATE(vs_bnd->samplers[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_SAMPLER_BINDING);
+                if (vs_bnd->samplers[i].id != SG_INVALID_ID) {
+                    const _sg_sampler_t* smp = _sg_lookup_sampler(&_sg.pools, vs_bnd->samplers[i].id);
                     _SG_VALIDATE(smp != 0, VALIDATE_ABND_VS_SMP_EXISTS);
                     if (smp) {
                         if (stage->samplers[i].sampler_type == SG_SAMPLERTYPE_COMPARISON) {
@@ -16842,7 +20554,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                     }
                 }
             } else {
-                _SG_VALIDATE(bindings->vs.samplers[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_SAMPLER_BINDING);
+                _SG_VALIDATE(vs_bnd->samplers[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_SAMPLER_BINDING);
             }
         }
 
@@ -16850,16 +20562,16 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++) {
             const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[SG_SHADERSTAGE_VS];
             if (stage->storage_buffers[i].used) {
-                _SG_VALIDATE(bindings->vs.storage_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_STORAGEBUFFER_BINDING);
-                if (bindings->vs.storage_buffers[i].id != SG_INVALID_ID) {
-                    const _sg_buffer_t* sbuf = _sg_lookup_buffer(&_sg.pools, bindings->vs.storage_buffers[i].id);
+                _SG_VALIDATE(vs_bnd->storage_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_VS_EXPECTED_STORAGEBUFFER_BINDING);
+                if (vs_bnd->storage_buffers[i].id != SG_INVALID_ID) {
+                    const _sg_buffer_t* sbuf = _sg_lookup_buffer(&_sg.pools, vs_bnd->storage_buffers[i].id);
                     _SG_VALIDATE(sbuf != 0, VALIDATE_ABND_VS_STORAGEBUFFER_EXISTS);
                     if (sbuf) {
                         _SG_VALIDATE(sbuf->cmn.type == SG_BUFFERTYPE_STORAGEBUFFER, VALIDATE_ABND_VS_STORAGEBUFFER_BINDING_BUFFERTYPE);
                     }
                 }
             } else {
-                _SG_VALIDATE(bindings->vs.storage_buffers[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_STORAGEBUFFER_BINDING);
+                _SG_VALIDATE(vs_bnd->storage_buffers[i].id == SG_INVALID_ID, VALIDATE_ABND_VS_UNEXPECTED_STORAGEBUFFER_BINDING);
             }
         }
 
@@ -16936,6 +20648,27 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
             }
         }
 
+        // has expected compute shader storage images
+        if (pip->cmn.is_compute) {
+            for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEIMAGES; i++) {
+                const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[SG_SHADERSTAGE_VS];
+                if (i < stage->num_storage_images) {
+                    _SG_VALIDATE(bindings->cs.storage_images[i].id != SG_INVALID_ID, VALIDATE_ABND_CS_EXPECTED_STORAGEIMAGE_BINDING);
+                    if (bindings->cs.storage_images[i].id != SG_INVALID_ID) {
+                        const _sg_image_t* img = _sg_lookup_image(&_sg.pools, bindings->cs.storage_images[i].id);
+                        _SG_VALIDATE(img != 0, VALIDATE_ABND_CS_STORAGEIMAGE_EXISTS);
+                        if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+                            _SG_VALIDATE(img->cmn.storage_image, VALIDATE_ABND_CS_STORAGEIMAGE_USAGE);
+                            _SG_VALIDATE(img->cmn.type == stage->storage_images[i].image_type, VALIDATE_ABND_CS_STORAGEIMAGE_TYPE_MISMATCH);
+                            _SG_VALIDATE(img->cmn.pixel_format == stage->storage_images[i].access_format, VALIDATE_ABND_CS_STORAGEIMAGE_FORMAT);
+                        }
+                    }
+                } else {
+                    _SG_VALIDATE(bindings->cs.storage_images[i].id == SG_INVALID_ID, VALIDATE_ABND_CS_UNEXPECTED_STORAGEIMAGE_BINDING);
+                }
+            }
+        }
+
         return _sg_validate_end();
     #endif
 }
@@ -16950,7 +20683,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_uniforms(sg_shader_stage stage_index, int
         if (_sg.desc.disable_validation) {
             return true;
         }
-        SOKOL_ASSERT((stage_index == SG_SHADERSTAGE_VS) || (stage_index == SG_SHADERSTAGE_FS));
+        SOKOL_ASSERT((stage_index == SG_SHADERSTAGE_VS) || (stage_index == SG_SHADERSTAGE_FS) || (stage_index == SG_SHADERSTAGE_CS));
         SOKOL_ASSERT((ub_index >= 0) && (ub_index < SG_MAX_SHADERSTAGE_UBS));
         _sg_validate_begin();
         _SG_VALIDATE(_sg.cur_pipeline.id != SG_INVALID_ID, VALIDATE_AUB_NO_PIPELINE);
@@ -16958,8 +20691,14 @@ _SOKOL_PRIVATE bool _sg_validate_apply_uniforms(sg_shader_stage stage_index, int
         SOKOL_ASSERT(pip && (pip->slot.id == _sg.cur_pipeline.id));
         SOKOL_ASSERT(pip->shader && (pip->shader->slot.id == pip->cmn.shader_id.id));
 
+        // the compute stage is only valid with compute pipelines
+        _SG_VALIDATE(pip->cmn.is_compute == (stage_index == SG_SHADERSTAGE_CS), VALIDATE_AUB_STAGE);
+        if (pip->cmn.is_compute != (stage_index == SG_SHADERSTAGE_CS)) {
+            return _sg_validate_end();
+        }
+
         // check that there is a uniform block at 'stage' and 'ub_index'
-        const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[stage_index];
+        const _sg_shader_stage_t* stage = &pip->shader->cmn.stage[(stage_index == SG_SHADERSTAGE_CS) ? SG_SHADERSTAGE_VS : stage_index];
         _SG_VALIDATE(ub_index < stage->num_uniform_blocks, VALIDATE_AUB_NO_UB_AT_SLOT);
 
         // check that the provided data size matches the uniform block size
@@ -16969,6 +20708,41 @@ _SOKOL_PRIVATE bool _sg_validate_apply_uniforms(sg_shader_stage stage_index, int
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_draw(void) {
+    #if !defined(SOKOL_DEBUG)
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(!_sg.cur_pass.is_compute, VALIDATE_DRAW_COMPUTE_PASS);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(num_groups_x);
+        _SOKOL_UNUSED(num_groups_y);
+        _SOKOL_UNUSED(num_groups_z);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.is_compute, VALIDATE_DISPATCH_COMPUTE_PASS);
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, _sg.cur_pipeline.id);
+        _SG_VALIDATE((pip != 0) && pip->cmn.is_compute, VALIDATE_DISPATCH_NO_PIPELINE);
+        const bool x_valid = (num_groups_x >= 0) && (num_groups_x <= 65535);
+        const bool y_valid = (num_groups_y >= 0) && (num_groups_y <= 65535);
+        const bool z_valid = (num_groups_z >= 0) && (num_groups_z <= 65535);
+        _SG_VALIDATE(x_valid && y_valid && z_valid, VALIDATE_DISPATCH_NUM_GROUPS);
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_update_buffer(const _sg_buffer_t* buf, const sg_range* data) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(buf);
@@ -16984,6 +20758,29 @@ _SOKOL_PRIVATE bool _sg_validate_update_buffer(const _sg_buffer_t* buf, const sg
         _SG_VALIDATE(buf->cmn.size >= (int)data->size, VALIDATE_UPDATEBUF_SIZE);
         _SG_VALIDATE(buf->cmn.update_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_ONCE);
         _SG_VALIDATE(buf->cmn.append_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_APPEND);
+        _SG_VALIDATE(buf->cmn.update_range_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_RANGE);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_update_buffer_range(const _sg_buffer_t* buf, size_t offset, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(buf && data && data->ptr);
+        _sg_validate_begin();
+        _SG_VALIDATE(buf->cmn.usage != SG_USAGE_IMMUTABLE, VALIDATE_UPDATEBUFRANGE_USAGE);
+        _SG_VALIDATE((offset + data->size) <= (size_t)buf->cmn.size, VALIDATE_UPDATEBUFRANGE_SIZE);
+        _SG_VALIDATE(_sg_multiple_u64((uint64_t)offset, 4), VALIDATE_UPDATEBUFRANGE_OFFSET);
+        _SG_VALIDATE(_sg_multiple_u64((uint64_t)data->size, 4), VALIDATE_UPDATEBUFRANGE_SIZE_ALIGNMENT);
+        _SG_VALIDATE(buf->cmn.update_frame_index != _sg.frame_index, VALIDATE_UPDATEBUFRANGE_UPDATE);
+        _SG_VALIDATE(buf->cmn.append_frame_index != _sg.frame_index, VALIDATE_UPDATEBUFRANGE_APPEND);
         return _sg_validate_end();
     #endif
 }
@@ -17000,8 +20797,10 @@ _SOKOL_PRIVATE bool _sg_validate_append_buffer(const _sg_buffer_t* buf, const sg
         SOKOL_ASSERT(buf && data && data->ptr);
         _sg_validate_begin();
         _SG_VALIDATE(buf->cmn.usage != SG_USAGE_IMMUTABLE, VALIDATE_APPENDBUF_USAGE);
-        _SG_VALIDATE(buf->cmn.size >= (buf->cmn.append_pos + (int)data->size), VALIDATE_APPENDBUF_SIZE);
+        // growable buffers may overflow, they will be resized in the next frame
+        _SG_VALIDATE(_sg_buffer_common_can_grow(&buf->cmn) || (buf->cmn.size >= (buf->cmn.append_pos + (int)data->size)), VALIDATE_APPENDBUF_SIZE);
         _SG_VALIDATE(buf->cmn.update_frame_index != _sg.frame_index, VALIDATE_APPENDBUF_UPDATE);
+        _SG_VALIDATE(buf->cmn.update_range_frame_index != _sg.frame_index, VALIDATE_APPENDBUF_RANGE);
         return _sg_validate_end();
     #endif
 }
@@ -17024,12 +20823,149 @@ _SOKOL_PRIVATE bool _sg_validate_update_image(const _sg_image_t* img, const sg_i
             img->cmn.width,
             img->cmn.height,
             (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1,
+            0,
             img->cmn.num_mipmaps,
             img->cmn.num_slices);
         return _sg_validate_end();
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_update_image_mip(const _sg_image_t* img, int mip_level, const sg_image_data* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(mip_level);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(img && data);
+        _sg_validate_begin();
+        const bool valid_mip_level = (mip_level >= 0) && (mip_level < img->cmn.num_mipmaps);
+        _SG_VALIDATE(valid_mip_level, VALIDATE_UPDIMGMIP_MIPLEVEL);
+        if (valid_mip_level) {
+            _SG_VALIDATE(0 == (img->cmn.resident_mips & (1u << mip_level)), VALIDATE_UPDIMGMIP_RESIDENT);
+            _sg_validate_image_data(data,
+                img->cmn.pixel_format,
+                img->cmn.width,
+                img->cmn.height,
+                (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1,
+                mip_level,
+                mip_level + 1,
+                img->cmn.num_slices);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_read_image(const _sg_image_t* img, const sg_read_image_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(img && desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_READIMG_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_READIMG_CANARY);
+        _SG_VALIDATE(0 != desc->callback, VALIDATE_READIMG_CALLBACK);
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_READIMG_INPASS);
+        _SG_VALIDATE(img->cmn.render_target, VALIDATE_READIMG_RENDERTARGET);
+        _SG_VALIDATE(img->cmn.type == SG_IMAGETYPE_2D, VALIDATE_READIMG_IMAGETYPE);
+        _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_READIMG_SAMPLECOUNT);
+        _SG_VALIDATE(_sg_is_valid_rendertarget_color_format(img->cmn.pixel_format), VALIDATE_READIMG_COLORFORMAT);
+        _SG_VALIDATE((desc->x >= 0) && (desc->y >= 0) && (desc->width > 0) && (desc->height > 0) &&
+                     ((desc->x + desc->width) <= img->cmn.width) &&
+                     ((desc->y + desc->height) <= img->cmn.height), VALIDATE_READIMG_RECT);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_copy_buffer(const _sg_buffer_t* dst, size_t dst_offset, const _sg_buffer_t* src, size_t src_offset, size_t size) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(dst);
+        _SOKOL_UNUSED(dst_offset);
+        _SOKOL_UNUSED(src);
+        _SOKOL_UNUSED(src_offset);
+        _SOKOL_UNUSED(size);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(dst && src);
+        _sg_validate_begin();
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_COPYBUF_INPASS);
+        _SG_VALIDATE(dst->cmn.usage != SG_USAGE_IMMUTABLE, VALIDATE_COPYBUF_USAGE);
+        _SG_VALIDATE(_sg_multiple_u64((uint64_t)dst_offset, 4) &&
+                     _sg_multiple_u64((uint64_t)src_offset, 4) &&
+                     _sg_multiple_u64((uint64_t)size, 4), VALIDATE_COPYBUF_ALIGNMENT);
+        _SG_VALIDATE((src_offset + size) <= (size_t)src->cmn.size, VALIDATE_COPYBUF_SRC_RANGE);
+        _SG_VALIDATE((dst_offset + size) <= (size_t)dst->cmn.size, VALIDATE_COPYBUF_DST_RANGE);
+        if (dst == src) {
+            _SG_VALIDATE(((dst_offset + size) <= src_offset) || ((src_offset + size) <= dst_offset), VALIDATE_COPYBUF_OVERLAP);
+        }
+        _SG_VALIDATE((0 == dst->cmn.shadow) || (0 != src->cmn.shadow), VALIDATE_COPYBUF_SHADOW);
+        return _sg_validate_end();
+    #endif
+}
+
+#if defined(SOKOL_DEBUG)
+_SOKOL_PRIVATE bool _sg_validate_image_copy_location(const _sg_image_t* img, const sg_image_copy_location* loc, const sg_image_copy_desc* desc) {
+    if ((loc->mip_level < 0) || (loc->mip_level >= img->cmn.num_mipmaps)) {
+        return false;
+    }
+    int num_slices;
+    switch (img->cmn.type) {
+        case SG_IMAGETYPE_CUBE: num_slices = (int)SG_CUBEFACE_NUM; break;
+        case SG_IMAGETYPE_3D: num_slices = _sg_miplevel_dim(img->cmn.num_slices, loc->mip_level); break;
+        case SG_IMAGETYPE_ARRAY: num_slices = img->cmn.num_slices; break;
+        default: num_slices = 1; break;
+    }
+    return (loc->x >= 0) && (loc->y >= 0) && (loc->slice >= 0)
+        && (desc->width > 0) && (desc->height > 0) && (desc->num_slices > 0)
+        && ((loc->x + desc->width) <= _sg_miplevel_dim(img->cmn.width, loc->mip_level))
+        && ((loc->y + desc->height) <= _sg_miplevel_dim(img->cmn.height, loc->mip_level))
+        && ((loc->slice + desc->num_slices) <= num_slices);
+}
+#endif
+
+_SOKOL_PRIVATE bool _sg_validate_copy_image_region(const _sg_image_t* dst, const _sg_image_t* src, const sg_image_copy_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(dst);
+        _SOKOL_UNUSED(src);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(dst && src && desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_COPYIMG_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_COPYIMG_CANARY);
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_COPYIMG_INPASS);
+        _SG_VALIDATE((dst->cmn.usage != SG_USAGE_IMMUTABLE) || dst->cmn.render_target || dst->cmn.storage_image, VALIDATE_COPYIMG_USAGE);
+        _SG_VALIDATE(dst->cmn.pixel_format == src->cmn.pixel_format, VALIDATE_COPYIMG_FORMAT);
+        _SG_VALIDATE(!_sg_is_compressed_pixel_format(src->cmn.pixel_format), VALIDATE_COPYIMG_COMPRESSED);
+        _SG_VALIDATE((dst->cmn.sample_count == 1) && (src->cmn.sample_count == 1), VALIDATE_COPYIMG_SAMPLECOUNT);
+        _SG_VALIDATE(_sg_validate_image_copy_location(src, &desc->src, desc), VALIDATE_COPYIMG_SRC_REGION);
+        _SG_VALIDATE(_sg_validate_image_copy_location(dst, &desc->dst, desc), VALIDATE_COPYIMG_DST_REGION);
+        if ((dst == src) && (desc->dst.mip_level == desc->src.mip_level)) {
+            const bool disjoint =
+                ((desc->dst.x + desc->width) <= desc->src.x) || ((desc->src.x + desc->width) <= desc->dst.x) ||
+                ((desc->dst.y + desc->height) <= desc->src.y) || ((desc->src.y + desc->height) <= desc->dst.y) ||
+                ((desc->dst.slice + desc->num_slices) <= desc->src.slice) || ((desc->src.slice + desc->num_slices) <= desc->dst.slice);
+            _SG_VALIDATE(disjoint, VALIDATE_COPYIMG_OVERLAP);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 // ██████  ███████ ███████  ██████  ██    ██ ██████   ██████ ███████ ███████
 // ██   ██ ██      ██      ██    ██ ██    ██ ██   ██ ██      ██      ██
 // ██████  █████   ███████ ██    ██ ██    ██ ██████  ██      █████   ███████
@@ -17041,6 +20977,9 @@ _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* des
     sg_buffer_desc def = *desc;
     def.type = _sg_def(def.type, SG_BUFFERTYPE_VERTEXBUFFER);
     def.usage = _sg_def(def.usage, SG_USAGE_IMMUTABLE);
+    if (def.max_views > 0) {
+        def.view_alignment = _sg_def(def.view_alignment, 4);
+    }
     if (def.size == 0) {
         def.size = def.data.size;
     } else if (def.data.size == 0) {
@@ -17049,11 +20988,27 @@ _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* des
     return def;
 }
 
+_SOKOL_PRIVATE sg_read_image_desc _sg_read_image_desc_defaults(const _sg_image_t* img, const sg_read_image_desc* desc) {
+    sg_read_image_desc def = *desc;
+    def.width = _sg_def(def.width, img->cmn.width - def.x);
+    def.height = _sg_def(def.height, img->cmn.height - def.y);
+    return def;
+}
+
+_SOKOL_PRIVATE sg_image_copy_desc _sg_image_copy_desc_defaults(const _sg_image_t* src, const sg_image_copy_desc* desc) {
+    sg_image_copy_desc def = *desc;
+    def.width = _sg_def(def.width, _sg_miplevel_dim(src->cmn.width, def.src.mip_level) - def.src.x);
+    def.height = _sg_def(def.height, _sg_miplevel_dim(src->cmn.height, def.src.mip_level) - def.src.y);
+    def.num_slices = _sg_def(def.num_slices, 1);
+    return def;
+}
+
 _SOKOL_PRIVATE sg_image_desc _sg_image_desc_defaults(const sg_image_desc* desc) {
     sg_image_desc def = *desc;
     def.type = _sg_def(def.type, SG_IMAGETYPE_2D);
     def.num_slices = _sg_def(def.num_slices, 1);
     def.num_mipmaps = _sg_def(def.num_mipmaps, 1);
+    def.num_resident_mipmaps = _sg_def(def.num_resident_mipmaps, def.num_mipmaps);
     def.usage = _sg_def(def.usage, SG_USAGE_IMMUTABLE);
     if (desc->render_target) {
         def.pixel_format = _sg_def(def.pixel_format, _sg.desc.environment.defaults.color_format);
@@ -17132,40 +21087,38 @@ _SOKOL_PRIVATE sg_shader_desc _sg_shader_desc_defaults(const sg_shader_desc* des
     return def;
 }
 
-_SOKOL_PRIVATE sg_pipeline_desc _sg_pipeline_desc_defaults(const sg_pipeline_desc* desc) {
-    sg_pipeline_desc def = *desc;
+// NOTE: the render state defaults are shared with _sg_pipeline_variant_desc_defaults()
+_SOKOL_PRIVATE void _sg_stencil_state_defaults(sg_stencil_state* stencil) {
+    stencil->front.compare = _sg_def(stencil->front.compare, SG_COMPAREFUNC_ALWAYS);
+    stencil->front.fail_op = _sg_def(stencil->front.fail_op, SG_STENCILOP_KEEP);
+    stencil->front.depth_fail_op = _sg_def(stencil->front.depth_fail_op, SG_STENCILOP_KEEP);
+    stencil->front.pass_op = _sg_def(stencil->front.pass_op, SG_STENCILOP_KEEP);
+    stencil->back.compare = _sg_def(stencil->back.compare, SG_COMPAREFUNC_ALWAYS);
+    stencil->back.fail_op = _sg_def(stencil->back.fail_op, SG_STENCILOP_KEEP);
+    stencil->back.depth_fail_op = _sg_def(stencil->back.depth_fail_op, SG_STENCILOP_KEEP);
+    stencil->back.pass_op = _sg_def(stencil->back.pass_op, SG_STENCILOP_KEEP);
+}
 
-    def.primitive_type = _sg_def(def.primitive_type, SG_PRIMITIVETYPE_TRIANGLES);
-    def.index_type = _sg_def(def.index_type, SG_INDEXTYPE_NONE);
-    def.cull_mode = _sg_def(def.cull_mode, SG_CULLMODE_NONE);
-    def.face_winding = _sg_def(def.face_winding, SG_FACEWINDING_CW);
-    def.sample_count = _sg_def(def.sample_count, _sg.desc.environment.defaults.sample_count);
+_SOKOL_PRIVATE void _sg_depth_state_defaults(sg_depth_state* depth) {
+    depth->compare = _sg_def(depth->compare, SG_COMPAREFUNC_ALWAYS);
+    depth->pixel_format = _sg_def(depth->pixel_format, _sg.desc.environment.defaults.depth_format);
+}
 
-    def.stencil.front.compare = _sg_def(def.stencil.front.compare, SG_COMPAREFUNC_ALWAYS);
-    def.stencil.front.fail_op = _sg_def(def.stencil.front.fail_op, SG_STENCILOP_KEEP);
-    def.stencil.front.depth_fail_op = _sg_def(def.stencil.front.depth_fail_op, SG_STENCILOP_KEEP);
-    def.stencil.front.pass_op = _sg_def(def.stencil.front.pass_op, SG_STENCILOP_KEEP);
-    def.stencil.back.compare = _sg_def(def.stencil.back.compare, SG_COMPAREFUNC_ALWAYS);
-    def.stencil.back.fail_op = _sg_def(def.stencil.back.fail_op, SG_STENCILOP_KEEP);
-    def.stencil.back.depth_fail_op = _sg_def(def.stencil.back.depth_fail_op, SG_STENCILOP_KEEP);
-    def.stencil.back.pass_op = _sg_def(def.stencil.back.pass_op, SG_STENCILOP_KEEP);
-
-    def.depth.compare = _sg_def(def.depth.compare, SG_COMPAREFUNC_ALWAYS);
-    def.depth.pixel_format = _sg_def(def.depth.pixel_format, _sg.desc.environment.defaults.depth_format);
-    if (def.colors[0].pixel_format == SG_PIXELFORMAT_NONE) {
+_SOKOL_PRIVATE void _sg_color_targets_defaults(int* color_count, sg_color_target_state* colors) {
+    if (colors[0].pixel_format == SG_PIXELFORMAT_NONE) {
         // special case depth-only rendering, enforce a color count of 0
-        def.color_count = 0;
+        *color_count = 0;
     } else {
-        def.color_count = _sg_def(def.color_count, 1);
+        *color_count = _sg_def(*color_count, 1);
     }
-    if (def.color_count > SG_MAX_COLOR_ATTACHMENTS) {
-        def.color_count = SG_MAX_COLOR_ATTACHMENTS;
+    if (*color_count > SG_MAX_COLOR_ATTACHMENTS) {
+        *color_count = SG_MAX_COLOR_ATTACHMENTS;
     }
-    for (int i = 0; i < def.color_count; i++) {
-        sg_color_target_state* cs = &def.colors[i];
+    for (int i = 0; i < *color_count; i++) {
+        sg_color_target_state* cs = &colors[i];
         cs->pixel_format = _sg_def(cs->pixel_format, _sg.desc.environment.defaults.color_format);
         cs->write_mask = _sg_def(cs->write_mask, SG_COLORMASK_RGBA);
-        sg_blend_state* bs = &def.colors[i].blend;
+        sg_blend_state* bs = &colors[i].blend;
         bs->src_factor_rgb = _sg_def(bs->src_factor_rgb, SG_BLENDFACTOR_ONE);
         bs->dst_factor_rgb = _sg_def(bs->dst_factor_rgb, SG_BLENDFACTOR_ZERO);
         bs->op_rgb = _sg_def(bs->op_rgb, SG_BLENDOP_ADD);
@@ -17173,6 +21126,20 @@ _SOKOL_PRIVATE sg_pipeline_desc _sg_pipeline_desc_defaults(const sg_pipeline_des
         bs->dst_factor_alpha = _sg_def(bs->dst_factor_alpha, SG_BLENDFACTOR_ZERO);
         bs->op_alpha = _sg_def(bs->op_alpha, SG_BLENDOP_ADD);
     }
+}
+
+_SOKOL_PRIVATE sg_pipeline_desc _sg_pipeline_desc_defaults(const sg_pipeline_desc* desc) {
+    sg_pipeline_desc def = *desc;
+
+    def.primitive_type = _sg_def(def.primitive_type, SG_PRIMITIVETYPE_TRIANGLES);
+    def.index_type = _sg_def(def.index_type, SG_INDEXTYPE_NONE);
+    def.cull_mode = _sg_def(def.cull_mode, SG_CULLMODE_NONE);
+    def.face_winding = _sg_def(def.face_winding, SG_FACEWINDING_CW);
+    def.sample_count = _sg_def(def.sample_count, _sg.desc.environment.defaults.sample_count);
+
+    _sg_stencil_state_defaults(&def.stencil);
+    _sg_depth_state_defaults(&def.depth);
+    _sg_color_targets_defaults(&def.color_count, def.colors);
 
     for (int attr_index = 0; attr_index < SG_MAX_VERTEX_ATTRIBUTES; attr_index++) {
         sg_vertex_attr_state* a_state = &def.layout.attrs[attr_index];
@@ -17217,6 +21184,55 @@ _SOKOL_PRIVATE sg_pipeline_desc _sg_pipeline_desc_defaults(const sg_pipeline_des
     return def;
 }
 
+_SOKOL_PRIVATE sg_pipeline_variant_desc _sg_pipeline_variant_desc_defaults(const sg_pipeline_variant_desc* desc) {
+    sg_pipeline_variant_desc def = *desc;
+    if (def.override_depth) {
+        _sg_depth_state_defaults(&def.depth);
+    }
+    if (def.override_stencil) {
+        _sg_stencil_state_defaults(&def.stencil);
+    }
+    if (def.override_colors) {
+        _sg_color_targets_defaults(&def.color_count, def.colors);
+    }
+    return def;
+}
+
+// build the full pipeline desc of a variant from the resolved state of the base pipeline
+_SOKOL_PRIVATE sg_pipeline_desc _sg_pipeline_variant_resolve(const _sg_pipeline_t* base_pip, const sg_pipeline_variant_desc* desc) {
+    sg_pipeline_desc res;
+    _sg_clear(&res, sizeof(res));
+    if (0 == base_pip) {
+        return res;
+    }
+    const _sg_pipeline_common_t* base = &base_pip->cmn;
+    res.compute = base->is_compute;
+    res.shader = base->shader_id;
+    res.layout = base->layout;
+    res.depth = desc->override_depth ? desc->depth : base->depth;
+    res.stencil = desc->override_stencil ? desc->stencil : base->stencil;
+    if (desc->override_colors) {
+        res.color_count = desc->color_count;
+        for (int i = 0; i < desc->color_count; i++) {
+            res.colors[i] = desc->colors[i];
+        }
+    } else {
+        res.color_count = base->color_count;
+        for (int i = 0; i < base->color_count; i++) {
+            res.colors[i] = base->colors[i];
+        }
+    }
+    res.primitive_type = _sg_def(desc->primitive_type, base->primitive_type);
+    res.index_type = _sg_def(desc->index_type, base->index_type);
+    res.cull_mode = _sg_def(desc->cull_mode, base->cull_mode);
+    res.face_winding = _sg_def(desc->face_winding, base->face_winding);
+    res.sample_count = _sg_def(desc->sample_count, base->sample_count);
+    res.blend_color = desc->override_blend_color ? desc->blend_color : base->blend_color;
+    res.alpha_to_coverage_enabled = desc->override_alpha_to_coverage ? desc->alpha_to_coverage_enabled : base->alpha_to_coverage_enabled;
+    res.label = desc->label;
+    return res;
+}
+
 _SOKOL_PRIVATE sg_attachments_desc _sg_attachments_desc_defaults(const sg_attachments_desc* desc) {
     sg_attachments_desc def = *desc;
     return def;
@@ -17224,11 +21240,8 @@ _SOKOL_PRIVATE sg_attachments_desc _sg_attachments_desc_defaults(const sg_attach
 
 _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
     sg_buffer res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.buffer_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.buffer_pool, &_sg.pools.buffers[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.buffer_pool, _sg.pools.buffers, sizeof(_sg_buffer_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(BUFFER_POOL_EXHAUSTED);
     }
     return res;
@@ -17236,11 +21249,8 @@ _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
 
 _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
     sg_image res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.image_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.image_pool, &_sg.pools.images[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.image_pool, _sg.pools.images, sizeof(_sg_image_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(IMAGE_POOL_EXHAUSTED);
     }
     return res;
@@ -17248,11 +21258,8 @@ _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
 
 _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
     sg_sampler res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.sampler_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.sampler_pool, &_sg.pools.samplers[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.sampler_pool, _sg.pools.samplers, sizeof(_sg_sampler_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(SAMPLER_POOL_EXHAUSTED);
     }
     return res;
@@ -17260,11 +21267,8 @@ _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
 
 _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
     sg_shader res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.shader_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.shader_pool, &_sg.pools.shaders[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.shader_pool, _sg.pools.shaders, sizeof(_sg_shader_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(SHADER_POOL_EXHAUSTED);
     }
     return res;
@@ -17272,11 +21276,8 @@ _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
 
 _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
     sg_pipeline res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.pipeline_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id =_sg_slot_alloc(&_sg.pools.pipeline_pool, &_sg.pools.pipelines[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.pipeline_pool, _sg.pools.pipelines, sizeof(_sg_pipeline_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(PIPELINE_POOL_EXHAUSTED);
     }
     return res;
@@ -17284,11 +21285,8 @@ _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
 
 _SOKOL_PRIVATE sg_attachments _sg_alloc_attachments(void) {
     sg_attachments res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.attachments_pool);
-    if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.attachments_pool, &_sg.pools.attachments[slot_index].slot, slot_index);
-    } else {
-        res.id = SG_INVALID_ID;
+    res.id = _sg_pool_alloc_slot(&_sg.pools.attachments_pool, _sg.pools.attachments, sizeof(_sg_attachments_t));
+    if (SG_INVALID_ID == res.id) {
         _SG_ERROR(PASS_POOL_EXHAUSTED);
     }
     return res;
@@ -17296,38 +21294,995 @@ _SOKOL_PRIVATE sg_attachments _sg_alloc_attachments(void) {
 
 _SOKOL_PRIVATE void _sg_dealloc_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC) && (buf->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.buffer_pool, _sg_slot_index(buf->slot.id));
-    _sg_reset_slot(&buf->slot);
+    _sg_pool_free_slot(&_sg.pools.buffer_pool, &buf->slot);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_image(_sg_image_t* img) {
     SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC) && (img->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.image_pool, _sg_slot_index(img->slot.id));
-    _sg_reset_slot(&img->slot);
+    _sg_pool_free_slot(&_sg.pools.image_pool, &img->slot);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC) && (smp->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.sampler_pool, _sg_slot_index(smp->slot.id));
-    _sg_reset_slot(&smp->slot);
+    _sg_pool_free_slot(&_sg.pools.sampler_pool, &smp->slot);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC) && (shd->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.shader_pool, _sg_slot_index(shd->slot.id));
-    _sg_reset_slot(&shd->slot);
+    _sg_pool_free_slot(&_sg.pools.shader_pool, &shd->slot);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC) && (pip->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.pipeline_pool, _sg_slot_index(pip->slot.id));
-    _sg_reset_slot(&pip->slot);
+    _sg_pool_free_slot(&_sg.pools.pipeline_pool, &pip->slot);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_attachments(_sg_attachments_t* atts) {
     SOKOL_ASSERT(atts && (atts->slot.state == SG_RESOURCESTATE_ALLOC) && (atts->slot.id != SG_INVALID_ID));
-    _sg_pool_free_index(&_sg.pools.attachments_pool, _sg_slot_index(atts->slot.id));
-    _sg_reset_slot(&atts->slot);
+    _sg_pool_free_slot(&_sg.pools.attachments_pool, &atts->slot);
+}
+
+// first-fit allocation from the sorted free-list, returns -1 on failure
+_SOKOL_PRIVATE int _sg_buffer_views_alloc(_sg_buffer_common_t* cmn, int size) {
+    SOKOL_ASSERT(cmn->views.free && cmn->views.live && (size > 0));
+    if (cmn->views.num_views >= cmn->views.max_views) {
+        _SG_WARN(BUFFER_VIEWS_EXHAUSTED);
+        return -1;
+    }
+    for (int i = 0; i < cmn->views.num_free; i++) {
+        _sg_buffer_range_t* range = &cmn->views.free[i];
+        if (range->size >= size) {
+            const int offset = range->offset;
+            range->offset += size;
+            range->size -= size;
+            if (range->size == 0) {
+                for (int j = i + 1; j < cmn->views.num_free; j++) {
+                    cmn->views.free[j - 1] = cmn->views.free[j];
+                }
+                cmn->views.num_free--;
+            }
+            _sg_buffer_range_t* live = &cmn->views.live[cmn->views.num_views++];
+            live->offset = offset;
+            live->size = size;
+            return offset;
+        }
+    }
+    _SG_WARN(BUFFER_VIEW_OUT_OF_MEMORY);
+    return -1;
+}
+
+// return a range to the sorted free-list, merging with adjacent free ranges,
+// the range must exactly match a currently allocated view
+_SOKOL_PRIVATE bool _sg_buffer_views_free(_sg_buffer_common_t* cmn, int offset, int size) {
+    SOKOL_ASSERT(cmn->views.free && cmn->views.live);
+    int live_index = -1;
+    for (int i = 0; i < cmn->views.num_views; i++) {
+        if ((cmn->views.live[i].offset == offset) && (cmn->views.live[i].size == size)) {
+            live_index = i;
+            break;
+        }
+    }
+    if (live_index < 0) {
+        return false;
+    }
+    // find the first free range behind the freed range
+    int i = 0;
+    while ((i < cmn->views.num_free) && (cmn->views.free[i].offset < offset)) {
+        i++;
+    }
+    _sg_buffer_range_t* prev = (i > 0) ? &cmn->views.free[i - 1] : 0;
+    _sg_buffer_range_t* next = (i < cmn->views.num_free) ? &cmn->views.free[i] : 0;
+    // freed range must not overlap any free range
+    if ((prev && ((prev->offset + prev->size) > offset)) || (next && ((offset + size) > next->offset))) {
+        return false;
+    }
+    const bool merge_prev = prev && ((prev->offset + prev->size) == offset);
+    const bool merge_next = next && ((offset + size) == next->offset);
+    if (merge_prev && merge_next) {
+        prev->size += size + next->size;
+        for (int j = i + 1; j < cmn->views.num_free; j++) {
+            cmn->views.free[j - 1] = cmn->views.free[j];
+        }
+        cmn->views.num_free--;
+    } else if (merge_prev) {
+        prev->size += size;
+    } else if (merge_next) {
+        next->offset = offset;
+        next->size += size;
+    } else {
+        // n live views leave at most n+1 free ranges, so this can't happen
+        // unless the free-list is corrupted, but never write out of bounds
+        if (cmn->views.num_free > cmn->views.max_views) {
+            SOKOL_ASSERT(false);
+            return false;
+        }
+        for (int j = cmn->views.num_free; j > i; j--) {
+            cmn->views.free[j] = cmn->views.free[j - 1];
+        }
+        cmn->views.free[i].offset = offset;
+        cmn->views.free[i].size = size;
+        cmn->views.num_free++;
+    }
+    cmn->views.live[live_index] = cmn->views.live[--cmn->views.num_views];
+    return true;
+}
+
+// shader and pipeline manifests (see sg_export_manifest() and sg_prewarm())
+#define _SG_MANIFEST_VERSION (2)
+
+_SOKOL_PRIVATE void _sg_bytes_append(_sg_bytes_t* bytes, const void* ptr, size_t num_bytes) {
+    if (0 == num_bytes) {
+        return;
+    }
+    const size_t required = bytes->size + num_bytes;
+    if (required > bytes->capacity) {
+        size_t new_capacity = _sg_max(bytes->capacity, (size_t)1024);
+        while (new_capacity < required) {
+            new_capacity *= 2;
+        }
+        uint8_t* new_ptr = (uint8_t*) _sg_malloc(new_capacity);
+        if (bytes->ptr) {
+            memcpy(new_ptr, bytes->ptr, bytes->size);
+            _sg_free(bytes->ptr);
+        }
+        bytes->ptr = new_ptr;
+        bytes->capacity = new_capacity;
+    }
+    memcpy(bytes->ptr + bytes->size, ptr, num_bytes);
+    bytes->size += num_bytes;
+}
+
+_SOKOL_PRIVATE void _sg_bytes_discard(_sg_bytes_t* bytes) {
+    if (bytes->ptr) {
+        _sg_free(bytes->ptr);
+    }
+    _sg_clear(bytes, sizeof(_sg_bytes_t));
+}
+
+// called when the backend's uniform bindings may have changed (new pass or pipeline)
+_SOKOL_PRIVATE void _sg_uniform_cache_invalidate(void) {
+    _sg_clear(&_sg.ub_cache.valid, sizeof(_sg.ub_cache.valid));
+}
+
+// returns true if the uniform data is identical with the last applied
+// data for the same uniform block, otherwise keeps a copy of the data
+_SOKOL_PRIVATE bool _sg_uniform_cache_match(sg_shader_stage stage, int ub_index, const sg_range* data) {
+    _sg_bytes_t* bytes = &_sg.ub_cache.data[stage][ub_index];
+    if (_sg.ub_cache.valid[stage][ub_index] && (bytes->size == data->size) && (0 == memcmp(bytes->ptr, data->ptr, data->size))) {
+        return true;
+    }
+    bytes->size = 0;
+    _sg_bytes_append(bytes, data->ptr, data->size);
+    _sg.ub_cache.valid[stage][ub_index] = true;
+    return false;
+}
+
+_SOKOL_PRIVATE void _sg_discard_uniform_cache(void) {
+    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
+        for (int ub_index = 0; ub_index < SG_MAX_SHADERSTAGE_UBS; ub_index++) {
+            _sg_bytes_discard(&_sg.ub_cache.data[stage][ub_index]);
+        }
+    }
+    _sg_uniform_cache_invalidate();
+}
+
+// issue the held back draw, must be called before anything which changes
+// the backend state the held back draw depends on
+_SOKOL_PRIVATE void _sg_flush_pending_draw(void) {
+    if (_sg.coalesce.pending) {
+        _sg.coalesce.pending = false;
+        _sg_draw(_sg.coalesce.base_element, _sg.coalesce.num_elements, _sg.coalesce.num_instances);
+    }
+}
+
+// only lists of independent primitives can be merged, strips would
+// connect the last primitive of one draw with the first of the next
+_SOKOL_PRIVATE int _sg_coalesce_prim_vertices(sg_primitive_type prim_type) {
+    switch (prim_type) {
+        case SG_PRIMITIVETYPE_POINTS: return 1;
+        case SG_PRIMITIVETYPE_LINES: return 2;
+        case SG_PRIMITIVETYPE_TRIANGLES: return 3;
+        default: return 0;
+    }
+}
+
+// merge a draw into the held back draw if it continues the element range,
+// otherwise issue the held back draw and hold back the new draw instead
+// NOTE: instanced draws are never merged since this would change the draw order
+_SOKOL_PRIVATE void _sg_coalesce_draw(int base_element, int num_elements, int num_instances) {
+    _sg_draw_coalesce_t* c = &_sg.coalesce;
+    SOKOL_ASSERT(c->prim_vertices > 0);
+    if (c->pending && (c->num_instances == 1) && (num_instances == 1) && ((c->base_element + c->num_elements) == base_element)
+        && ((c->num_elements % c->prim_vertices) == 0) && ((num_elements % c->prim_vertices) == 0))
+    {
+        c->num_elements += num_elements;
+        _sg_stats_add(num_coalesced_draws, 1);
+        return;
+    }
+    _sg_flush_pending_draw();
+    c->pending = true;
+    c->base_element = base_element;
+    c->num_elements = num_elements;
+    c->num_instances = num_instances;
+}
+
+// called before new bindings are applied in the backend
+_SOKOL_PRIVATE void _sg_coalesce_apply_bindings(const sg_bindings* bindings) {
+    _sg_draw_coalesce_t* c = &_sg.coalesce;
+    if (!c->bindings_valid || (0 != memcmp(&c->bindings, bindings, sizeof(sg_bindings)))) {
+        _sg_flush_pending_draw();
+        c->bindings = *bindings;
+        c->bindings_valid = true;
+    }
+}
+
+// FNV-1a, 0 is reserved for 'no hash'
+_SOKOL_PRIVATE uint64_t _sg_manifest_hash(const uint8_t* ptr, size_t num_bytes) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < num_bytes; i++) {
+        hash ^= ptr[i];
+        hash *= 0x00000100000001B3ULL;
+    }
+    return (0 == hash) ? 1 : hash;
+}
+
+// A symmetric serializer: the same visitor functions encode a desc struct
+// into a byte array, or decode a byte array into a desc struct. Integers
+// are stored as varints, arrays only up to the last used item, strings
+// and byte ranges are decoded as pointers into the source data.
+typedef struct {
+    bool reading;
+    bool error;
+    _sg_bytes_t* out;
+    const uint8_t* ptr;
+    const uint8_t* end;
+} _sg_mio_t;
+
+_SOKOL_PRIVATE _sg_mio_t _sg_mio_writer(_sg_bytes_t* out) {
+    _sg_mio_t io;
+    _sg_clear(&io, sizeof(io));
+    io.out = out;
+    return io;
+}
+
+_SOKOL_PRIVATE _sg_mio_t _sg_mio_reader(const uint8_t* ptr, size_t num_bytes) {
+    _sg_mio_t io;
+    _sg_clear(&io, sizeof(io));
+    io.reading = true;
+    io.ptr = ptr;
+    io.end = ptr + num_bytes;
+    return io;
+}
+
+_SOKOL_PRIVATE void _sg_mio_bytes(_sg_mio_t* io, void* ptr, size_t num_bytes) {
+    if (io->reading) {
+        if (io->error || ((size_t)(io->end - io->ptr) < num_bytes)) {
+            io->error = true;
+            _sg_clear(ptr, num_bytes);
+            return;
+        }
+        memcpy(ptr, io->ptr, num_bytes);
+        io->ptr += num_bytes;
+    } else {
+        _sg_bytes_append(io->out, ptr, num_bytes);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mio_u64(_sg_mio_t* io, uint64_t* val) {
+    if (io->reading) {
+        uint64_t res = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b;
+            _sg_mio_bytes(io, &b, 1);
+            res |= ((uint64_t)(b & 0x7F)) << shift;
+            if (0 == (b & 0x80)) {
+                *val = res;
+                return;
+            }
+        }
+        io->error = true;
+        *val = 0;
+    } else {
+        uint64_t v = *val;
+        do {
+            uint8_t b = (uint8_t)(v & 0x7F);
+            v >>= 7;
+            if (v != 0) {
+                b |= 0x80;
+            }
+            _sg_mio_bytes(io, &b, 1);
+        } while (v != 0);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mio_int(_sg_mio_t* io, int* val) {
+    // zigzag-encoded so that small negative numbers stay small
+    uint64_t u = 0;
+    if (!io->reading) {
+        const int64_t v = *val;
+        u = (((uint64_t)v) << 1) ^ ((uint64_t)(v >> 63));
+    }
+    _sg_mio_u64(io, &u);
+    if (io->reading) {
+        *val = (int)(int64_t)((u >> 1) ^ (~(u & 1) + 1));
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mio_size(_sg_mio_t* io, size_t* val) {
+    uint64_t u = *val;
+    _sg_mio_u64(io, &u);
+    *val = (size_t)u;
+}
+
+_SOKOL_PRIVATE void _sg_mio_bool(_sg_mio_t* io, bool* val) {
+    uint8_t b = *val ? 1 : 0;
+    _sg_mio_bytes(io, &b, 1);
+    *val = (b != 0);
+}
+
+_SOKOL_PRIVATE void _sg_mio_float(_sg_mio_t* io, float* val) {
+    _sg_mio_bytes(io, val, sizeof(float));
+}
+
+_SOKOL_PRIVATE void _sg_mio_str(_sg_mio_t* io, const char** str) {
+    // 0 for a null pointer, otherwise string length + 1, followed by the string and terminating zero
+    uint64_t len = 0;
+    if (!io->reading && *str) {
+        len = strlen(*str) + 1;
+    }
+    _sg_mio_u64(io, &len);
+    if (io->reading) {
+        *str = 0;
+        if (len > 0) {
+            if (io->error || ((uint64_t)(io->end - io->ptr) < len) || (io->ptr[len - 1] != 0)) {
+                io->error = true;
+                return;
+            }
+            *str = (const char*) io->ptr;
+            io->ptr += len;
+        }
+    } else {
+        _sg_bytes_append(io->out, *str, (size_t)len);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mio_range(_sg_mio_t* io, sg_range* range) {
+    uint64_t size = range->ptr ? range->size : 0;
+    _sg_mio_u64(io, &size);
+    if (io->reading) {
+        range->ptr = 0;
+        range->size = 0;
+        if (size > 0) {
+            if (io->error || ((uint64_t)(io->end - io->ptr) < size)) {
+                io->error = true;
+                return;
+            }
+            range->ptr = io->ptr;
+            range->size = (size_t)size;
+            io->ptr += size;
+        }
+    } else {
+        _sg_bytes_append(io->out, range->ptr, (size_t)size);
+    }
+}
+
+// write or read an array item count, returns 0 for out-of-range counts
+_SOKOL_PRIVATE int _sg_mio_count(_sg_mio_t* io, int count, int max_count) {
+    _sg_mio_int(io, &count);
+    if ((count < 0) || (count > max_count)) {
+        io->error = true;
+        count = 0;
+    }
+    return count;
+}
+
+#define _SG_MIO_ENUM(io, val, type) { int _sg_mio_i = (int)(val); _sg_mio_int(io, &_sg_mio_i); (val) = (type)_sg_mio_i; }
+
+_SOKOL_PRIVATE void _sg_mio_shader_stage(_sg_mio_t* io, sg_shader_stage_desc* stage) {
+    _sg_mio_str(io, &stage->source);
+    _sg_mio_range(io, &stage->bytecode);
+    _sg_mio_str(io, &stage->entry);
+    _sg_mio_str(io, &stage->d3d11_target);
+
+    int num_ubs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_UBS); i++) {
+        if (stage->uniform_blocks[i].size > 0) {
+            num_ubs = i + 1;
+        }
+    }
+    num_ubs = _sg_mio_count(io, num_ubs, SG_MAX_SHADERSTAGE_UBS);
+    for (int ub_index = 0; ub_index < num_ubs; ub_index++) {
+        sg_shader_uniform_block_desc* ub = &stage->uniform_blocks[ub_index];
+        _sg_mio_size(io, &ub->size);
+        _SG_MIO_ENUM(io, ub->layout, sg_uniform_layout);
+        int num_uniforms = 0;
+        for (int i = 0; !io->reading && (i < SG_MAX_UB_MEMBERS); i++) {
+            if (ub->uniforms[i].type != SG_UNIFORMTYPE_INVALID) {
+                num_uniforms = i + 1;
+            }
+        }
+        num_uniforms = _sg_mio_count(io, num_uniforms, SG_MAX_UB_MEMBERS);
+        for (int u_index = 0; u_index < num_uniforms; u_index++) {
+            sg_shader_uniform_desc* u = &ub->uniforms[u_index];
+            _sg_mio_str(io, &u->name);
+            _SG_MIO_ENUM(io, u->type, sg_uniform_type);
+            _sg_mio_int(io, &u->array_count);
+        }
+    }
+
+    int num_sbufs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS); i++) {
+        if (stage->storage_buffers[i].used) {
+            num_sbufs = i + 1;
+        }
+    }
+    num_sbufs = _sg_mio_count(io, num_sbufs, SG_MAX_SHADERSTAGE_STORAGEBUFFERS);
+    for (int sbuf_index = 0; sbuf_index < num_sbufs; sbuf_index++) {
+        sg_shader_storage_buffer_desc* sbuf = &stage->storage_buffers[sbuf_index];
+        _sg_mio_bool(io, &sbuf->used);
+        _sg_mio_bool(io, &sbuf->readonly);
+    }
+
+    int num_images = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_IMAGES); i++) {
+        if (stage->images[i].used) {
+            num_images = i + 1;
+        }
+    }
+    num_images = _sg_mio_count(io, num_images, SG_MAX_SHADERSTAGE_IMAGES);
+    for (int img_index = 0; img_index < num_images; img_index++) {
+        sg_shader_image_desc* img = &stage->images[img_index];
+        _sg_mio_bool(io, &img->used);
+        _sg_mio_bool(io, &img->multisampled);
+        _SG_MIO_ENUM(io, img->image_type, sg_image_type);
+        _SG_MIO_ENUM(io, img->sample_type, sg_image_sample_type);
+    }
+
+    int num_samplers = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_SAMPLERS); i++) {
+        if (stage->samplers[i].used) {
+            num_samplers = i + 1;
+        }
+    }
+    num_samplers = _sg_mio_count(io, num_samplers, SG_MAX_SHADERSTAGE_SAMPLERS);
+    for (int smp_index = 0; smp_index < num_samplers; smp_index++) {
+        sg_shader_sampler_desc* smp = &stage->samplers[smp_index];
+        _sg_mio_bool(io, &smp->used);
+        _SG_MIO_ENUM(io, smp->sampler_type, sg_sampler_type);
+    }
+
+    int num_pairs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS); i++) {
+        if (stage->image_sampler_pairs[i].used) {
+            num_pairs = i + 1;
+        }
+    }
+    num_pairs = _sg_mio_count(io, num_pairs, SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS);
+    for (int pair_index = 0; pair_index < num_pairs; pair_index++) {
+        sg_shader_image_sampler_pair_desc* pair = &stage->image_sampler_pairs[pair_index];
+        _sg_mio_bool(io, &pair->used);
+        _sg_mio_int(io, &pair->image_slot);
+        _sg_mio_int(io, &pair->sampler_slot);
+        _sg_mio_str(io, &pair->glsl_name);
+    }
+
+    int num_simgs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_SHADERSTAGE_STORAGEIMAGES); i++) {
+        if (stage->storage_images[i].used) {
+            num_simgs = i + 1;
+        }
+    }
+    num_simgs = _sg_mio_count(io, num_simgs, SG_MAX_SHADERSTAGE_STORAGEIMAGES);
+    for (int simg_index = 0; simg_index < num_simgs; simg_index++) {
+        sg_shader_storage_image_desc* simg = &stage->storage_images[simg_index];
+        _sg_mio_bool(io, &simg->used);
+        _SG_MIO_ENUM(io, simg->image_type, sg_image_type);
+        _SG_MIO_ENUM(io, simg->access_format, sg_pixel_format);
+        _sg_mio_bool(io, &simg->readonly);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mio_shader(_sg_mio_t* io, sg_shader_desc* desc) {
+    int num_attrs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_VERTEX_ATTRIBUTES); i++) {
+        const sg_shader_attr_desc* attr = &desc->attrs[i];
+        if (attr->name || attr->sem_name || (attr->sem_index != 0)) {
+            num_attrs = i + 1;
+        }
+    }
+    num_attrs = _sg_mio_count(io, num_attrs, SG_MAX_VERTEX_ATTRIBUTES);
+    for (int attr_index = 0; attr_index < num_attrs; attr_index++) {
+        sg_shader_attr_desc* attr = &desc->attrs[attr_index];
+        _sg_mio_str(io, &attr->name);
+        _sg_mio_str(io, &attr->sem_name);
+        _sg_mio_int(io, &attr->sem_index);
+    }
+    _sg_mio_shader_stage(io, &desc->vs);
+    _sg_mio_shader_stage(io, &desc->fs);
+    _sg_mio_shader_stage(io, &desc->cs);
+    _sg_mio_str(io, &desc->label);
+}
+
+// NOTE: the shader handle is replaced with the hash of the shader's creation params
+_SOKOL_PRIVATE void _sg_mio_pipeline(_sg_mio_t* io, sg_pipeline_desc* desc, uint64_t* shader_hash) {
+    _sg_mio_bytes(io, shader_hash, sizeof(uint64_t));
+    _sg_mio_bool(io, &desc->compute);
+    for (int buf_index = 0; buf_index < SG_MAX_VERTEX_BUFFERS; buf_index++) {
+        sg_vertex_buffer_layout_state* buf = &desc->layout.buffers[buf_index];
+        _sg_mio_int(io, &buf->stride);
+        _SG_MIO_ENUM(io, buf->step_func, sg_vertex_step);
+        _sg_mio_int(io, &buf->step_rate);
+    }
+    int num_attrs = 0;
+    for (int i = 0; !io->reading && (i < SG_MAX_VERTEX_ATTRIBUTES); i++) {
+        if (desc->layout.attrs[i].format != SG_VERTEXFORMAT_INVALID) {
+            num_attrs = i + 1;
+        }
+    }
+    num_attrs = _sg_mio_count(io, num_attrs, SG_MAX_VERTEX_ATTRIBUTES);
+    for (int attr_index = 0; attr_index < num_attrs; attr_index++) {
+        sg_vertex_attr_state* attr = &desc->layout.attrs[attr_index];
+        _sg_mio_int(io, &attr->buffer_index);
+        _sg_mio_int(io, &attr->offset);
+        _SG_MIO_ENUM(io, attr->format, sg_vertex_format);
+    }
+    _SG_MIO_ENUM(io, desc->depth.pixel_format, sg_pixel_format);
+    _SG_MIO_ENUM(io, desc->depth.compare, sg_compare_func);
+    _sg_mio_bool(io, &desc->depth.write_enabled);
+    _sg_mio_float(io, &desc->depth.bias);
+    _sg_mio_float(io, &desc->depth.bias_slope_scale);
+    _sg_mio_float(io, &desc->depth.bias_clamp);
+    _sg_mio_bool(io, &desc->stencil.enabled);
+    for (int face_index = 0; face_index < 2; face_index++) {
+        sg_stencil_face_state* face = (face_index == 0) ? &desc->stencil.front : &desc->stencil.back;
+        _SG_MIO_ENUM(io, face->compare, sg_compare_func);
+        _SG_MIO_ENUM(io, face->fail_op, sg_stencil_op);
+        _SG_MIO_ENUM(io, face->depth_fail_op, sg_stencil_op);
+        _SG_MIO_ENUM(io, face->pass_op, sg_stencil_op);
+    }
+    _sg_mio_bytes(io, &desc->stencil.read_mask, 1);
+    _sg_mio_bytes(io, &desc->stencil.write_mask, 1);
+    _sg_mio_bytes(io, &desc->stencil.ref, 1);
+    desc->color_count = _sg_mio_count(io, desc->color_count, SG_MAX_COLOR_ATTACHMENTS);
+    for (int color_index = 0; color_index < desc->color_count; color_index++) {
+        sg_color_target_state* color = &desc->colors[color_index];
+        _SG_MIO_ENUM(io, color->pixel_format, sg_pixel_format);
+        _SG_MIO_ENUM(io, color->write_mask, sg_color_mask);
+        _sg_mio_bool(io, &color->blend.enabled);
+        _SG_MIO_ENUM(io, color->blend.src_factor_rgb, sg_blend_factor);
+        _SG_MIO_ENUM(io, color->blend.dst_factor_rgb, sg_blend_factor);
+        _SG_MIO_ENUM(io, color->blend.op_rgb, sg_blend_op);
+        _SG_MIO_ENUM(io, color->blend.src_factor_alpha, sg_blend_factor);
+        _SG_MIO_ENUM(io, color->blend.dst_factor_alpha, sg_blend_factor);
+        _SG_MIO_ENUM(io, color->blend.op_alpha, sg_blend_op);
+    }
+    _SG_MIO_ENUM(io, desc->primitive_type, sg_primitive_type);
+    _SG_MIO_ENUM(io, desc->index_type, sg_index_type);
+    _SG_MIO_ENUM(io, desc->cull_mode, sg_cull_mode);
+    _SG_MIO_ENUM(io, desc->face_winding, sg_face_winding);
+    _sg_mio_int(io, &desc->sample_count);
+    _sg_mio_float(io, &desc->blend_color.r);
+    _sg_mio_float(io, &desc->blend_color.g);
+    _sg_mio_float(io, &desc->blend_color.b);
+    _sg_mio_float(io, &desc->blend_color.a);
+    _sg_mio_bool(io, &desc->alpha_to_coverage_enabled);
+    _sg_mio_str(io, &desc->label);
+}
+
+// encode creation params into _sg.manifest.scratch and return their hash
+_SOKOL_PRIVATE uint64_t _sg_manifest_encode_shader(const sg_shader_desc* desc) {
+    sg_shader_desc tmp = *desc;
+    _sg.manifest.scratch.size = 0;
+    _sg_mio_t io = _sg_mio_writer(&_sg.manifest.scratch);
+    _sg_mio_shader(&io, &tmp);
+    return _sg_manifest_hash(_sg.manifest.scratch.ptr, _sg.manifest.scratch.size);
+}
+
+_SOKOL_PRIVATE uint64_t _sg_manifest_encode_pipeline(const sg_pipeline_desc* desc, uint64_t shader_hash) {
+    sg_pipeline_desc tmp = *desc;
+    _sg.manifest.scratch.size = 0;
+    _sg_mio_t io = _sg_mio_writer(&_sg.manifest.scratch);
+    _sg_mio_pipeline(&io, &tmp, &shader_hash);
+    return _sg_manifest_hash(_sg.manifest.scratch.ptr, _sg.manifest.scratch.size);
+}
+
+_SOKOL_PRIVATE bool _sg_manifest_active(void) {
+    return _sg.desc.record_manifest || (_sg.prewarm.num_entries > 0);
+}
+
+// true if the encoded params in _sg.manifest.scratch are identical with ptr/size,
+// the hash alone isn't enough since collisions would hand out the wrong resource
+_SOKOL_PRIVATE bool _sg_manifest_scratch_equal(const uint8_t* ptr, size_t size) {
+    return (_sg.manifest.scratch.size == size) && (0 == memcmp(_sg.manifest.scratch.ptr, ptr, size));
+}
+
+// add the encoded params in _sg.manifest.scratch as new entry, returns entry index + 1
+_SOKOL_PRIVATE int _sg_manifest_record(int kind, uint64_t hash) {
+    _sg_manifest_t* mf = &_sg.manifest;
+    for (int i = 0; i < mf->num_entries; i++) {
+        const _sg_manifest_entry_t* entry = &mf->entries[i];
+        if ((entry->kind == kind) && (entry->hash == hash) && _sg_manifest_scratch_equal(mf->data.ptr + entry->offset, entry->size)) {
+            return i + 1;
+        }
+    }
+    if (mf->num_entries == mf->capacity) {
+        const int new_capacity = _sg_max(mf->capacity * 2, 64);
+        _sg_manifest_entry_t* new_entries = (_sg_manifest_entry_t*) _sg_malloc_clear((size_t)new_capacity * sizeof(_sg_manifest_entry_t));
+        if (mf->entries) {
+            memcpy(new_entries, mf->entries, (size_t)mf->num_entries * sizeof(_sg_manifest_entry_t));
+            _sg_free(mf->entries);
+        }
+        mf->entries = new_entries;
+        mf->capacity = new_capacity;
+    }
+    _sg_manifest_entry_t* entry = &mf->entries[mf->num_entries++];
+    entry->kind = kind;
+    entry->hash = hash;
+    entry->first_use = 0;
+    entry->offset = mf->data.size;
+    entry->size = mf->scratch.size;
+    _sg_bytes_append(&mf->data, mf->scratch.ptr, mf->scratch.size);
+    return mf->num_entries;
+}
+
+// find a prewarm entry matching the encoded params in _sg.manifest.scratch
+_SOKOL_PRIVATE _sg_prewarm_entry_t* _sg_prewarm_find(int kind, uint64_t hash, _sg_prewarm_state_t state) {
+    for (int i = 0; i < _sg.prewarm.num_entries; i++) {
+        _sg_prewarm_entry_t* entry = &_sg.prewarm.entries[i];
+        if ((entry->kind == kind) && (entry->hash == hash) && (entry->state == state) && _sg_manifest_scratch_equal(entry->ptr, entry->size)) {
+            return entry;
+        }
+    }
+    return 0;
+}
+
+// a resource matching a pending prewarm entry was created by the application, don't create it again
+_SOKOL_PRIVATE void _sg_prewarm_claim_pending(int kind, uint64_t hash, uint32_t res_id) {
+    _sg_prewarm_entry_t* entry = _sg_prewarm_find(kind, hash, _SG_PREWARM_PENDING);
+    if (entry) {
+        entry->state = _SG_PREWARM_CLAIMED;
+        entry->res_id = res_id;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_manifest_track_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    if (!_sg_manifest_active() || (shd->slot.state != SG_RESOURCESTATE_VALID)) {
+        return;
+    }
+    const uint64_t hash = _sg_manifest_encode_shader(desc);
+    shd->cmn.manifest_hash = hash;
+    if (_sg.desc.record_manifest) {
+        shd->cmn.manifest_entry = _sg_manifest_record(_SG_MANIFEST_SHADER, hash);
+    }
+    if (!_sg.prewarm.in_prewarm) {
+        _sg_prewarm_claim_pending(_SG_MANIFEST_SHADER, hash, shd->slot.id);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_manifest_track_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+    if (!_sg_manifest_active() || (pip->slot.state != SG_RESOURCESTATE_VALID)) {
+        return;
+    }
+    const _sg_shader_t* shd = _sg_lookup_shader(&_sg.pools, desc->shader.id);
+    if ((0 == shd) || (0 == shd->cmn.manifest_hash)) {
+        return;
+    }
+    const uint64_t hash = _sg_manifest_encode_pipeline(desc, shd->cmn.manifest_hash);
+    if (_sg.desc.record_manifest) {
+        pip->cmn.manifest_entry = _sg_manifest_record(_SG_MANIFEST_PIPELINE, hash);
+    }
+    if (!_sg.prewarm.in_prewarm) {
+        _sg_prewarm_claim_pending(_SG_MANIFEST_PIPELINE, hash, pip->slot.id);
+    }
+}
+
+// called on the first sg_apply_pipeline() of a recorded pipeline
+_SOKOL_PRIVATE void _sg_manifest_first_use(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT((pip->cmn.manifest_entry > 0) && (pip->cmn.manifest_entry <= _sg.manifest.num_entries));
+    // NOTE: the frame index starts at 1, so 0 means 'never used'
+    const uint32_t frame = _sg.frame_index;
+    _sg_manifest_entry_t* entry = &_sg.manifest.entries[pip->cmn.manifest_entry - 1];
+    if (0 == entry->first_use) {
+        entry->first_use = frame;
+    }
+    const _sg_shader_t* shd = pip->shader;
+    if (shd && (shd->cmn.manifest_entry > 0)) {
+        entry = &_sg.manifest.entries[shd->cmn.manifest_entry - 1];
+        if (0 == entry->first_use) {
+            entry->first_use = frame;
+        }
+    }
+    pip->cmn.manifest_entry = 0;
+}
+
+// serialize the recorded entries into _sg.manifest.scratch
+_SOKOL_PRIVATE void _sg_manifest_build(void) {
+    _sg_manifest_t* mf = &_sg.manifest;
+    mf->scratch.size = 0;
+    _sg_bytes_append(&mf->scratch, "SGMF", 4);
+    _sg_mio_t io = _sg_mio_writer(&mf->scratch);
+    uint64_t version = _SG_MANIFEST_VERSION;
+    int backend = (int)_sg.backend;
+    int num_entries = mf->num_entries;
+    _sg_mio_u64(&io, &version);
+    _sg_mio_int(&io, &backend);
+    _sg_mio_int(&io, &num_entries);
+    for (int i = 0; i < mf->num_entries; i++) {
+        _sg_manifest_entry_t* entry = &mf->entries[i];
+        uint64_t first_use = entry->first_use;
+        _sg_mio_int(&io, &entry->kind);
+        _sg_mio_u64(&io, &first_use);
+        _sg_mio_size(&io, &entry->size);
+        _sg_bytes_append(&mf->scratch, mf->data.ptr + entry->offset, entry->size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_discard_prewarm(void) {
+    if (_sg.prewarm.entries) {
+        _sg_free(_sg.prewarm.entries);
+    }
+    if (_sg.prewarm.order) {
+        _sg_free(_sg.prewarm.order);
+    }
+    if (_sg.prewarm.data) {
+        _sg_free(_sg.prewarm.data);
+    }
+    if (_sg.prewarm.keys) {
+        _sg_free(_sg.prewarm.keys);
+    }
+    _sg_clear(&_sg.prewarm, sizeof(_sg.prewarm));
+}
+
+_SOKOL_PRIVATE void _sg_discard_manifest(void) {
+    _sg_bytes_discard(&_sg.manifest.data);
+    _sg_bytes_discard(&_sg.manifest.scratch);
+    if (_sg.manifest.entries) {
+        _sg_free(_sg.manifest.entries);
+    }
+    _sg_clear(&_sg.manifest, sizeof(_sg.manifest));
+    _sg_discard_prewarm();
+}
+
+// drop the manifest copy and creation order once all entries have been processed,
+// the entries are kept around so that sg_make_shader/pipeline() can claim them
+_SOKOL_PRIVATE void _sg_prewarm_finish(void) {
+    _sg.prewarm.done = true;
+    if (_sg.prewarm.order) {
+        _sg_free(_sg.prewarm.order);
+        _sg.prewarm.order = 0;
+    }
+    // keep the encoded params of objects which can still be claimed, the
+    // lookup compares those on a hash match
+    size_t keys_size = 0;
+    for (int i = 0; i < _sg.prewarm.num_entries; i++) {
+        if (_sg.prewarm.entries[i].state == _SG_PREWARM_CREATED) {
+            keys_size += _sg.prewarm.entries[i].size;
+        }
+    }
+    if (keys_size > 0) {
+        _sg.prewarm.keys = (uint8_t*) _sg_malloc(keys_size);
+    }
+    size_t offset = 0;
+    for (int i = 0; i < _sg.prewarm.num_entries; i++) {
+        _sg_prewarm_entry_t* entry = &_sg.prewarm.entries[i];
+        if (entry->state == _SG_PREWARM_CREATED) {
+            memcpy(_sg.prewarm.keys + offset, entry->ptr, entry->size);
+            entry->ptr = _sg.prewarm.keys + offset;
+            offset += entry->size;
+        } else {
+            entry->ptr = 0;
+            entry->size = 0;
+        }
+    }
+    if (_sg.prewarm.data) {
+        _sg_free(_sg.prewarm.data);
+        _sg.prewarm.data = 0;
+    }
+}
+
+// 'a' must be created before 'b'
+_SOKOL_PRIVATE bool _sg_prewarm_before(const _sg_prewarm_entry_t* a, const _sg_prewarm_entry_t* b) {
+    // never used resources go last
+    const uint32_t a_use = (0 == a->first_use) ? 0xFFFFFFFF : a->first_use;
+    const uint32_t b_use = (0 == b->first_use) ? 0xFFFFFFFF : b->first_use;
+    if (a_use != b_use) {
+        return a_use < b_use;
+    }
+    return a->kind < b->kind;
+}
+
+_SOKOL_PRIVATE bool _sg_prewarm_parse(const sg_range* manifest) {
+    SOKOL_ASSERT(0 == _sg.prewarm.data);
+    if ((0 == manifest->ptr) || (manifest->size < 4) || (0 != memcmp(manifest->ptr, "SGMF", 4))) {
+        _SG_ERROR(MANIFEST_INVALID);
+        return false;
+    }
+    _sg.prewarm.data = (uint8_t*) _sg_malloc(manifest->size);
+    memcpy(_sg.prewarm.data, manifest->ptr, manifest->size);
+    _sg_mio_t io = _sg_mio_reader(_sg.prewarm.data + 4, manifest->size - 4);
+    uint64_t version = 0;
+    int backend = 0;
+    int num_entries = 0;
+    _sg_mio_u64(&io, &version);
+    _sg_mio_int(&io, &backend);
+    _sg_mio_int(&io, &num_entries);
+    if (io.error || (version != _SG_MANIFEST_VERSION) || (num_entries < 0) || ((size_t)num_entries > (size_t)(io.end - io.ptr))) {
+        _SG_ERROR(MANIFEST_INVALID);
+        return false;
+    }
+    if (backend != (int)_sg.backend) {
+        _SG_WARN(MANIFEST_BACKEND_MISMATCH);
+        return false;
+    }
+    if (0 == num_entries) {
+        return true;
+    }
+    _sg.prewarm.entries = (_sg_prewarm_entry_t*) _sg_malloc_clear((size_t)num_entries * sizeof(_sg_prewarm_entry_t));
+    _sg.prewarm.order = (int*) _sg_malloc_clear((size_t)num_entries * sizeof(int));
+    for (int i = 0; i < num_entries; i++) {
+        _sg_prewarm_entry_t* entry = &_sg.prewarm.entries[i];
+        uint64_t first_use = 0;
+        size_t size = 0;
+        _sg_mio_int(&io, &entry->kind);
+        _sg_mio_u64(&io, &first_use);
+        _sg_mio_size(&io, &size);
+        if (io.error || (size > (size_t)(io.end - io.ptr))
+            || ((entry->kind != _SG_MANIFEST_SHADER) && (entry->kind != _SG_MANIFEST_PIPELINE))
+            || ((entry->kind == _SG_MANIFEST_PIPELINE) && (size < sizeof(uint64_t))))
+        {
+            _SG_ERROR(MANIFEST_INVALID);
+            return false;
+        }
+        entry->state = _SG_PREWARM_PENDING;
+        entry->first_use = (uint32_t)first_use;
+        entry->ptr = io.ptr;
+        entry->size = size;
+        entry->hash = _sg_manifest_hash(io.ptr, size);
+        if (entry->kind == _SG_MANIFEST_PIPELINE) {
+            memcpy(&entry->shader_hash, io.ptr, sizeof(uint64_t));
+        }
+        io.ptr += size;
+        // insertion sort by creation priority, stable for equal priorities
+        int pos = i;
+        while ((pos > 0) && _sg_prewarm_before(entry, &_sg.prewarm.entries[_sg.prewarm.order[pos - 1]])) {
+            _sg.prewarm.order[pos] = _sg.prewarm.order[pos - 1];
+            pos--;
+        }
+        _sg.prewarm.order[pos] = i;
+    }
+    _sg.prewarm.num_entries = num_entries;
+    return true;
+}
+
+// create the resource for a prewarm entry (if not happened yet), returns resource id or SG_INVALID_ID
+_SOKOL_PRIVATE uint32_t _sg_prewarm_create(int entry_index) {
+    SOKOL_ASSERT((entry_index >= 0) && (entry_index < _sg.prewarm.num_entries));
+    _sg_prewarm_entry_t* entry = &_sg.prewarm.entries[entry_index];
+    if (entry->state != _SG_PREWARM_PENDING) {
+        return (entry->state == _SG_PREWARM_FAILED) ? (uint32_t)SG_INVALID_ID : entry->res_id;
+    }
+    entry->state = _SG_PREWARM_FAILED;
+    _sg_mio_t io = _sg_mio_reader(entry->ptr, entry->size);
+    if (entry->kind == _SG_MANIFEST_SHADER) {
+        sg_shader_desc desc;
+        _sg_clear(&desc, sizeof(desc));
+        _sg_mio_shader(&io, &desc);
+        if (io.error || (io.ptr != io.end)) {
+            _SG_ERROR(MANIFEST_INVALID);
+            return SG_INVALID_ID;
+        }
+        _sg.prewarm.in_prewarm = true;
+        sg_shader shd = sg_make_shader(&desc);
+        _sg.prewarm.in_prewarm = false;
+        if (sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID) {
+            entry->state = _SG_PREWARM_CREATED;
+            entry->res_id = shd.id;
+        } else {
+            sg_destroy_shader(shd);
+        }
+    } else {
+        sg_pipeline_desc desc;
+        _sg_clear(&desc, sizeof(desc));
+        uint64_t shader_hash = 0;
+        _sg_mio_pipeline(&io, &desc, &shader_hash);
+        if (io.error || (io.ptr != io.end)) {
+            _SG_ERROR(MANIFEST_INVALID);
+            return SG_INVALID_ID;
+        }
+        // the pipeline's shader might not have been created yet
+        uint32_t shd_id = SG_INVALID_ID;
+        for (int i = 0; i < _sg.prewarm.num_entries; i++) {
+            const _sg_prewarm_entry_t* shd_entry = &_sg.prewarm.entries[i];
+            if ((shd_entry->kind == _SG_MANIFEST_SHADER) && (shd_entry->hash == shader_hash)) {
+                shd_id = _sg_prewarm_create(i);
+                break;
+            }
+        }
+        // ...or already destroyed by the application
+        if ((SG_INVALID_ID == shd_id) || (0 == _sg_lookup_shader(&_sg.pools, shd_id))) {
+            return SG_INVALID_ID;
+        }
+        desc.shader.id = shd_id;
+        _sg.prewarm.in_prewarm = true;
+        sg_pipeline pip = sg_make_pipeline(&desc);
+        _sg.prewarm.in_prewarm = false;
+        if (sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID) {
+            entry->state = _SG_PREWARM_CREATED;
+            entry->res_id = pip.id;
+        } else {
+            sg_destroy_pipeline(pip);
+        }
+    }
+    _sg_stats_add(num_prewarm, 1);
+    return (entry->state == _SG_PREWARM_CREATED) ? entry->res_id : (uint32_t)SG_INVALID_ID;
+}
+
+// return a resource created by sg_prewarm() which matches the creation params
+_SOKOL_PRIVATE sg_shader _sg_prewarm_claim_shader(const sg_shader_desc* desc) {
+    sg_shader res = { SG_INVALID_ID };
+    if ((0 == _sg.prewarm.num_entries) || _sg.prewarm.in_prewarm) {
+        return res;
+    }
+    const uint64_t hash = _sg_manifest_encode_shader(desc);
+    _sg_prewarm_entry_t* entry = _sg_prewarm_find(_SG_MANIFEST_SHADER, hash, _SG_PREWARM_CREATED);
+    if (entry && _sg_lookup_shader(&_sg.pools, entry->res_id)) {
+        entry->state = _SG_PREWARM_CLAIMED;
+        res.id = entry->res_id;
+        _sg_stats_add(num_prewarm_hits, 1);
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE sg_pipeline _sg_prewarm_claim_pipeline(const sg_pipeline_desc* desc) {
+    sg_pipeline res = { SG_INVALID_ID };
+    if ((0 == _sg.prewarm.num_entries) || _sg.prewarm.in_prewarm) {
+        return res;
+    }
+    const _sg_shader_t* shd = _sg_lookup_shader(&_sg.pools, desc->shader.id);
+    if ((0 == shd) || (0 == shd->cmn.manifest_hash)) {
+        return res;
+    }
+    const uint64_t hash = _sg_manifest_encode_pipeline(desc, shd->cmn.manifest_hash);
+    _sg_prewarm_entry_t* entry = _sg_prewarm_find(_SG_MANIFEST_PIPELINE, hash, _SG_PREWARM_CREATED);
+    if (entry) {
+        // the prewarmed pipeline must also use the same shader object
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, entry->res_id);
+        if (pip && (pip->cmn.shader_id.id == desc->shader.id)) {
+            entry->state = _SG_PREWARM_CLAIMED;
+            res.id = entry->res_id;
+            _sg_stats_add(num_prewarm_hits, 1);
+        }
+    }
+    return res;
+}
+
+// recreate the backend buffer at twice the size (or bigger to fit the
+// previous frame's append demand), but not bigger than max_size
+_SOKOL_PRIVATE void _sg_grow_buffer(_sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_VALID));
+    SOKOL_ASSERT(buf->cmn.max_size > buf->cmn.size);
+    SOKOL_ASSERT(buf->cmn.size > 0);
+    // NOTE: compute in 64 bits and clamp inside the loop, max_size may be up
+    // to INT_MAX, and doubling an int past that would overflow
+    int64_t new_size = buf->cmn.size;
+    do {
+        new_size = _sg_min(new_size * 2, (int64_t)buf->cmn.max_size);
+    } while ((new_size < buf->cmn.append_demand) && (new_size < buf->cmn.max_size));
+    _sg_discard_buffer(buf);
+    _sg_buffer_common_discard_shadow(&buf->cmn);
+    buf->cmn.size = (int)new_size;
+    buf->cmn.active_slot = 0;
+    sg_buffer_desc desc;
+    _sg_clear(&desc, sizeof(desc));
+    desc.size = (size_t)new_size;
+    desc.type = buf->cmn.type;
+    desc.usage = buf->cmn.usage;
+    desc.max_size = (size_t)buf->cmn.max_size;
+    desc.label = buf->cmn.label.buf[0] ? _sg_strptr(&buf->cmn.label) : 0;
+    buf->slot.state = _sg_create_buffer(buf, &desc);
+    _sg_stats_add(num_grow_buffer, 1);
+    _sg_stats_add(size_grow_buffer, (uint32_t)new_size);
+    _SG_INFO(BUFFER_GROWN);
 }
 
 _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
@@ -17335,6 +22290,9 @@ _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* des
     SOKOL_ASSERT(desc);
     if (_sg_validate_buffer_desc(desc)) {
         _sg_buffer_common_init(&buf->cmn, desc);
+        if (_sg_buffer_common_can_grow(&buf->cmn)) {
+            _sg_strcpy(&buf->cmn.label, desc->label);
+        }
         buf->slot.state = _sg_create_buffer(buf, desc);
     } else {
         buf->slot.state = SG_RESOURCESTATE_FAILED;
@@ -17342,16 +22300,47 @@ _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* des
     SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID)||(buf->slot.state == SG_RESOURCESTATE_FAILED));
 }
 
+// estimated memory size of a single mipmap of an image
+_SOKOL_PRIVATE size_t _sg_image_mip_memory_size(sg_image_type type, sg_pixel_format fmt, int width, int height, int num_slices, int sample_count, int mip_index) {
+    const int mip_width = _sg_miplevel_dim(width, mip_index);
+    const int mip_height = _sg_miplevel_dim(height, mip_index);
+    const size_t size = (size_t)_sg_surface_pitch(fmt, mip_width, mip_height, 1);
+    num_slices = (type == SG_IMAGETYPE_CUBE) ? (int)SG_CUBEFACE_NUM : num_slices;
+    return size * (size_t)num_slices * (size_t)sample_count;
+}
+
+// estimated memory size of the resident mipmaps of an image (desc must have defaults patched in)
+_SOKOL_PRIVATE size_t _sg_image_memory_size(const sg_image_desc* desc) {
+    size_t size = 0;
+    for (int mip_index = desc->num_mipmaps - desc->num_resident_mipmaps; mip_index < desc->num_mipmaps; mip_index++) {
+        size += _sg_image_mip_memory_size(desc->type, desc->pixel_format, desc->width, desc->height, desc->num_slices, desc->sample_count, mip_index);
+    }
+    return size;
+}
+
 _SOKOL_PRIVATE void _sg_init_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
     if (_sg_validate_image_desc(desc)) {
         _sg_image_common_init(&img->cmn, desc);
-        img->slot.state = _sg_create_image(img, desc);
+        img->cmn.use_frame_index = _sg.frame_index;
+        if ((img->cmn.base_mip_level > 0) && !_sg.features.mip_streaming) {
+            _SG_ERROR(MIP_STREAMING_NOT_SUPPORTED);
+            img->slot.state = SG_RESOURCESTATE_FAILED;
+        } else {
+            img->slot.state = _sg_create_image(img, desc);
+        }
     } else {
         img->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID)||(img->slot.state == SG_RESOURCESTATE_FAILED));
+    if ((img->slot.state == SG_RESOURCESTATE_VALID) && img->cmn.evictable) {
+        img->cmn.memory_size = _sg_image_memory_size(desc) * (size_t)img->cmn.num_slots;
+        sg_residency_stats* stats = &_sg.residency.stats;
+        stats->resident_bytes += img->cmn.memory_size;
+        stats->peak_bytes = _sg_max(stats->peak_bytes, stats->resident_bytes);
+        stats->num_resident_images++;
+    }
 }
 
 _SOKOL_PRIVATE void _sg_init_sampler(_sg_sampler_t* smp, const sg_sampler_desc* desc) {
@@ -17376,6 +22365,7 @@ _SOKOL_PRIVATE void _sg_init_shader(_sg_shader_t* shd, const sg_shader_desc* des
         shd->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID)||(shd->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_manifest_track_shader(shd, desc);
 }
 
 _SOKOL_PRIVATE void _sg_init_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
@@ -17393,6 +22383,26 @@ _SOKOL_PRIVATE void _sg_init_pipeline(_sg_pipeline_t* pip, const sg_pipeline_des
         pip->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID)||(pip->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_manifest_track_pipeline(pip, desc);
+}
+
+// NOTE: pip_desc is the resolved desc from _sg_pipeline_variant_resolve()
+_SOKOL_PRIVATE void _sg_init_pipeline_variant(_sg_pipeline_t* pip, const _sg_pipeline_t* base_pip, const sg_pipeline_variant_desc* desc, const sg_pipeline_desc* pip_desc) {
+    SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
+    SOKOL_ASSERT(desc && pip_desc);
+    if (_sg_validate_pipeline_variant_desc(base_pip, desc)) {
+        _sg_shader_t* shd = _sg_lookup_shader(&_sg.pools, pip_desc->shader.id);
+        if (base_pip && (base_pip->slot.state == SG_RESOURCESTATE_VALID) && shd && (shd->slot.state == SG_RESOURCESTATE_VALID)) {
+            _sg_pipeline_common_init(&pip->cmn, pip_desc);
+            pip->slot.state = _sg_create_pipeline(pip, shd, pip_desc);
+        } else {
+            pip->slot.state = SG_RESOURCESTATE_FAILED;
+        }
+    } else {
+        pip->slot.state = SG_RESOURCESTATE_FAILED;
+    }
+    SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID)||(pip->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_manifest_track_pipeline(pip, pip_desc);
 }
 
 _SOKOL_PRIVATE void _sg_init_attachments(_sg_attachments_t* atts, const sg_attachments_desc* desc) {
@@ -17443,14 +22453,402 @@ _SOKOL_PRIVATE void _sg_init_attachments(_sg_attachments_t* atts, const sg_attac
     SOKOL_ASSERT((atts->slot.state == SG_RESOURCESTATE_VALID)||(atts->slot.state == SG_RESOURCESTATE_FAILED));
 }
 
+// streaming 64-bit content hash (XXH64, see: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md)
+#define _SG_HASH_PRIME64_1 (0x9E3779B185EBCA87ULL)
+#define _SG_HASH_PRIME64_2 (0xC2B2AE3D27D4EB4FULL)
+#define _SG_HASH_PRIME64_3 (0x165667B19E3779F9ULL)
+#define _SG_HASH_PRIME64_4 (0x85EBCA77C2B2AE63ULL)
+#define _SG_HASH_PRIME64_5 (0x27D4EB2F165667C5ULL)
+
+typedef struct {
+    uint64_t seed;
+    uint64_t lanes[4];
+    uint64_t total_size;
+    uint8_t stripe[32];
+    size_t stripe_size;
+} _sg_hash_t;
+
+_SOKOL_PRIVATE uint64_t _sg_hash_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+_SOKOL_PRIVATE uint64_t _sg_hash_read64(const uint8_t* ptr) {
+    uint64_t val;
+    memcpy(&val, ptr, sizeof(val));
+    return val;
+}
+
+_SOKOL_PRIVATE uint64_t _sg_hash_read32(const uint8_t* ptr) {
+    uint32_t val;
+    memcpy(&val, ptr, sizeof(val));
+    return val;
+}
+
+_SOKOL_PRIVATE uint64_t _sg_hash_round(uint64_t acc, uint64_t input) {
+    acc += input * _SG_HASH_PRIME64_2;
+    acc = _sg_hash_rotl(acc, 31);
+    return acc * _SG_HASH_PRIME64_1;
+}
+
+_SOKOL_PRIVATE uint64_t _sg_hash_merge_round(uint64_t acc, uint64_t val) {
+    acc ^= _sg_hash_round(0, val);
+    return acc * _SG_HASH_PRIME64_1 + _SG_HASH_PRIME64_4;
+}
+
+_SOKOL_PRIVATE void _sg_hash_init(_sg_hash_t* h, uint64_t seed) {
+    _sg_clear(h, sizeof(_sg_hash_t));
+    h->seed = seed;
+    h->lanes[0] = seed + _SG_HASH_PRIME64_1 + _SG_HASH_PRIME64_2;
+    h->lanes[1] = seed + _SG_HASH_PRIME64_2;
+    h->lanes[2] = seed;
+    h->lanes[3] = seed - _SG_HASH_PRIME64_1;
+}
+
+_SOKOL_PRIVATE void _sg_hash_stripe(_sg_hash_t* h, const uint8_t* ptr) {
+    h->lanes[0] = _sg_hash_round(h->lanes[0], _sg_hash_read64(ptr));
+    h->lanes[1] = _sg_hash_round(h->lanes[1], _sg_hash_read64(ptr + 8));
+    h->lanes[2] = _sg_hash_round(h->lanes[2], _sg_hash_read64(ptr + 16));
+    h->lanes[3] = _sg_hash_round(h->lanes[3], _sg_hash_read64(ptr + 24));
+}
+
+_SOKOL_PRIVATE void _sg_hash_update(_sg_hash_t* h, const void* data, size_t size) {
+    const uint8_t* ptr = (const uint8_t*)data;
+    h->total_size += size;
+    if ((h->stripe_size + size) < sizeof(h->stripe)) {
+        memcpy(h->stripe + h->stripe_size, ptr, size);
+        h->stripe_size += size;
+        return;
+    }
+    if (h->stripe_size > 0) {
+        const size_t fill_size = sizeof(h->stripe) - h->stripe_size;
+        memcpy(h->stripe + h->stripe_size, ptr, fill_size);
+        _sg_hash_stripe(h, h->stripe);
+        ptr += fill_size;
+        size -= fill_size;
+        h->stripe_size = 0;
+    }
+    while (size >= sizeof(h->stripe)) {
+        _sg_hash_stripe(h, ptr);
+        ptr += sizeof(h->stripe);
+        size -= sizeof(h->stripe);
+    }
+    if (size > 0) {
+        memcpy(h->stripe, ptr, size);
+        h->stripe_size = size;
+    }
+}
+
+_SOKOL_PRIVATE uint64_t _sg_hash_digest(const _sg_hash_t* h) {
+    uint64_t acc;
+    if (h->total_size >= sizeof(h->stripe)) {
+        acc = _sg_hash_rotl(h->lanes[0], 1) + _sg_hash_rotl(h->lanes[1], 7) + _sg_hash_rotl(h->lanes[2], 12) + _sg_hash_rotl(h->lanes[3], 18);
+        for (int i = 0; i < 4; i++) {
+            acc = _sg_hash_merge_round(acc, h->lanes[i]);
+        }
+    } else {
+        acc = h->seed + _SG_HASH_PRIME64_5;
+    }
+    acc += h->total_size;
+    const uint8_t* ptr = h->stripe;
+    size_t size = h->stripe_size;
+    while (size >= 8) {
+        acc ^= _sg_hash_round(0, _sg_hash_read64(ptr));
+        acc = _sg_hash_rotl(acc, 27) * _SG_HASH_PRIME64_1 + _SG_HASH_PRIME64_4;
+        ptr += 8;
+        size -= 8;
+    }
+    if (size >= 4) {
+        acc ^= _sg_hash_read32(ptr) * _SG_HASH_PRIME64_1;
+        acc = _sg_hash_rotl(acc, 23) * _SG_HASH_PRIME64_2 + _SG_HASH_PRIME64_3;
+        ptr += 4;
+        size -= 4;
+    }
+    while (size > 0) {
+        acc ^= (*ptr) * _SG_HASH_PRIME64_5;
+        acc = _sg_hash_rotl(acc, 11) * _SG_HASH_PRIME64_1;
+        ptr++;
+        size--;
+    }
+    acc ^= acc >> 33;
+    acc *= _SG_HASH_PRIME64_2;
+    acc ^= acc >> 29;
+    acc *= _SG_HASH_PRIME64_3;
+    acc ^= acc >> 32;
+    return acc;
+}
+
+// the byte chunks which make up the creation attributes and content of
+// a resource, the same chunks are hashed, copied into the dedup item and
+// compared against the copy when the hash matches
+typedef struct {
+    uint32_t attrs[7];
+    uint32_t sub_sizes[SG_CUBEFACE_NUM * SG_MAX_MIPMAPS];
+    int num_chunks;
+    sg_range chunks[1 + 2 * SG_CUBEFACE_NUM * SG_MAX_MIPMAPS];
+    size_t content_size;    // number of resource content bytes (without attributes)
+} _sg_dedup_content_t;
+
+_SOKOL_PRIVATE void _sg_dedup_content_add(_sg_dedup_content_t* content, const void* ptr, size_t size) {
+    SOKOL_ASSERT(content->num_chunks < (int)(sizeof(content->chunks) / sizeof(content->chunks[0])));
+    content->chunks[content->num_chunks].ptr = ptr;
+    content->chunks[content->num_chunks].size = size;
+    content->num_chunks++;
+}
+
+_SOKOL_PRIVATE _sg_dedup_key_t _sg_dedup_content_key(const _sg_dedup_content_t* content) {
+    _sg_hash_t hash;
+    _sg_hash_init(&hash, 0);
+    _sg_dedup_key_t key;
+    _sg_clear(&key, sizeof(key));
+    for (int i = 0; i < content->num_chunks; i++) {
+        _sg_hash_update(&hash, content->chunks[i].ptr, content->chunks[i].size);
+        key.size += content->chunks[i].size;
+    }
+    key.hash = _sg_hash_digest(&hash);
+    _sg.dedup.stats.hashed_bytes += content->content_size;
+    return key;
+}
+
+_SOKOL_PRIVATE bool _sg_dedup_content_equal(const _sg_dedup_item_t* item, const _sg_dedup_content_t* content, const _sg_dedup_key_t* key) {
+    if ((item->key.size != key->size) || (0 == item->bytes)) {
+        return false;
+    }
+    size_t pos = 0;
+    for (int i = 0; i < content->num_chunks; i++) {
+        const sg_range* chunk = &content->chunks[i];
+        if (0 != memcmp(item->bytes + pos, chunk->ptr, chunk->size)) {
+            return false;
+        }
+        pos += chunk->size;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_dedup_buffer_eligible(const sg_buffer_desc* desc) {
+    const bool injected = (0 != desc->gl_buffers[0]) ||
+                          (0 != desc->mtl_buffers[0]) ||
+                          (0 != desc->d3d11_buffer) ||
+                          (0 != desc->wgpu_buffer);
+    return _sg.desc.dedup_immutable_resources
+        && (desc->usage == SG_USAGE_IMMUTABLE)
+        && (desc->data.ptr != 0)
+        && (desc->data.size > 0)
+        && !injected
+        && (desc->max_views == 0)
+        && (desc->max_size <= desc->size);
+}
+
+_SOKOL_PRIVATE bool _sg_dedup_image_eligible(const sg_image_desc* desc) {
+    const bool injected = (0 != desc->gl_textures[0]) ||
+                          (0 != desc->mtl_textures[0]) ||
+                          (0 != desc->d3d11_texture) ||
+                          (0 != desc->wgpu_texture);
+    return _sg.desc.dedup_immutable_resources
+        && (desc->usage == SG_USAGE_IMMUTABLE)
+        && (desc->data.subimage[0][0].ptr != 0)
+        && !injected
+        && !desc->render_target
+        && !desc->storage_image
+        && !desc->evictable;
+}
+
+// NOTE: the content chunks point into the content struct and the desc
+_SOKOL_PRIVATE void _sg_dedup_buffer_content(const sg_buffer_desc* desc, _sg_dedup_content_t* content) {
+    _sg_clear(content, sizeof(_sg_dedup_content_t));
+    content->attrs[0] = (uint32_t)desc->type;
+    content->attrs[1] = (uint32_t)desc->size;
+    _sg_dedup_content_add(content, content->attrs, 2 * sizeof(uint32_t));
+    _sg_dedup_content_add(content, desc->data.ptr, desc->data.size);
+    content->content_size = desc->data.size;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_image_content(const sg_image_desc* desc, _sg_dedup_content_t* content) {
+    _sg_clear(content, sizeof(_sg_dedup_content_t));
+    content->attrs[0] = (uint32_t)desc->type;
+    content->attrs[1] = (uint32_t)desc->width;
+    content->attrs[2] = (uint32_t)desc->height;
+    content->attrs[3] = (uint32_t)desc->num_slices;
+    content->attrs[4] = (uint32_t)desc->num_mipmaps;
+    content->attrs[5] = (uint32_t)desc->pixel_format;
+    content->attrs[6] = (uint32_t)desc->sample_count;
+    _sg_dedup_content_add(content, content->attrs, sizeof(content->attrs));
+    const int num_faces = (desc->type == SG_IMAGETYPE_CUBE) ? (int)SG_CUBEFACE_NUM : 1;
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        for (int mip_index = 0; mip_index < desc->num_mipmaps; mip_index++) {
+            const sg_range* sub = &desc->data.subimage[face_index][mip_index];
+            if (sub->ptr) {
+                uint32_t* sub_size = &content->sub_sizes[face_index * SG_MAX_MIPMAPS + mip_index];
+                *sub_size = (uint32_t)sub->size;
+                _sg_dedup_content_add(content, sub_size, sizeof(uint32_t));
+                _sg_dedup_content_add(content, sub->ptr, sub->size);
+                content->content_size += sub->size;
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE _sg_dedup_item_t* _sg_dedup_item_at(_sg_dedup_kind_t kind, int slot_index) {
+    if (kind == _SG_DEDUPKIND_BUFFER) {
+        SOKOL_ASSERT((slot_index > 0) && (slot_index < _sg.pools.buffer_pool.size));
+        return &_sg.pools.buffers[slot_index].cmn.dedup;
+    } else {
+        SOKOL_ASSERT((slot_index > 0) && (slot_index < _sg.pools.image_pool.size));
+        return &_sg.pools.images[slot_index].cmn.dedup;
+    }
+}
+
+_SOKOL_PRIVATE int* _sg_dedup_bucket(_sg_dedup_kind_t kind, uint64_t hash) {
+    const _sg_dedup_table_t* tbl = &_sg.dedup.tables[kind];
+    SOKOL_ASSERT(tbl->buckets);
+    return &tbl->buckets[hash & (uint64_t)(tbl->num_buckets - 1)];
+}
+
+// returns the pool slot index of a resource with matching content, or 0
+_SOKOL_PRIVATE int _sg_dedup_find(_sg_dedup_kind_t kind, const _sg_dedup_key_t* key, const _sg_dedup_content_t* content) {
+    for (int slot_index = *_sg_dedup_bucket(kind, key->hash); slot_index != 0;) {
+        const _sg_dedup_item_t* item = _sg_dedup_item_at(kind, slot_index);
+        if (item->key.hash == key->hash) {
+            if (_sg_dedup_content_equal(item, content, key)) {
+                return slot_index;
+            }
+            _sg.dedup.stats.num_collisions++;
+        }
+        slot_index = item->next;
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_insert(_sg_dedup_kind_t kind, int slot_index, const _sg_dedup_key_t* key, const _sg_dedup_content_t* content, size_t memory_size) {
+    _sg_dedup_item_t* item = _sg_dedup_item_at(kind, slot_index);
+    SOKOL_ASSERT(0 == item->ref_count);
+    SOKOL_ASSERT(0 == item->bytes);
+    int* bucket = _sg_dedup_bucket(kind, key->hash);
+    item->bytes = (uint8_t*)_sg_malloc(key->size);
+    size_t pos = 0;
+    for (int i = 0; i < content->num_chunks; i++) {
+        memcpy(item->bytes + pos, content->chunks[i].ptr, content->chunks[i].size);
+        pos += content->chunks[i].size;
+    }
+    SOKOL_ASSERT(pos == key->size);
+    item->key = *key;
+    item->ref_count = 1;
+    item->next = *bucket;
+    item->memory_size = memory_size;
+    *bucket = slot_index;
+    if (kind == _SG_DEDUPKIND_BUFFER) {
+        _sg.dedup.stats.num_buffers++;
+    } else {
+        _sg.dedup.stats.num_images++;
+    }
+}
+
+// called when a deduplicated resource is destroyed
+_SOKOL_PRIVATE void _sg_dedup_remove(_sg_dedup_kind_t kind, int slot_index) {
+    _sg_dedup_item_t* item = _sg_dedup_item_at(kind, slot_index);
+    SOKOL_ASSERT(item->ref_count > 0);
+    int* link = _sg_dedup_bucket(kind, item->key.hash);
+    while (*link != slot_index) {
+        SOKOL_ASSERT(*link != 0);
+        link = &_sg_dedup_item_at(kind, *link)->next;
+    }
+    *link = item->next;
+    if (item->bytes) {
+        _sg_free(item->bytes);
+    }
+    _sg_clear(item, sizeof(_sg_dedup_item_t));
+    if (kind == _SG_DEDUPKIND_BUFFER) {
+        _sg.dedup.stats.num_buffers--;
+    } else {
+        _sg.dedup.stats.num_images--;
+    }
+}
+
+// adds a reference to an existing deduplicated resource
+_SOKOL_PRIVATE void _sg_dedup_retain(_sg_dedup_item_t* item, _sg_dedup_kind_t kind) {
+    SOKOL_ASSERT(item->ref_count > 0);
+    item->ref_count++;
+    _sg.dedup.stats.saved_bytes += item->memory_size;
+    if (kind == _SG_DEDUPKIND_BUFFER) {
+        _sg.dedup.stats.num_buffer_hits++;
+    } else {
+        _sg.dedup.stats.num_image_hits++;
+    }
+}
+
+// drops a reference, returns true if the resource is still referenced
+_SOKOL_PRIVATE bool _sg_dedup_release(_sg_dedup_item_t* item) {
+    if (item->ref_count > 1) {
+        item->ref_count--;
+        SOKOL_ASSERT(_sg.dedup.stats.saved_bytes >= item->memory_size);
+        _sg.dedup.stats.saved_bytes -= item->memory_size;
+        return true;
+    }
+    return false;
+}
+
+_SOKOL_PRIVATE void _sg_setup_dedup_table(_sg_dedup_table_t* tbl, int pool_size) {
+    int num_buckets = 1;
+    while (num_buckets < pool_size) {
+        num_buckets <<= 1;
+    }
+    tbl->num_buckets = num_buckets;
+    tbl->buckets = (int*)_sg_malloc_clear((size_t)num_buckets * sizeof(int));
+}
+
+_SOKOL_PRIVATE void _sg_setup_dedup(const sg_desc* desc) {
+    if (desc->dedup_immutable_resources) {
+        _sg_setup_dedup_table(&_sg.dedup.tables[_SG_DEDUPKIND_BUFFER], desc->buffer_pool_size);
+        _sg_setup_dedup_table(&_sg.dedup.tables[_SG_DEDUPKIND_IMAGE], desc->image_pool_size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_discard_dedup(void) {
+    // resources which are still alive at shutdown aren't removed from the tables
+    if (_sg.dedup.tables[_SG_DEDUPKIND_BUFFER].buckets) {
+        for (int i = 1; i < _sg.pools.buffer_pool.size; i++) {
+            if (_sg.pools.buffers[i].cmn.dedup.bytes) {
+                _sg_free(_sg.pools.buffers[i].cmn.dedup.bytes);
+                _sg.pools.buffers[i].cmn.dedup.bytes = 0;
+            }
+        }
+    }
+    if (_sg.dedup.tables[_SG_DEDUPKIND_IMAGE].buckets) {
+        for (int i = 1; i < _sg.pools.image_pool.size; i++) {
+            if (_sg.pools.images[i].cmn.dedup.bytes) {
+                _sg_free(_sg.pools.images[i].cmn.dedup.bytes);
+                _sg.pools.images[i].cmn.dedup.bytes = 0;
+            }
+        }
+    }
+    for (int i = 0; i < _SG_DEDUPKIND_NUM; i++) {
+        if (_sg.dedup.tables[i].buckets) {
+            _sg_free(_sg.dedup.tables[i].buckets);
+        }
+    }
+    _sg_clear(&_sg.dedup, sizeof(_sg.dedup));
+}
+
 _SOKOL_PRIVATE void _sg_uninit_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && ((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED)));
+    if (buf->cmn.dedup.ref_count > 0) {
+        _sg_dedup_remove(_SG_DEDUPKIND_BUFFER, _sg_slot_index(buf->slot.id));
+    }
     _sg_discard_buffer(buf);
+    _sg_buffer_common_discard(&buf->cmn);
     _sg_reset_buffer_to_alloc_state(buf);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_image(_sg_image_t* img) {
     SOKOL_ASSERT(img && ((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED)));
+    if ((img->slot.state == SG_RESOURCESTATE_VALID) && img->cmn.evictable) {
+        SOKOL_ASSERT(_sg.residency.stats.resident_bytes >= img->cmn.memory_size);
+        SOKOL_ASSERT(_sg.residency.stats.num_resident_images > 0);
+        _sg.residency.stats.resident_bytes -= img->cmn.memory_size;
+        _sg.residency.stats.num_resident_images--;
+    }
+    if (img->cmn.dedup.ref_count > 0) {
+        _sg_dedup_remove(_SG_DEDUPKIND_IMAGE, _sg_slot_index(img->slot.id));
+    }
     _sg_discard_image(img);
     _sg_reset_image_to_alloc_state(img);
 }
@@ -17479,6 +22877,322 @@ _SOKOL_PRIVATE void _sg_uninit_attachments(_sg_attachments_t* atts) {
     _sg_reset_attachments_to_alloc_state(atts);
 }
 
+#if defined(SOKOL_THREADSAFE_RESOURCES)
+_SOKOL_PRIVATE void _sg_setup_init_queue(void) {
+    _sg_mutex_init(&_sg.init_queue.mutex);
+    _sg.init_queue.render_thread = _sg_thread_self();
+}
+
+_SOKOL_PRIVATE void _sg_discard_init_queue(void) {
+    for (int i = 0; i < _sg.init_queue.num; i++) {
+        _sg_free(_sg.init_queue.items[i].data);
+    }
+    if (_sg.init_queue.items) {
+        _sg_free(_sg.init_queue.items);
+    }
+    if (_sg.init_queue.spare) {
+        _sg_free(_sg.init_queue.spare);
+    }
+    _sg.init_queue.items = 0;
+    _sg.init_queue.num = 0;
+    _sg.init_queue.capacity = 0;
+    _sg.init_queue.spare = 0;
+    _sg.init_queue.spare_capacity = 0;
+    _sg_mutex_destroy(&_sg.init_queue.mutex);
+}
+
+_SOKOL_PRIVATE bool _sg_on_render_thread(void) {
+    return _sg_thread_equal(_sg_thread_self(), _sg.init_queue.render_thread);
+}
+
+// called from any thread with the already default-patched desc,
+// desc data is copied into the item.data block by the caller
+_SOKOL_PRIVATE void _sg_push_init_queue(const _sg_init_queue_item_t* item) {
+    _sg_mutex_lock(&_sg.init_queue.mutex);
+    if (_sg.init_queue.num == _sg.init_queue.capacity) {
+        const int new_capacity = (_sg.init_queue.capacity == 0) ? 64 : _sg.init_queue.capacity * 2;
+        _sg_init_queue_item_t* new_items = (_sg_init_queue_item_t*)_sg_malloc((size_t)new_capacity * sizeof(_sg_init_queue_item_t));
+        if (_sg.init_queue.items) {
+            memcpy(new_items, _sg.init_queue.items, (size_t)_sg.init_queue.num * sizeof(_sg_init_queue_item_t));
+            _sg_free(_sg.init_queue.items);
+        }
+        _sg.init_queue.items = new_items;
+        _sg.init_queue.capacity = new_capacity;
+    }
+    _sg.init_queue.items[_sg.init_queue.num++] = *item;
+    _sg_mutex_unlock(&_sg.init_queue.mutex);
+}
+
+// called from sg_commit() on the render thread, the pending items are
+// swapped out under the lock so that worker threads can keep pushing
+// new items while the backend resources are created
+_SOKOL_PRIVATE void _sg_process_init_queue(void) {
+    _sg_mutex_lock(&_sg.init_queue.mutex);
+    _sg_init_queue_item_t* items = _sg.init_queue.items;
+    const int num = _sg.init_queue.num;
+    const int capacity = _sg.init_queue.capacity;
+    _sg.init_queue.items = _sg.init_queue.spare;
+    _sg.init_queue.capacity = _sg.init_queue.spare_capacity;
+    _sg.init_queue.num = 0;
+    _sg.init_queue.spare = 0;
+    _sg.init_queue.spare_capacity = 0;
+    _sg_mutex_unlock(&_sg.init_queue.mutex);
+
+    for (int i = 0; i < num; i++) {
+        _sg_init_queue_item_t* item = &items[i];
+        if (item->is_image) {
+            _sg_image_t* img = _sg_lookup_image(&_sg.pools, item->res_id);
+            if (img && (img->slot.state == SG_RESOURCESTATE_ALLOC)) {
+                _sg_init_image(img, &item->desc.img);
+                const sg_image img_id = { item->res_id };
+                _SG_TRACE_ARGS(init_image, img_id, &item->desc.img);
+                _SOKOL_UNUSED(img_id);
+            }
+        } else {
+            _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, item->res_id);
+            if (buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC)) {
+                _sg_init_buffer(buf, &item->desc.buf);
+                const sg_buffer buf_id = { item->res_id };
+                _SG_TRACE_ARGS(init_buffer, buf_id, &item->desc.buf);
+                _SOKOL_UNUSED(buf_id);
+            }
+        }
+        _sg_free(item->data);
+        item->data = 0;
+    }
+    // the spare array is only accessed on the render thread
+    _sg.init_queue.spare = items;
+    _sg.init_queue.spare_capacity = capacity;
+}
+
+_SOKOL_PRIVATE size_t _sg_label_size(const char* label) {
+    return label ? (strlen(label) + 1) : 0;
+}
+
+_SOKOL_PRIVATE uint8_t* _sg_copy_label(uint8_t* dst, const char** label) {
+    if (*label) {
+        const size_t size = _sg_label_size(*label);
+        memcpy(dst, *label, size);
+        *label = (const char*)dst;
+        dst += size;
+    }
+    return dst;
+}
+#endif // SOKOL_THREADSAFE_RESOURCES
+
+_SOKOL_PRIVATE void _sg_setup_transient_pool(const sg_desc* desc) {
+    SOKOL_ASSERT(desc->transient_pool_size > 0);
+    SOKOL_ASSERT(0 == _sg.transient.images);
+    SOKOL_ASSERT(desc->transient_attachments_cache_size > 0);
+    _sg.transient.capacity = desc->transient_pool_size;
+    _sg.transient.atts_capacity = desc->transient_attachments_cache_size;
+    _sg.transient.images = (_sg_transient_image_t*)_sg_malloc_clear((size_t)_sg.transient.capacity * sizeof(_sg_transient_image_t));
+    _sg.transient.atts = (_sg_transient_attachments_t*)_sg_malloc_clear((size_t)_sg.transient.atts_capacity * sizeof(_sg_transient_attachments_t));
+}
+
+// NOTE: the pooled images and attachments objects are destroyed in _sg_discard_all_resources()
+_SOKOL_PRIVATE void _sg_discard_transient_pool(void) {
+    SOKOL_ASSERT(_sg.transient.images && _sg.transient.atts);
+    _sg_free(_sg.transient.atts);
+    _sg_free(_sg.transient.images);
+    _sg_clear(&_sg.transient, sizeof(_sg.transient));
+}
+
+_SOKOL_PRIVATE _sg_transient_image_key_t _sg_transient_image_key(const sg_image_desc* desc) {
+    _sg_transient_image_key_t key;
+    _sg_clear(&key, sizeof(key));
+    key.type = desc->type;
+    key.width = desc->width;
+    key.height = desc->height;
+    key.num_slices = desc->num_slices;
+    key.num_mipmaps = desc->num_mipmaps;
+    key.pixel_format = desc->pixel_format;
+    key.sample_count = desc->sample_count;
+    return key;
+}
+
+_SOKOL_PRIVATE bool _sg_transient_image_compatible(const _sg_transient_image_key_t* a, const _sg_transient_image_key_t* b) {
+    return (a->type == b->type)
+        && (a->width == b->width)
+        && (a->height == b->height)
+        && (a->num_slices == b->num_slices)
+        && (a->num_mipmaps == b->num_mipmaps)
+        && (a->pixel_format == b->pixel_format)
+        && (a->sample_count == b->sample_count);
+}
+
+_SOKOL_PRIVATE bool _sg_transient_attachment_equal(const sg_attachment_desc* a, const sg_attachment_desc* b) {
+    return (a->image.id == b->image.id) && (a->mip_level == b->mip_level) && (a->slice == b->slice);
+}
+
+// compares field by field, the desc structs may contain padding and canaries
+_SOKOL_PRIVATE bool _sg_transient_attachments_equal(const sg_attachments_desc* a, const sg_attachments_desc* b) {
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if (!_sg_transient_attachment_equal(&a->colors[i], &b->colors[i])) {
+            return false;
+        }
+        if (!_sg_transient_attachment_equal(&a->resolves[i], &b->resolves[i])) {
+            return false;
+        }
+    }
+    return _sg_transient_attachment_equal(&a->depth_stencil, &b->depth_stencil);
+}
+
+// called from sg_begin_pass(), cached attachments objects which are kept
+// around by the caller must not be destroyed while they are still used
+_SOKOL_PRIVATE void _sg_touch_transient_attachments(uint32_t atts_id) {
+    for (int i = 0; i < _sg.transient.num_atts; i++) {
+        if (_sg.transient.atts[i].atts.id == atts_id) {
+            _sg.transient.atts[i].last_used_frame = _sg.frame_index;
+            return;
+        }
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_transient_attachments_uses_image(const sg_attachments_desc* desc, uint32_t img_id) {
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if ((desc->colors[i].image.id == img_id) || (desc->resolves[i].image.id == img_id)) {
+            return true;
+        }
+    }
+    return desc->depth_stencil.image.id == img_id;
+}
+
+_SOKOL_PRIVATE void _sg_evict_transient_attachments(int index) {
+    SOKOL_ASSERT((index >= 0) && (index < _sg.transient.num_atts));
+    sg_destroy_attachments(_sg.transient.atts[index].atts);
+    _sg.transient.atts[index] = _sg.transient.atts[--_sg.transient.num_atts];
+}
+
+_SOKOL_PRIVATE void _sg_evict_transient_image(int index) {
+    SOKOL_ASSERT((index >= 0) && (index < _sg.transient.num_images));
+    _sg_transient_image_t* item = &_sg.transient.images[index];
+    SOKOL_ASSERT(!item->in_use);
+    for (int i = _sg.transient.num_atts - 1; i >= 0; i--) {
+        if (_sg_transient_attachments_uses_image(&_sg.transient.atts[i].desc, item->img.id)) {
+            _sg_evict_transient_attachments(i);
+        }
+    }
+    sg_destroy_image(item->img);
+    SOKOL_ASSERT(_sg.transient.stats.total_bytes >= item->size);
+    _sg.transient.stats.total_bytes -= item->size;
+    _sg.transient.stats.num_evicted++;
+    *item = _sg.transient.images[--_sg.transient.num_images];
+}
+
+// called from sg_commit(), destroys images and attachments which haven't been used for a while
+_SOKOL_PRIVATE void _sg_gc_transient_pool(void) {
+    const uint32_t max_unused_frames = (uint32_t)_sg.desc.transient_max_unused_frames;
+    for (int i = _sg.transient.num_images - 1; i >= 0; i--) {
+        const _sg_transient_image_t* item = &_sg.transient.images[i];
+        if (!item->in_use && ((_sg.frame_index - item->last_used_frame) >= max_unused_frames)) {
+            _sg_evict_transient_image(i);
+        }
+    }
+    for (int i = _sg.transient.num_atts - 1; i >= 0; i--) {
+        if ((_sg.frame_index - _sg.transient.atts[i].last_used_frame) >= max_unused_frames) {
+            _sg_evict_transient_attachments(i);
+        }
+    }
+}
+
+// creates the 1x1 placeholder images which are bound instead of evicted images
+_SOKOL_PRIVATE void _sg_setup_residency(const sg_desc* desc) {
+    _sg.residency.stats.budget = desc->residency.budget;
+    if (0 == desc->residency.budget) {
+        return;
+    }
+    static const uint32_t pixels[SG_CUBEFACE_NUM] = { 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000 };
+    for (int type = SG_IMAGETYPE_2D; type < _SG_IMAGETYPE_NUM; type++) {
+        sg_image_desc img_desc;
+        _sg_clear(&img_desc, sizeof(img_desc));
+        img_desc.type = (sg_image_type)type;
+        img_desc.width = 1;
+        img_desc.height = 1;
+        img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+        const int num_faces = (type == SG_IMAGETYPE_CUBE) ? (int)SG_CUBEFACE_NUM : 1;
+        for (int face_index = 0; face_index < num_faces; face_index++) {
+            img_desc.data.subimage[face_index][0].ptr = &pixels[face_index];
+            img_desc.data.subimage[face_index][0].size = sizeof(uint32_t);
+        }
+        img_desc.label = "sg-residency-placeholder";
+        const sg_image_desc desc_def = _sg_image_desc_defaults(&img_desc);
+        const sg_image img_id = _sg_alloc_image();
+        if (img_id.id != SG_INVALID_ID) {
+            _sg_init_image(_sg_image_at(&_sg.pools, img_id.id), &desc_def);
+        }
+        _sg.residency.placeholders[type] = img_id;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_discard_residency(void) {
+    // NOTE: the placeholder images are destroyed with all other resources
+    _sg_clear(&_sg.residency, sizeof(_sg.residency));
+}
+
+// called from sg_apply_bindings(), stamps the image with the current frame
+// index and returns the placeholder image if the image has been evicted
+_SOKOL_PRIVATE _sg_image_t* _sg_residency_use_image(_sg_image_t* img) {
+    if (img) {
+        if (img->cmn.evicted) {
+            SOKOL_ASSERT(img->slot.state == SG_RESOURCESTATE_ALLOC);
+            _sg.residency.stats.num_placeholder_binds++;
+            return _sg_lookup_image(&_sg.pools, _sg.residency.placeholders[img->cmn.type].id);
+        }
+        img->cmn.use_frame_index = _sg.frame_index;
+    }
+    return img;
+}
+
+_SOKOL_PRIVATE void _sg_residency_evict_image(_sg_image_t* img) {
+    SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_VALID) && img->cmn.evictable);
+    const sg_image img_id = { img->slot.id };
+    const sg_image_type type = img->cmn.type;
+    _sg_uninit_image(img);
+    // the image stays in the ALLOC state until the application initializes it again
+    img->cmn.type = type;
+    img->cmn.evicted = true;
+    _sg.residency.stats.num_evicted++;
+    if (_sg.desc.residency.evicted_func) {
+        _sg.desc.residency.evicted_func(img_id, _sg.desc.residency.user_data);
+    }
+}
+
+// called from sg_commit(), evicts images until the memory budget is met again,
+// images which have been used in the current frame are never evicted
+_SOKOL_PRIVATE void _sg_residency_enforce_budget(void) {
+    const size_t budget = _sg.desc.residency.budget;
+    if (0 == budget) {
+        return;
+    }
+    while (_sg.residency.stats.resident_bytes > budget) {
+        _sg_image_t* victim = 0;
+        // other threads may allocate image slots while the pool is scanned
+        _sg_pool_lock(&_sg.pools.image_pool);
+        for (int i = 1; i < _sg.pools.image_pool.size; i++) {
+            _sg_image_t* img = &_sg.pools.images[i];
+            const bool candidate = (img->slot.state == SG_RESOURCESTATE_VALID)
+                && img->cmn.evictable
+                && !img->cmn.pinned
+                && (img->cmn.use_frame_index < _sg.frame_index);
+            if (candidate) {
+                if ((0 == victim)
+                    || (img->cmn.evict_priority < victim->cmn.evict_priority)
+                    || ((img->cmn.evict_priority == victim->cmn.evict_priority) && (img->cmn.use_frame_index < victim->cmn.use_frame_index)))
+                {
+                    victim = img;
+                }
+            }
+        }
+        _sg_pool_unlock(&_sg.pools.image_pool);
+        if (0 == victim) {
+            // everything else is pinned or in use
+            break;
+        }
+        _sg_residency_evict_image(victim);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_setup_commit_listeners(const sg_desc* desc) {
     SOKOL_ASSERT(desc->max_commit_listeners > 0);
     SOKOL_ASSERT(0 == _sg.commit_listeners.items);
@@ -17578,13 +23292,19 @@ _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     res.attachments_pool_size = _sg_def(res.attachments_pool_size, _SG_DEFAULT_ATTACHMENTS_POOL_SIZE);
     res.uniform_buffer_size = _sg_def(res.uniform_buffer_size, _SG_DEFAULT_UB_SIZE);
     res.max_commit_listeners = _sg_def(res.max_commit_listeners, _SG_DEFAULT_MAX_COMMIT_LISTENERS);
+    res.transient_pool_size = _sg_def(res.transient_pool_size, _SG_DEFAULT_TRANSIENT_POOL_SIZE);
+    res.transient_attachments_cache_size = _sg_def(res.transient_attachments_cache_size, res.transient_pool_size);
+    res.transient_max_unused_frames = _sg_def(res.transient_max_unused_frames, _SG_DEFAULT_TRANSIENT_MAX_UNUSED_FRAMES);
+    res.readback_pool_size = _sg_def(res.readback_pool_size, _SG_DEFAULT_READBACK_POOL_SIZE);
+    res.num_inflight_frames = _sg_max(1, _sg_min(_sg_def(res.num_inflight_frames, SG_NUM_INFLIGHT_FRAMES), SG_MAX_INFLIGHT_FRAMES));
+    res.max_frames_ahead = _sg_max(0, _sg_min(res.max_frames_ahead, SG_MAX_INFLIGHT_FRAMES));
     res.wgpu_bindgroups_cache_size = _sg_def(res.wgpu_bindgroups_cache_size, _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE);
     return res;
 }
 
 _SOKOL_PRIVATE sg_pass _sg_pass_defaults(const sg_pass* pass) {
     sg_pass res = *pass;
-    if (res.attachments.id == SG_INVALID_ID) {
+    if (!res.compute && (res.attachments.id == SG_INVALID_ID)) {
         // this is a swapchain-pass
         res.swapchain.sample_count = _sg_def(res.swapchain.sample_count, _sg.desc.environment.defaults.sample_count);
         res.swapchain.color_format = _sg_def(res.swapchain.color_format, _sg.desc.environment.defaults.color_format);
@@ -17594,6 +23314,18 @@ _SOKOL_PRIVATE sg_pass _sg_pass_defaults(const sg_pass* pass) {
     return res;
 }
 
+_SOKOL_PRIVATE _sg_state_t* _sg_lookup_context(uint32_t ctx_id) {
+    if (ctx_id == _SG_DEFAULT_CONTEXT_ID) {
+        return &_sg_default_state;
+    }
+    const int slot_index = (int)(ctx_id & _SG_SLOT_MASK) - 1;
+    if ((slot_index > 0) && (slot_index < _SG_MAX_CONTEXTS) && (_sg_contexts.ids[slot_index] == ctx_id)) {
+        SOKOL_ASSERT(_sg_contexts.states[slot_index]);
+        return _sg_contexts.states[slot_index];
+    }
+    return 0;
+}
+
 // ██████  ██    ██ ██████  ██      ██  ██████
 // ██   ██ ██    ██ ██   ██ ██      ██ ██
 // ██████  ██    ██ ██████  ██      ██ ██
@@ -17609,16 +23341,30 @@ SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
     _sg.desc = _sg_desc_defaults(desc);
     _sg_setup_pools(&_sg.pools, &_sg.desc);
     _sg_setup_commit_listeners(&_sg.desc);
+    _sg_setup_transient_pool(&_sg.desc);
+    _sg_setup_dedup(&_sg.desc);
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_setup_init_queue();
+    #endif
     _sg.frame_index = 1;
     _sg.stats_enabled = true;
     _sg_setup_backend(&_sg.desc);
+    _sg_setup_residency(&_sg.desc);
     _sg.valid = true;
 }
 
 SOKOL_API_IMPL void sg_shutdown(void) {
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_discard_init_queue();
+    #endif
     _sg_discard_all_resources(&_sg.pools);
     _sg_discard_backend();
+    _sg_discard_transient_pool();
+    _sg_discard_residency();
+    _sg_discard_dedup();
     _sg_discard_commit_listeners();
+    _sg_discard_manifest();
+    _sg_discard_uniform_cache();
     _sg_discard_pools(&_sg.pools);
     _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
 }
@@ -17627,6 +23373,96 @@ SOKOL_API_IMPL bool sg_isvalid(void) {
     return _sg.valid;
 }
 
+SOKOL_API_IMPL sg_context sg_make_context(const sg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    sg_context res = { SG_INVALID_ID };
+    int slot_index = 0;
+    for (int i = 1; i < _SG_MAX_CONTEXTS; i++) {
+        if (0 == _sg_contexts.states[i]) {
+            slot_index = i;
+            break;
+        }
+    }
+    if (0 == slot_index) {
+        _SG_ERROR(CONTEXT_POOL_EXHAUSTED);
+        return res;
+    }
+    // NOTE: can't use _sg_malloc() here since this uses the allocator of the current context
+    _sg_state_t* state;
+    if (desc->allocator.alloc_fn) {
+        state = (_sg_state_t*) desc->allocator.alloc_fn(sizeof(_sg_state_t), desc->allocator.user_data);
+    } else {
+        state = (_sg_state_t*) malloc(sizeof(_sg_state_t));
+    }
+    if (0 == state) {
+        _SG_PANIC(MALLOC_FAILED);
+        return res;
+    }
+    _sg_clear(state, sizeof(_sg_state_t));
+    _sg_state_t* prev_state = _sg_cur_state;
+    _sg_cur_state = state;
+    sg_setup(desc);
+    _sg_cur_state = prev_state;
+    _sg_contexts.unique_counter++;
+    res.id = (_sg_contexts.unique_counter << _SG_SLOT_SHIFT) | (uint32_t)(slot_index + 1);
+    _sg_contexts.ids[slot_index] = res.id;
+    _sg_contexts.states[slot_index] = state;
+    return res;
+}
+
+SOKOL_API_IMPL void sg_destroy_context(sg_context ctx) {
+    if (ctx.id == _SG_DEFAULT_CONTEXT_ID) {
+        _SG_ERROR(CONTEXT_DESTROY_DEFAULT);
+        return;
+    }
+    _sg_state_t* state = _sg_lookup_context(ctx.id);
+    if (0 == state) {
+        _SG_ERROR(CONTEXT_INVALID);
+        return;
+    }
+    const int slot_index = (int)(ctx.id & _SG_SLOT_MASK) - 1;
+    _sg_contexts.ids[slot_index] = 0;
+    _sg_contexts.states[slot_index] = 0;
+    _sg_state_t* prev_state = _sg_cur_state;
+    _sg_cur_state = state;
+    const sg_allocator allocator = _sg.desc.allocator;
+    sg_shutdown();
+    _sg_cur_state = (prev_state == state) ? &_sg_default_state : prev_state;
+    if (allocator.free_fn) {
+        allocator.free_fn(state, allocator.user_data);
+    } else {
+        free(state);
+    }
+}
+
+SOKOL_API_IMPL void sg_set_context(sg_context ctx) {
+    _sg_state_t* state = _sg_lookup_context(ctx.id);
+    if (state) {
+        _sg_cur_state = state;
+    } else {
+        _SG_ERROR(CONTEXT_INVALID);
+    }
+}
+
+SOKOL_API_IMPL sg_context sg_get_context(void) {
+    sg_context res = { _SG_DEFAULT_CONTEXT_ID };
+    if (_sg_cur_state != &_sg_default_state) {
+        for (int i = 1; i < _SG_MAX_CONTEXTS; i++) {
+            if (_sg_contexts.states[i] == _sg_cur_state) {
+                res.id = _sg_contexts.ids[i];
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_context sg_default_context(void) {
+    sg_context res = { _SG_DEFAULT_CONTEXT_ID };
+    return res;
+}
+
 SOKOL_API_IMPL sg_desc sg_query_desc(void) {
     SOKOL_ASSERT(_sg.valid);
     return _sg.desc;
@@ -17683,9 +23519,37 @@ SOKOL_API_IMPL int sg_query_surface_pitch(sg_pixel_format fmt, int width, int he
     return _sg_surface_pitch(fmt, width, height, row_align_bytes);
 }
 
-SOKOL_API_IMPL sg_frame_stats sg_query_frame_stats(void) {
+SOKOL_API_IMPL sg_transient_stats sg_query_transient_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_transient_stats res = _sg.transient.stats;
+    res.num_images = _sg.transient.num_images;
+    res.num_attachments = _sg.transient.num_atts;
+    for (int i = 0; i < _sg.transient.num_images; i++) {
+        if (_sg.transient.images[i].in_use) {
+            res.num_images_in_use++;
+        }
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_residency_stats sg_query_residency_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.residency.stats;
+}
+
+SOKOL_API_IMPL sg_dedup_stats sg_query_dedup_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.dedup.stats;
+}
+
+SOKOL_API_IMPL sg_frame_stats sg_query_frame_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.prev_stats;
+}
+
+SOKOL_API_IMPL sg_frame_pacing sg_query_frame_pacing(void) {
     SOKOL_ASSERT(_sg.valid);
-    return _sg.prev_stats;
+    return _sg.pacing.info;
 }
 
 SOKOL_API_IMPL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks) {
@@ -17705,42 +23569,42 @@ SOKOL_API_IMPL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace
 SOKOL_API_IMPL sg_buffer sg_alloc_buffer(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_buffer res = _sg_alloc_buffer();
-    _SG_TRACE_ARGS(alloc_buffer, res);
+    _SG_TRACE_ALLOC(alloc_buffer, res);
     return res;
 }
 
 SOKOL_API_IMPL sg_image sg_alloc_image(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_image res = _sg_alloc_image();
-    _SG_TRACE_ARGS(alloc_image, res);
+    _SG_TRACE_ALLOC(alloc_image, res);
     return res;
 }
 
 SOKOL_API_IMPL sg_sampler sg_alloc_sampler(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_sampler res = _sg_alloc_sampler();
-    _SG_TRACE_ARGS(alloc_sampler, res);
+    _SG_TRACE_ALLOC(alloc_sampler, res);
     return res;
 }
 
 SOKOL_API_IMPL sg_shader sg_alloc_shader(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_shader res = _sg_alloc_shader();
-    _SG_TRACE_ARGS(alloc_shader, res);
+    _SG_TRACE_ALLOC(alloc_shader, res);
     return res;
 }
 
 SOKOL_API_IMPL sg_pipeline sg_alloc_pipeline(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_pipeline res = _sg_alloc_pipeline();
-    _SG_TRACE_ARGS(alloc_pipeline, res);
+    _SG_TRACE_ALLOC(alloc_pipeline, res);
     return res;
 }
 
 SOKOL_API_IMPL sg_attachments sg_alloc_attachments(void) {
     SOKOL_ASSERT(_sg.valid);
     sg_attachments res = _sg_alloc_attachments();
-    _SG_TRACE_ARGS(alloc_attachments, res);
+    _SG_TRACE_ALLOC(alloc_attachments, res);
     return res;
 }
 
@@ -17852,6 +23716,74 @@ SOKOL_API_IMPL void sg_init_image(sg_image img_id, const sg_image_desc* desc) {
     _SG_TRACE_ARGS(init_image, img_id, &desc_def);
 }
 
+SOKOL_API_IMPL void sg_queue_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+        _sg_init_queue_item_t item;
+        _sg_clear(&item, sizeof(item));
+        item.res_id = buf_id.id;
+        item.desc.buf = _sg_buffer_desc_defaults(desc);
+        sg_buffer_desc* d = &item.desc.buf;
+        const size_t data_size = d->data.ptr ? d->data.size : 0;
+        const size_t total_size = data_size + _sg_label_size(d->label);
+        if (total_size > 0) {
+            item.data = _sg_malloc(total_size);
+            uint8_t* dst = (uint8_t*)item.data;
+            if (data_size > 0) {
+                memcpy(dst, d->data.ptr, data_size);
+                d->data.ptr = dst;
+                dst += data_size;
+            }
+            _sg_copy_label(dst, &d->label);
+        }
+        _sg_push_init_queue(&item);
+    #else
+        // without SOKOL_THREADSAFE_RESOURCES, initialize immediately
+        sg_init_buffer(buf_id, desc);
+    #endif
+}
+
+SOKOL_API_IMPL void sg_queue_init_image(sg_image img_id, const sg_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+        _sg_init_queue_item_t item;
+        _sg_clear(&item, sizeof(item));
+        item.res_id = img_id.id;
+        item.is_image = true;
+        item.desc.img = _sg_image_desc_defaults(desc);
+        sg_image_desc* d = &item.desc.img;
+        size_t total_size = _sg_label_size(d->label);
+        for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+            for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                if (d->data.subimage[face_index][mip_index].ptr) {
+                    total_size += d->data.subimage[face_index][mip_index].size;
+                }
+            }
+        }
+        if (total_size > 0) {
+            item.data = _sg_malloc(total_size);
+            uint8_t* dst = (uint8_t*)item.data;
+            for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+                for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                    sg_range* sub = &d->data.subimage[face_index][mip_index];
+                    if (sub->ptr && (sub->size > 0)) {
+                        memcpy(dst, sub->ptr, sub->size);
+                        sub->ptr = dst;
+                        dst += sub->size;
+                    }
+                }
+            }
+            _sg_copy_label(dst, &d->label);
+        }
+        _sg_push_init_queue(&item);
+    #else
+        // without SOKOL_THREADSAFE_RESOURCES, initialize immediately
+        sg_init_image(img_id, desc);
+    #endif
+}
+
 SOKOL_API_IMPL void sg_init_sampler(sg_sampler smp_id, const sg_sampler_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     sg_sampler_desc desc_def = _sg_sampler_desc_defaults(desc);
@@ -18120,12 +24052,31 @@ SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_buffer_desc desc_def = _sg_buffer_desc_defaults(desc);
+    const bool dedup = _sg_dedup_buffer_eligible(&desc_def);
+    _sg_dedup_key_t dedup_key;
+    _sg_clear(&dedup_key, sizeof(dedup_key));
+    _sg_dedup_content_t dedup_content;
+    if (dedup) {
+        _sg_dedup_buffer_content(&desc_def, &dedup_content);
+        dedup_key = _sg_dedup_content_key(&dedup_content);
+        const int slot_index = _sg_dedup_find(_SG_DEDUPKIND_BUFFER, &dedup_key, &dedup_content);
+        if (slot_index != 0) {
+            // NOTE: no trace hook call, a matching sg_destroy_buffer() won't call one either
+            _sg_buffer_t* buf = &_sg.pools.buffers[slot_index];
+            _sg_dedup_retain(&buf->cmn.dedup, _SG_DEDUPKIND_BUFFER);
+            sg_buffer res = { buf->slot.id };
+            return res;
+        }
+    }
     sg_buffer buf_id = _sg_alloc_buffer();
     if (buf_id.id != SG_INVALID_ID) {
         _sg_buffer_t* buf = _sg_buffer_at(&_sg.pools, buf_id.id);
         SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_buffer(buf, &desc_def);
         SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED));
+        if (dedup && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            _sg_dedup_insert(_SG_DEDUPKIND_BUFFER, _sg_slot_index(buf_id.id), &dedup_key, &dedup_content, desc_def.size);
+        }
     }
     _SG_TRACE_ARGS(make_buffer, &desc_def, buf_id);
     return buf_id;
@@ -18135,12 +24086,31 @@ SOKOL_API_IMPL sg_image sg_make_image(const sg_image_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_image_desc desc_def = _sg_image_desc_defaults(desc);
+    const bool dedup = _sg_dedup_image_eligible(&desc_def);
+    _sg_dedup_key_t dedup_key;
+    _sg_clear(&dedup_key, sizeof(dedup_key));
+    _sg_dedup_content_t dedup_content;
+    if (dedup) {
+        _sg_dedup_image_content(&desc_def, &dedup_content);
+        dedup_key = _sg_dedup_content_key(&dedup_content);
+        const int slot_index = _sg_dedup_find(_SG_DEDUPKIND_IMAGE, &dedup_key, &dedup_content);
+        if (slot_index != 0) {
+            // NOTE: no trace hook call, a matching sg_destroy_image() won't call one either
+            _sg_image_t* img = &_sg.pools.images[slot_index];
+            _sg_dedup_retain(&img->cmn.dedup, _SG_DEDUPKIND_IMAGE);
+            sg_image res = { img->slot.id };
+            return res;
+        }
+    }
     sg_image img_id = _sg_alloc_image();
     if (img_id.id != SG_INVALID_ID) {
         _sg_image_t* img = _sg_image_at(&_sg.pools, img_id.id);
         SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_image(img, &desc_def);
         SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED));
+        if (dedup && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+            _sg_dedup_insert(_SG_DEDUPKIND_IMAGE, _sg_slot_index(img_id.id), &dedup_key, &dedup_content, _sg_image_memory_size(&desc_def));
+        }
     }
     _SG_TRACE_ARGS(make_image, &desc_def, img_id);
     return img_id;
@@ -18165,7 +24135,12 @@ SOKOL_API_IMPL sg_shader sg_make_shader(const sg_shader_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_shader_desc desc_def = _sg_shader_desc_defaults(desc);
-    sg_shader shd_id = _sg_alloc_shader();
+    sg_shader shd_id = _sg_prewarm_claim_shader(&desc_def);
+    if (shd_id.id != SG_INVALID_ID) {
+        _SG_TRACE_ARGS(make_shader, &desc_def, shd_id);
+        return shd_id;
+    }
+    shd_id = _sg_alloc_shader();
     if (shd_id.id != SG_INVALID_ID) {
         _sg_shader_t* shd = _sg_shader_at(&_sg.pools, shd_id.id);
         SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
@@ -18180,7 +24155,12 @@ SOKOL_API_IMPL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_pipeline_desc desc_def = _sg_pipeline_desc_defaults(desc);
-    sg_pipeline pip_id = _sg_alloc_pipeline();
+    sg_pipeline pip_id = _sg_prewarm_claim_pipeline(&desc_def);
+    if (pip_id.id != SG_INVALID_ID) {
+        _SG_TRACE_ARGS(make_pipeline, &desc_def, pip_id);
+        return pip_id;
+    }
+    pip_id = _sg_alloc_pipeline();
     if (pip_id.id != SG_INVALID_ID) {
         _sg_pipeline_t* pip = _sg_pipeline_at(&_sg.pools, pip_id.id);
         SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
@@ -18191,6 +24171,29 @@ SOKOL_API_IMPL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc) {
     return pip_id;
 }
 
+SOKOL_API_IMPL sg_pipeline sg_make_pipeline_variant(sg_pipeline base_pip_id, const sg_pipeline_variant_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_pipeline_variant_desc desc_def = _sg_pipeline_variant_desc_defaults(desc);
+    const _sg_pipeline_t* base_pip = _sg_lookup_pipeline(&_sg.pools, base_pip_id.id);
+    const sg_pipeline_desc pip_desc = _sg_pipeline_variant_resolve(base_pip, &desc_def);
+    sg_pipeline pip_id = _sg_prewarm_claim_pipeline(&pip_desc);
+    if (pip_id.id != SG_INVALID_ID) {
+        _SG_TRACE_ARGS(make_pipeline, &pip_desc, pip_id);
+        return pip_id;
+    }
+    pip_id = _sg_alloc_pipeline();
+    if (pip_id.id != SG_INVALID_ID) {
+        _sg_pipeline_t* pip = _sg_pipeline_at(&_sg.pools, pip_id.id);
+        SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
+        _sg_init_pipeline_variant(pip, base_pip, &desc_def, &pip_desc);
+        SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+    }
+    // NOTE: trace hooks see the variant as a regular pipeline creation
+    _SG_TRACE_ARGS(make_pipeline, &pip_desc, pip_id);
+    return pip_id;
+}
+
 SOKOL_API_IMPL sg_attachments sg_make_attachments(const sg_attachments_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
@@ -18208,8 +24211,12 @@ SOKOL_API_IMPL sg_attachments sg_make_attachments(const sg_attachments_desc* des
 
 SOKOL_API_IMPL void sg_destroy_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
-    _SG_TRACE_ARGS(destroy_buffer, buf_id);
     _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
+    if (buf && _sg_dedup_release(&buf->cmn.dedup)) {
+        // a deduplicated buffer which is still referenced
+        return;
+    }
+    _SG_TRACE_ARGS(destroy_buffer, buf_id);
     if (buf) {
         if ((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_buffer(buf);
@@ -18224,8 +24231,12 @@ SOKOL_API_IMPL void sg_destroy_buffer(sg_buffer buf_id) {
 
 SOKOL_API_IMPL void sg_destroy_image(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
-    _SG_TRACE_ARGS(destroy_image, img_id);
     _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && _sg_dedup_release(&img->cmn.dedup)) {
+        // a deduplicated image which is still referenced
+        return;
+    }
+    _SG_TRACE_ARGS(destroy_image, img_id);
     if (img) {
         if ((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_image(img);
@@ -18312,7 +24323,10 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     if (!_sg_validate_begin_pass(&pass_def)) {
         return;
     }
-    if (pass_def.attachments.id != SG_INVALID_ID) {
+    if (pass_def.compute) {
+        // a compute pass, no render targets or swapchain involved
+        _sg.cur_pass.is_compute = true;
+    } else if (pass_def.attachments.id != SG_INVALID_ID) {
         // an offscreen pass
         SOKOL_ASSERT(_sg.cur_pass.atts == 0);
         _sg.cur_pass.atts = _sg_lookup_attachments(&_sg.pools, pass_def.attachments.id);
@@ -18323,6 +24337,12 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
         _sg.cur_pass.atts_id = pass_def.attachments;
         _sg.cur_pass.width = _sg.cur_pass.atts->cmn.width;
         _sg.cur_pass.height = _sg.cur_pass.atts->cmn.height;
+        if (_sg.cur_pass.atts->cmn.transient) {
+            _sg_touch_transient_attachments(pass_def.attachments.id);
+        }
+        #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+        _sg_track_attachments_usage(_sg.cur_pass.atts);
+        #endif
     } else {
         // a swapchain pass
         SOKOL_ASSERT(pass_def.swapchain.width > 0);
@@ -18337,7 +24357,10 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     }
     _sg.cur_pass.valid = true;  // may be overruled by backend begin-pass functions
     _sg.cur_pass.in_pass = true;
-    _sg_begin_pass(&pass_def);
+    _sg_uniform_cache_invalidate();
+    if (!pass_def.compute) {
+        _sg_begin_pass(&pass_def);
+    }
     _SG_TRACE_ARGS(begin_pass, &pass_def);
 }
 
@@ -18348,6 +24371,7 @@ SOKOL_API_IMPL void sg_apply_viewport(int x, int y, int width, int height, bool
     if (!_sg.cur_pass.valid) {
         return;
     }
+    _sg_flush_pending_draw();
     _sg_apply_viewport(x, y, width, height, origin_top_left);
     _SG_TRACE_ARGS(apply_viewport, x, y, width, height, origin_top_left);
 }
@@ -18363,6 +24387,7 @@ SOKOL_API_IMPL void sg_apply_scissor_rect(int x, int y, int width, int height, b
     if (!_sg.cur_pass.valid) {
         return;
     }
+    _sg_flush_pending_draw();
     _sg_apply_scissor_rect(x, y, width, height, origin_top_left);
     _SG_TRACE_ARGS(apply_scissor_rect, x, y, width, height, origin_top_left);
 }
@@ -18382,11 +24407,20 @@ SOKOL_API_IMPL void sg_apply_pipeline(sg_pipeline pip_id) {
     if (!_sg.cur_pass.valid) {
         return;
     }
+    if (_sg.cur_pipeline.id != pip_id.id) {
+        _sg_uniform_cache_invalidate();
+        _sg_flush_pending_draw();
+        _sg.coalesce.bindings_valid = false;
+    }
     _sg.cur_pipeline = pip_id;
     _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, pip_id.id);
     SOKOL_ASSERT(pip);
     _sg.next_draw_valid = (SG_RESOURCESTATE_VALID == pip->slot.state);
+    _sg.coalesce.prim_vertices = _sg_coalesce_prim_vertices(pip->cmn.primitive_type);
     SOKOL_ASSERT(pip->shader && (pip->shader->slot.id == pip->cmn.shader_id.id));
+    if (pip->cmn.manifest_entry > 0) {
+        _sg_manifest_first_use(pip);
+    }
     _sg_apply_pipeline(pip);
     _SG_TRACE_ARGS(apply_pipeline, pip_id);
 }
@@ -18411,6 +24445,9 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     if (0 == bnd.pip) {
         _sg.next_draw_valid = false;
     }
+    // compute-stage bindings go into the vertex stage slot
+    const bool is_compute = bnd.pip && bnd.pip->cmn.is_compute;
+    const sg_stage_bindings* vs_bnd = is_compute ? &bindings->cs : &bindings->vs;
 
     for (int i = 0; i < SG_MAX_VERTEX_BUFFERS; i++, bnd.num_vbs++) {
         if (bindings->vertex_buffers[i].id) {
@@ -18439,8 +24476,8 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     }
 
     for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGES; i++, bnd.num_vs_imgs++) {
-        if (bindings->vs.images[i].id) {
-            bnd.vs_imgs[i] = _sg_lookup_image(&_sg.pools, bindings->vs.images[i].id);
+        if (vs_bnd->images[i].id) {
+            bnd.vs_imgs[i] = _sg_residency_use_image(_sg_lookup_image(&_sg.pools, vs_bnd->images[i].id));
             if (bnd.vs_imgs[i]) {
                 _sg.next_draw_valid &= (SG_RESOURCESTATE_VALID == bnd.vs_imgs[i]->slot.state);
             } else {
@@ -18452,8 +24489,8 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     }
 
     for (int i = 0; i < SG_MAX_SHADERSTAGE_SAMPLERS; i++, bnd.num_vs_smps++) {
-        if (bindings->vs.samplers[i].id) {
-            bnd.vs_smps[i] = _sg_lookup_sampler(&_sg.pools, bindings->vs.samplers[i].id);
+        if (vs_bnd->samplers[i].id) {
+            bnd.vs_smps[i] = _sg_lookup_sampler(&_sg.pools, vs_bnd->samplers[i].id);
             if (bnd.vs_smps[i]) {
                 _sg.next_draw_valid &= (SG_RESOURCESTATE_VALID == bnd.vs_smps[i]->slot.state);
             } else {
@@ -18465,8 +24502,8 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     }
 
     for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++, bnd.num_vs_sbufs++) {
-        if (bindings->vs.storage_buffers[i].id) {
-            bnd.vs_sbufs[i] = _sg_lookup_buffer(&_sg.pools, bindings->vs.storage_buffers[i].id);
+        if (vs_bnd->storage_buffers[i].id) {
+            bnd.vs_sbufs[i] = _sg_lookup_buffer(&_sg.pools, vs_bnd->storage_buffers[i].id);
             if (bnd.vs_sbufs[i]) {
                 _sg.next_draw_valid &= (SG_RESOURCESTATE_VALID == bnd.vs_sbufs[i]->slot.state);
             } else {
@@ -18479,7 +24516,7 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
 
     for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGES; i++, bnd.num_fs_imgs++) {
         if (bindings->fs.images[i].id) {
-            bnd.fs_imgs[i] = _sg_lookup_image(&_sg.pools, bindings->fs.images[i].id);
+            bnd.fs_imgs[i] = _sg_residency_use_image(_sg_lookup_image(&_sg.pools, bindings->fs.images[i].id));
             if (bnd.fs_imgs[i]) {
                 _sg.next_draw_valid &= (SG_RESOURCESTATE_VALID == bnd.fs_imgs[i]->slot.state);
             } else {
@@ -18515,8 +24552,28 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
             break;
         }
     }
+
+    for (int i = 0; is_compute && (i < SG_MAX_SHADERSTAGE_STORAGEIMAGES); i++, bnd.num_simgs++) {
+        if (bindings->cs.storage_images[i].id) {
+            bnd.simgs[i] = _sg_lookup_image(&_sg.pools, bindings->cs.storage_images[i].id);
+            if (bnd.simgs[i]) {
+                _sg.next_draw_valid &= (SG_RESOURCESTATE_VALID == bnd.simgs[i]->slot.state);
+            } else {
+                _sg.next_draw_valid = false;
+            }
+        } else {
+            break;
+        }
+    }
     if (_sg.next_draw_valid) {
+        #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+        _sg_track_bindings_usage(&bnd);
+        #endif
+        if (_sg.desc.coalesce_draws) {
+            _sg_coalesce_apply_bindings(bindings);
+        }
         _sg.next_draw_valid &= _sg_apply_bindings(&bnd);
+        _sg.coalesce.bindings_valid &= _sg.next_draw_valid;
         _SG_TRACE_ARGS(apply_bindings, bindings);
     }
 }
@@ -18524,7 +24581,7 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
 SOKOL_API_IMPL void sg_apply_uniforms(sg_shader_stage stage, int ub_index, const sg_range* data) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
-    SOKOL_ASSERT((stage == SG_SHADERSTAGE_VS) || (stage == SG_SHADERSTAGE_FS));
+    SOKOL_ASSERT((stage == SG_SHADERSTAGE_VS) || (stage == SG_SHADERSTAGE_FS) || (stage == SG_SHADERSTAGE_CS));
     SOKOL_ASSERT((ub_index >= 0) && (ub_index < SG_MAX_SHADERSTAGE_UBS));
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
     _sg_stats_add(num_apply_uniforms, 1);
@@ -18539,7 +24596,15 @@ SOKOL_API_IMPL void sg_apply_uniforms(sg_shader_stage stage, int ub_index, const
     if (!_sg.next_draw_valid) {
         return;
     }
-    _sg_apply_uniforms(stage, ub_index, data);
+    // the compute stage occupies the internal vertex stage slot
+    const sg_shader_stage stage_index = (stage == SG_SHADERSTAGE_CS) ? SG_SHADERSTAGE_VS : stage;
+    if (_sg.desc.dedup_uniforms && _sg_uniform_cache_match(stage_index, ub_index, data)) {
+        _sg_stats_add(num_skipped_apply_uniforms, 1);
+        _sg_stats_add(size_skipped_apply_uniforms, (uint32_t)data->size);
+    } else {
+        _sg_flush_pending_draw();
+        _sg_apply_uniforms(stage_index, ub_index, data);
+    }
     _SG_TRACE_ARGS(apply_uniforms, stage, ub_index, data);
 }
 
@@ -18550,6 +24615,9 @@ SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instance
     SOKOL_ASSERT(num_elements >= 0);
     SOKOL_ASSERT(num_instances >= 0);
     _sg_stats_add(num_draw, 1);
+    if (!_sg_validate_draw()) {
+        return;
+    }
     if (!_sg.cur_pass.valid) {
         return;
     }
@@ -18562,26 +24630,115 @@ SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instance
     if ((0 == num_elements) || (0 == num_instances)) {
         return;
     }
-    _sg_draw(base_element, num_elements, num_instances);
+    if (_sg.desc.coalesce_draws && (_sg.coalesce.prim_vertices > 0)) {
+        _sg_coalesce_draw(base_element, num_elements, num_instances);
+    } else {
+        _sg_draw(base_element, num_elements, num_instances);
+    }
     _SG_TRACE_ARGS(draw, base_element, num_elements, num_instances);
 }
 
+SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(_sg.cur_pass.in_pass);
+    _sg_stats_add(num_dispatch, 1);
+    if (!_sg_validate_dispatch(num_groups_x, num_groups_y, num_groups_z)) {
+        return;
+    }
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    // dispatching zero workgroups is not an error, but there's nothing to do
+    if ((0 == num_groups_x) || (0 == num_groups_y) || (0 == num_groups_z)) {
+        return;
+    }
+    _sg_dispatch(num_groups_x, num_groups_y, num_groups_z);
+    _SG_TRACE_ARGS(dispatch, num_groups_x, num_groups_y, num_groups_z);
+}
+
 SOKOL_API_IMPL void sg_end_pass(void) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
     _sg_stats_add(num_passes, 1);
     // NOTE: don't exit early if !_sg.cur_pass.valid
-    _sg_end_pass();
+    if (_sg.cur_pass.is_compute) {
+        _sg_end_compute_pass();
+    } else {
+        _sg_flush_pending_draw();
+        _sg_end_pass();
+    }
+    _sg_clear(&_sg.coalesce, sizeof(_sg.coalesce));
     _sg.cur_pipeline.id = SG_INVALID_ID;
     _sg_clear(&_sg.cur_pass, sizeof(_sg.cur_pass));
     _SG_TRACE_NOARGS(end_pass);
 }
 
+// with sg_desc.max_frames_ahead > 0, insert a fence for the current frame,
+// then wait until the GPU has finished the frame committed max_frames_ahead
+// frames ago (never the current frame)
+_SOKOL_PRIVATE void _sg_frame_pacing_commit(void) {
+    _sg_frame_pacing_t* p = &_sg.pacing;
+    const int max_frames_ahead = _sg.desc.max_frames_ahead;
+    double wait_ms = 0.0;
+    bool waited = false;
+    int frames_in_flight = 0;
+    if (max_frames_ahead > 0) {
+        const uint32_t num_slots = (uint32_t)max_frames_ahead + 1;
+        SOKOL_ASSERT(num_slots <= _SG_MAX_FRAME_FENCES);
+        const int cur_slot = (int)(_sg.frame_index % num_slots);
+        const int wait_slot = (int)((_sg.frame_index + 1) % num_slots);
+        SOKOL_ASSERT(cur_slot != wait_slot);
+        // the previous fence in this slot has been waited for in the previous frame
+        _sg_insert_frame_fence(cur_slot);
+        p->pending[cur_slot] = true;
+        if (p->pending[wait_slot]) {
+            if (!_sg_frame_fence_signaled(wait_slot, false)) {
+                const double wait_start_ms = _sg_time_ms();
+                _sg_frame_fence_signaled(wait_slot, true);
+                wait_ms += _sg_time_ms() - wait_start_ms;
+                waited = true;
+            }
+            p->pending[wait_slot] = false;
+        }
+        for (int i = 0; i < (int)num_slots; i++) {
+            if (p->pending[i]) {
+                if (_sg_frame_fence_signaled(i, false)) {
+                    p->pending[i] = false;
+                } else {
+                    frames_in_flight++;
+                }
+            }
+        }
+    }
+    // Metal waits in sg_begin_pass(), the dummy backend only simulates waits
+    wait_ms += p->backend_wait_ms;
+    waited |= p->backend_waited;
+    p->backend_wait_ms = 0.0;
+    p->backend_waited = false;
+    p->info.frame_index = _sg.frame_index;
+    p->info.max_frames_in_flight = max_frames_ahead;
+    p->info.frames_in_flight = frames_in_flight;
+    p->info.wait_ms = wait_ms;
+    p->info.total_wait_ms += wait_ms;
+    if (waited) {
+        p->info.num_waits++;
+    }
+}
+
 SOKOL_API_IMPL void sg_commit(void) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
+    #if defined(SOKOL_THREADSAFE_RESOURCES)
+    _sg_process_init_queue();
+    #endif
     _sg_commit();
+    _sg_frame_pacing_commit();
+    _sg_gc_transient_pool();
+    _sg_residency_enforce_budget();
     _sg.stats.frame_index = _sg.frame_index;
     _sg.prev_stats = _sg.stats;
     _sg_clear(&_sg.stats, sizeof(_sg.stats));
@@ -18592,7 +24749,10 @@ SOKOL_API_IMPL void sg_commit(void) {
 
 SOKOL_API_IMPL void sg_reset_state_cache(void) {
     SOKOL_ASSERT(_sg.valid);
+    _sg_flush_pending_draw();
+    _sg.coalesce.bindings_valid = false;
     _sg_reset_state_cache();
+    _sg_uniform_cache_invalidate();
     _SG_TRACE_NOARGS(reset_state_cache);
 }
 
@@ -18601,6 +24761,7 @@ SOKOL_API_IMPL void sg_update_buffer(sg_buffer buf_id, const sg_range* data) {
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
     _sg_stats_add(num_update_buffer, 1);
     _sg_stats_add(size_update_buffer, (uint32_t)data->size);
+    _sg_flush_pending_draw();
     _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
     if ((data->size > 0) && buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
         if (_sg_validate_update_buffer(buf, data)) {
@@ -18611,27 +24772,75 @@ SOKOL_API_IMPL void sg_update_buffer(sg_buffer buf_id, const sg_range* data) {
             SOKOL_ASSERT(buf->cmn.append_frame_index != _sg.frame_index);
             _sg_update_buffer(buf, data);
             buf->cmn.update_frame_index = _sg.frame_index;
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            _sg_slot_track_update(&buf->slot, data->size);
+            #endif
+            // keep the shadow copy of ranged updates coherent
+            if (buf->cmn.shadow) {
+                _sg_buffer_common_track_update(&buf->cmn, 0, data);
+            }
         }
     }
     _SG_TRACE_ARGS(update_buffer, buf_id, data);
 }
 
+SOKOL_API_IMPL void sg_update_buffer_range(sg_buffer buf_id, size_t offset, const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    _sg_stats_add(num_update_buffer_range, 1);
+    _sg_stats_add(size_update_buffer_range, (uint32_t)data->size);
+    _sg_flush_pending_draw();
+    _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
+    if ((data->size > 0) && buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (_sg_validate_update_buffer_range(buf, offset, data)) {
+            SOKOL_ASSERT((offset + data->size) <= (size_t)buf->cmn.size);
+            SOKOL_ASSERT(buf->cmn.update_frame_index != _sg.frame_index);
+            SOKOL_ASSERT(buf->cmn.append_frame_index != _sg.frame_index);
+            #if !defined(SOKOL_WGPU)
+            // WebGPU writes the range directly into a single buffer, the other
+            // backends write or sync their buffers from a shadow copy
+            if (0 == buf->cmn.shadow) {
+                // NOTE: the shadow copy starts out zero-initialized, the previous
+                // buffer content isn't known on the CPU side
+                buf->cmn.shadow = (uint8_t*)_sg_malloc_clear((size_t)buf->cmn.size);
+            }
+            #endif
+            const bool new_frame = buf->cmn.update_range_frame_index != _sg.frame_index;
+            _sg_update_buffer_range(buf, (int)offset, data, new_frame);
+            buf->cmn.update_range_frame_index = _sg.frame_index;
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            _sg_slot_track_update(&buf->slot, data->size);
+            #endif
+        }
+    }
+    _SG_TRACE_ARGS(update_buffer_range, buf_id, offset, data);
+}
+
 SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(data && data->ptr);
     _sg_stats_add(num_append_buffer, 1);
     _sg_stats_add(size_append_buffer, (uint32_t)data->size);
+    _sg_flush_pending_draw();
     _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
     int result;
     if (buf) {
         // rewind append cursor in a new frame
         if (buf->cmn.append_frame_index != _sg.frame_index) {
+            // grow the buffer if it has overflown in the previous frame
+            if (buf->cmn.append_overflow && _sg_buffer_common_can_grow(&buf->cmn) && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+                _sg_grow_buffer(buf);
+            }
             buf->cmn.append_pos = 0;
             buf->cmn.append_overflow = false;
+            buf->cmn.append_demand = 0;
         }
         if (((size_t)buf->cmn.append_pos + data->size) > (size_t)buf->cmn.size) {
             buf->cmn.append_overflow = true;
         }
+        // saturate the append demand instead of overflowing
+        const uint64_t demand = (uint64_t)buf->cmn.append_demand + _sg_roundup_u64(data->size, 4);
+        buf->cmn.append_demand = (int)_sg_min(demand, (uint64_t)INT_MAX);
         const int start_pos = buf->cmn.append_pos;
         // NOTE: the multiple-of-4 requirement for the buffer offset is coming
         // from WebGPU, but we want identical behaviour between backends
@@ -18644,6 +24853,9 @@ SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
                     _sg_append_buffer(buf, data, buf->cmn.append_frame_index != _sg.frame_index);
                     buf->cmn.append_pos += (int) _sg_roundup_u64(data->size, 4);
                     buf->cmn.append_frame_index = _sg.frame_index;
+                    #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+                    _sg_slot_track_update(&buf->slot, data->size);
+                    #endif
                 }
             }
         }
@@ -18680,9 +24892,149 @@ SOKOL_API_IMPL bool sg_query_buffer_will_overflow(sg_buffer buf_id, size_t size)
     return result;
 }
 
+SOKOL_API_IMPL sg_buffer_view sg_alloc_buffer_view(sg_buffer buf_id, size_t size) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(size > 0);
+    sg_buffer_view view;
+    _sg_clear(&view, sizeof(view));
+    _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
+    if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (buf->cmn.views.max_views > 0) {
+            const int view_size = _sg_roundup((int)size, buf->cmn.views.alignment);
+            const int offset = _sg_buffer_views_alloc(&buf->cmn, view_size);
+            if (offset >= 0) {
+                view.buffer = buf_id;
+                view.offset = offset;
+                view.size = view_size;
+            }
+        } else {
+            _SG_ERROR(BUFFER_VIEWS_NOT_ENABLED);
+        }
+    }
+    return view;
+}
+
+SOKOL_API_IMPL void sg_free_buffer_view(sg_buffer_view view) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, view.buffer.id);
+    if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID) && (buf->cmn.views.max_views > 0)) {
+        if (!_sg_buffer_views_free(&buf->cmn, view.offset, view.size)) {
+            _SG_ERROR(BUFFER_VIEW_INVALID_FREE);
+        }
+    }
+}
+
+SOKOL_API_IMPL sg_image sg_acquire_transient_image(const sg_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_image res = { SG_INVALID_ID };
+    if (!desc->render_target) {
+        _SG_ERROR(TRANSIENT_IMAGE_NOT_RENDER_TARGET);
+        return res;
+    }
+    const sg_image_desc desc_def = _sg_image_desc_defaults(desc);
+    const _sg_transient_image_key_t key = _sg_transient_image_key(&desc_def);
+    _sg_transient_image_t* item = 0;
+    for (int i = 0; i < _sg.transient.num_images; i++) {
+        _sg_transient_image_t* cur = &_sg.transient.images[i];
+        if (!cur->in_use && _sg_transient_image_compatible(&cur->key, &key)) {
+            item = cur;
+            _sg.transient.stats.num_reused++;
+            break;
+        }
+    }
+    if (0 == item) {
+        if (_sg.transient.num_images >= _sg.transient.capacity) {
+            _SG_ERROR(TRANSIENT_POOL_EXHAUSTED);
+            return res;
+        }
+        const sg_image img = sg_make_image(&desc_def);
+        if (sg_query_image_state(img) != SG_RESOURCESTATE_VALID) {
+            sg_destroy_image(img);
+            return res;
+        }
+        item = &_sg.transient.images[_sg.transient.num_images++];
+        _sg_clear(item, sizeof(_sg_transient_image_t));
+        item->img = img;
+        item->key = key;
+        item->size = _sg_image_memory_size(&desc_def);
+        _sg.transient.stats.total_bytes += item->size;
+        _sg.transient.stats.peak_bytes = _sg_max(_sg.transient.stats.peak_bytes, _sg.transient.stats.total_bytes);
+    }
+    item->in_use = true;
+    item->last_used_frame = _sg.frame_index;
+    _sg.transient.stats.num_acquired++;
+    return item->img;
+}
+
+SOKOL_API_IMPL void sg_release_transient_image(sg_image img) {
+    SOKOL_ASSERT(_sg.valid);
+    for (int i = 0; i < _sg.transient.num_images; i++) {
+        _sg_transient_image_t* item = &_sg.transient.images[i];
+        if (item->img.id == img.id) {
+            if (item->in_use) {
+                item->in_use = false;
+                item->last_used_frame = _sg.frame_index;
+                return;
+            }
+            break;
+        }
+    }
+    _SG_ERROR(TRANSIENT_IMAGE_INVALID_RELEASE);
+}
+
+SOKOL_API_IMPL sg_attachments sg_make_transient_attachments(const sg_attachments_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    for (int i = 0; i < _sg.transient.num_atts; i++) {
+        _sg_transient_attachments_t* item = &_sg.transient.atts[i];
+        if (_sg_transient_attachments_equal(&item->desc, desc)) {
+            item->last_used_frame = _sg.frame_index;
+            return item->atts;
+        }
+    }
+    sg_attachments res = { SG_INVALID_ID };
+    if (_sg.transient.num_atts >= _sg.transient.atts_capacity) {
+        _SG_ERROR(TRANSIENT_ATTACHMENTS_CACHE_FULL);
+        return res;
+    }
+    res = sg_make_attachments(desc);
+    if (sg_query_attachments_state(res) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_attachments(res);
+        res.id = SG_INVALID_ID;
+        return res;
+    }
+    _sg_attachments_t* atts = _sg_lookup_attachments(&_sg.pools, res.id);
+    SOKOL_ASSERT(atts);
+    atts->cmn.transient = true;
+    _sg_transient_attachments_t* item = &_sg.transient.atts[_sg.transient.num_atts++];
+    item->atts = res;
+    item->desc = *desc;
+    item->desc.label = 0;
+    item->last_used_frame = _sg.frame_index;
+    return res;
+}
+
+SOKOL_API_IMPL void sg_pin_image(sg_image img_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+        img->cmn.pinned = true;
+    }
+}
+
+SOKOL_API_IMPL void sg_unpin_image(sg_image img_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+        img->cmn.pinned = false;
+    }
+}
+
 SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data) {
     SOKOL_ASSERT(_sg.valid);
     _sg_stats_add(num_update_image, 1);
+    _sg_flush_pending_draw();
     for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
         for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
             if (data->subimage[face_index][mip_index].size == 0) {
@@ -18697,20 +25049,146 @@ SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data)
             SOKOL_ASSERT(img->cmn.upd_frame_index != _sg.frame_index);
             _sg_update_image(img, data);
             img->cmn.upd_frame_index = _sg.frame_index;
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+                for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                    _sg_slot_track_update(&img->slot, data->subimage[face_index][mip_index].size);
+                }
+            }
+            #endif
         }
     }
     _SG_TRACE_ARGS(update_image, img_id, data);
 }
 
+SOKOL_API_IMPL void sg_update_image_mip(sg_image img_id, int mip_level, const sg_image_data* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(data);
+    _sg_flush_pending_draw();
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+        if (_sg_validate_update_image_mip(img, mip_level, data)) {
+            SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
+            const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1;
+            size_t num_bytes = 0;
+            for (int face_index = 0; face_index < num_faces; face_index++) {
+                num_bytes += data->subimage[face_index][mip_level].size;
+            }
+            _sg_stats_add(num_update_image_mip, 1);
+            _sg_stats_add(size_update_image_mip, (uint32_t)num_bytes);
+            // the base level only moves down when all smaller mipmaps are resident
+            const bool was_resident = 0 != (img->cmn.resident_mips & (1u << mip_level));
+            img->cmn.resident_mips |= 1u << mip_level;
+            while ((img->cmn.base_mip_level > 0) && (img->cmn.resident_mips & (1u << (img->cmn.base_mip_level - 1)))) {
+                img->cmn.base_mip_level--;
+            }
+            _sg_update_image_mip(img, mip_level, data);
+            if (img->cmn.evictable && !was_resident) {
+                const size_t mip_size = _sg_image_mip_memory_size(img->cmn.type,
+                    img->cmn.pixel_format,
+                    img->cmn.width,
+                    img->cmn.height,
+                    img->cmn.num_slices,
+                    img->cmn.sample_count,
+                    mip_level);
+                img->cmn.memory_size += mip_size;
+                sg_residency_stats* stats = &_sg.residency.stats;
+                stats->resident_bytes += mip_size;
+                stats->peak_bytes = _sg_max(stats->peak_bytes, stats->resident_bytes);
+            }
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            _sg_slot_track_update(&img->slot, num_bytes);
+            #endif
+        }
+    }
+    _SG_TRACE_ARGS(update_image_mip, img_id, mip_level, data);
+}
+
+SOKOL_API_IMPL bool sg_read_image_async(sg_image img_id, const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    if (!_sg.features.image_readback) {
+        _SG_ERROR(READBACK_NOT_SUPPORTED);
+        return false;
+    }
+    bool result = false;
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+        const sg_read_image_desc desc_def = _sg_read_image_desc_defaults(img, desc);
+        if (_sg_validate_read_image(img, &desc_def)) {
+            _sg_stats_add(num_read_image_async, 1);
+            result = _sg_read_image_async(img, &desc_def);
+        }
+    }
+    return result;
+}
+
+SOKOL_API_IMPL void sg_copy_buffer(sg_buffer dst_id, size_t dst_offset, sg_buffer src_id, size_t src_offset, size_t size) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg.features.copy_buffer) {
+        _SG_ERROR(COPY_BUFFER_NOT_SUPPORTED);
+        return;
+    }
+    _sg_buffer_t* dst = _sg_lookup_buffer(&_sg.pools, dst_id.id);
+    _sg_buffer_t* src = _sg_lookup_buffer(&_sg.pools, src_id.id);
+    if ((size > 0) && dst && (dst->slot.state == SG_RESOURCESTATE_VALID) && src && (src->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (_sg_validate_copy_buffer(dst, dst_offset, src, src_offset, size)) {
+            SOKOL_ASSERT((dst_offset + size) <= (size_t)dst->cmn.size);
+            SOKOL_ASSERT((src_offset + size) <= (size_t)src->cmn.size);
+            _sg_stats_add(num_copy_buffer, 1);
+            _sg_stats_add(size_copy_buffer, (uint32_t)size);
+            _sg_copy_buffer(dst, (int)dst_offset, src, (int)src_offset, (int)size);
+            // keep the shadow copy of ranged updates coherent
+            if (dst->cmn.shadow) {
+                SOKOL_ASSERT(src->cmn.shadow);
+                const sg_range data = { src->cmn.shadow + src_offset, size };
+                _sg_buffer_common_track_update(&dst->cmn, (int)dst_offset, &data);
+            }
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            _sg_slot_track_update(&dst->slot, size);
+            #endif
+        }
+    }
+    _SG_TRACE_ARGS(copy_buffer, dst_id, dst_offset, src_id, src_offset, size);
+}
+
+SOKOL_API_IMPL void sg_copy_image_region(const sg_image_copy_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    if (!_sg.features.copy_image) {
+        _SG_ERROR(COPY_IMAGE_NOT_SUPPORTED);
+        return;
+    }
+    _sg_image_t* dst = _sg_lookup_image(&_sg.pools, desc->dst.image.id);
+    _sg_image_t* src = _sg_lookup_image(&_sg.pools, desc->src.image.id);
+    if (dst && (dst->slot.state == SG_RESOURCESTATE_VALID) && src && (src->slot.state == SG_RESOURCESTATE_VALID)) {
+        const sg_image_copy_desc desc_def = _sg_image_copy_desc_defaults(src, desc);
+        if (_sg_validate_copy_image_region(dst, src, &desc_def)) {
+            const int num_bytes = _sg_surface_pitch(src->cmn.pixel_format, desc_def.width, desc_def.height, 1) * desc_def.num_slices;
+            _sg_stats_add(num_copy_image, 1);
+            _sg_stats_add(size_copy_image, (uint32_t)num_bytes);
+            _sg_copy_image_region(dst, src, &desc_def);
+            // reading from an evictable image counts as a use
+            _sg_residency_use_image(src);
+            #if defined(SOKOL_TRACK_RESOURCE_USAGE)
+            _sg_slot_track_update(&dst->slot, (size_t)num_bytes);
+            #endif
+        }
+    }
+    _SG_TRACE_ARGS(copy_image_region, desc);
+}
+
 SOKOL_API_IMPL void sg_push_debug_group(const char* name) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(name);
+    _sg_flush_pending_draw();
     _sg_push_debug_group(name);
     _SG_TRACE_ARGS(push_debug_group, name);
 }
 
 SOKOL_API_IMPL void sg_pop_debug_group(void) {
     SOKOL_ASSERT(_sg.valid);
+    _sg_flush_pending_draw();
     _sg_pop_debug_group();
     _SG_TRACE_NOARGS(pop_debug_group);
 }
@@ -18725,6 +25203,61 @@ SOKOL_API_IMPL bool sg_remove_commit_listener(sg_commit_listener listener) {
     return _sg_remove_commit_listener(&listener);
 }
 
+SOKOL_API_IMPL size_t sg_query_manifest_size(void) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg.desc.record_manifest) {
+        return 0;
+    }
+    _sg_manifest_build();
+    return _sg.manifest.scratch.size;
+}
+
+SOKOL_API_IMPL size_t sg_export_manifest(const sg_range* dst) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(dst && dst->ptr);
+    if (!_sg.desc.record_manifest) {
+        _SG_WARN(MANIFEST_NOT_RECORDING);
+        return 0;
+    }
+    _sg_manifest_build();
+    const size_t size = _sg.manifest.scratch.size;
+    if (dst->size < size) {
+        _SG_ERROR(MANIFEST_EXPORT_BUFFER_TOO_SMALL);
+        return 0;
+    }
+    memcpy((void*)dst->ptr, _sg.manifest.scratch.ptr, size);
+    return size;
+}
+
+SOKOL_API_IMPL bool sg_prewarm(const sg_range* manifest, double budget_ms) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(manifest);
+    if (!_sg.prewarm.started) {
+        _sg.prewarm.started = true;
+        if (!_sg_prewarm_parse(manifest)) {
+            // nothing to prewarm, but don't try again on the next call
+            _sg_discard_prewarm();
+            _sg.prewarm.started = true;
+            _sg.prewarm.done = true;
+        }
+    }
+    if (_sg.prewarm.done) {
+        return true;
+    }
+    const double start_ms = _sg_time_ms();
+    // create at least one resource per call, even with a zero budget
+    while (_sg.prewarm.cur < _sg.prewarm.num_entries) {
+        _sg_prewarm_create(_sg.prewarm.order[_sg.prewarm.cur++]);
+        if ((_sg_time_ms() - start_ms) >= budget_ms) {
+            break;
+        }
+    }
+    if (_sg.prewarm.cur >= _sg.prewarm.num_entries) {
+        _sg_prewarm_finish();
+    }
+    return _sg.prewarm.done;
+}
+
 SOKOL_API_IMPL void sg_enable_frame_stats(void) {
     SOKOL_ASSERT(_sg.valid);
     _sg.stats_enabled = true;
@@ -18758,6 +25291,14 @@ SOKOL_API_IMPL sg_buffer_info sg_query_buffer_info(sg_buffer buf_id) {
         info.num_slots = buf->cmn.num_slots;
         info.active_slot = buf->cmn.active_slot;
         #endif
+        info.views.num_views = buf->cmn.views.num_views;
+        info.views.num_free_ranges = buf->cmn.views.num_free;
+        for (int i = 0; i < buf->cmn.views.num_free; i++) {
+            const int range_size = buf->cmn.views.free[i].size;
+            info.views.free_size += range_size;
+            info.views.largest_free_size = _sg_max(info.views.largest_free_size, range_size);
+        }
+        info.usage = _sg_slot_query_usage(&buf->slot);
     }
     return info;
 }
@@ -18778,6 +25319,10 @@ SOKOL_API_IMPL sg_image_info sg_query_image_info(sg_image img_id) {
         info.num_slots = img->cmn.num_slots;
         info.active_slot = img->cmn.active_slot;
         #endif
+        info.use_frame_index = img->cmn.use_frame_index;
+        info.evicted = img->cmn.evicted;
+        info.base_mip_level = img->cmn.base_mip_level;
+        info.usage = _sg_slot_query_usage(&img->slot);
     }
     return info;
 }
@@ -18830,6 +25375,38 @@ SOKOL_API_IMPL sg_attachments_info sg_query_attachments_info(sg_attachments atts
     return info;
 }
 
+SOKOL_API_IMPL sg_buffer sg_query_next_buffer(sg_buffer prev_buf_id) {
+    SOKOL_ASSERT(_sg.valid);
+    const int start = (prev_buf_id.id == SG_INVALID_ID) ? 1 : _sg_slot_index(prev_buf_id.id) + 1;
+    sg_buffer res = { SG_INVALID_ID };
+    _sg_pool_lock(&_sg.pools.buffer_pool);
+    for (int i = start; i < _sg.pools.buffer_pool.size; i++) {
+        const _sg_slot_t* slot = &_sg.pools.buffers[i].slot;
+        if (slot->state == SG_RESOURCESTATE_VALID) {
+            res.id = slot->id;
+            break;
+        }
+    }
+    _sg_pool_unlock(&_sg.pools.buffer_pool);
+    return res;
+}
+
+SOKOL_API_IMPL sg_image sg_query_next_image(sg_image prev_img_id) {
+    SOKOL_ASSERT(_sg.valid);
+    const int start = (prev_img_id.id == SG_INVALID_ID) ? 1 : _sg_slot_index(prev_img_id.id) + 1;
+    sg_image res = { SG_INVALID_ID };
+    _sg_pool_lock(&_sg.pools.image_pool);
+    for (int i = start; i < _sg.pools.image_pool.size; i++) {
+        const _sg_slot_t* slot = &_sg.pools.images[i].slot;
+        if (slot->state == SG_RESOURCESTATE_VALID) {
+            res.id = slot->id;
+            break;
+        }
+    }
+    _sg_pool_unlock(&_sg.pools.image_pool);
+    return res;
+}
+
 SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     sg_buffer_desc desc;
@@ -18839,6 +25416,9 @@ SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
         desc.size = (size_t)buf->cmn.size;
         desc.type = buf->cmn.type;
         desc.usage = buf->cmn.usage;
+        desc.max_views = buf->cmn.views.max_views;
+        desc.view_alignment = buf->cmn.views.alignment;
+        desc.max_size = (size_t)buf->cmn.max_size;
     }
     return desc;
 }
@@ -18851,6 +25431,7 @@ SOKOL_API_IMPL sg_image_desc sg_query_image_desc(sg_image img_id) {
     if (img) {
         desc.type = img->cmn.type;
         desc.render_target = img->cmn.render_target;
+        desc.storage_image = img->cmn.storage_image;
         desc.width = img->cmn.width;
         desc.height = img->cmn.height;
         desc.num_slices = img->cmn.num_slices;
@@ -18890,7 +25471,11 @@ SOKOL_API_IMPL sg_shader_desc sg_query_shader_desc(sg_shader shd_id) {
     const _sg_shader_t* shd = _sg_lookup_shader(&_sg.pools, shd_id.id);
     if (shd) {
         for (int stage_idx = 0; stage_idx < SG_NUM_SHADER_STAGES; stage_idx++) {
-            sg_shader_stage_desc* stage_desc = (stage_idx == 0) ? &desc.vs : &desc.fs;
+            if (shd->cmn.is_compute && (stage_idx != SG_SHADERSTAGE_VS)) {
+                continue;
+            }
+            // a compute shader lives in the internal vertex stage slot
+            sg_shader_stage_desc* stage_desc = shd->cmn.is_compute ? &desc.cs : ((stage_idx == 0) ? &desc.vs : &desc.fs);
             const _sg_shader_stage_t* stage = &shd->cmn.stage[stage_idx];
             for (int ub_idx = 0; ub_idx < stage->num_uniform_blocks; ub_idx++) {
                 sg_shader_uniform_block_desc* ub_desc = &stage_desc->uniform_blocks[ub_idx];
@@ -18919,6 +25504,14 @@ SOKOL_API_IMPL sg_shader_desc sg_query_shader_desc(sg_shader shd_id) {
                 img_smp_desc->sampler_slot = img_smp->sampler_slot;
                 img_smp_desc->glsl_name = 0;
             }
+            for (int simg_idx = 0; simg_idx < stage->num_storage_images; simg_idx++) {
+                sg_shader_storage_image_desc* simg_desc = &stage_desc->storage_images[simg_idx];
+                const _sg_shader_storage_image_t* simg = &stage->storage_images[simg_idx];
+                simg_desc->used = true;
+                simg_desc->image_type = simg->image_type;
+                simg_desc->access_format = simg->access_format;
+                simg_desc->readonly = simg->readonly;
+            }
         }
     }
     return desc;
@@ -18930,6 +25523,7 @@ SOKOL_API_IMPL sg_pipeline_desc sg_query_pipeline_desc(sg_pipeline pip_id) {
     _sg_clear(&desc, sizeof(desc));
     const _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, pip_id.id);
     if (pip) {
+        desc.compute = pip->cmn.is_compute;
         desc.shader = pip->cmn.shader_id;
         desc.layout = pip->cmn.layout;
         desc.depth = pip->cmn.depth;
@@ -19149,7 +25743,7 @@ SOKOL_API_IMPL sg_mtl_buffer_info sg_mtl_query_buffer_info(sg_buffer buf_id) {
     #if defined(SOKOL_METAL)
         const _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
         if (buf) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
                 if (buf->mtl.buf[i] != 0) {
                     res.buf[i] = (__bridge void*) _sg_mtl_id(buf->mtl.buf[i]);
                 }
@@ -19169,7 +25763,7 @@ SOKOL_API_IMPL sg_mtl_image_info sg_mtl_query_image_info(sg_image img_id) {
     #if defined(SOKOL_METAL)
         const _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
         if (img) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
                 if (img->mtl.tex[i] != 0) {
                     res.tex[i] = (__bridge void*) _sg_mtl_id(img->mtl.tex[i]);
                 }
@@ -19385,7 +25979,7 @@ SOKOL_API_IMPL sg_gl_buffer_info sg_gl_query_buffer_info(sg_buffer buf_id) {
     #if defined(_SOKOL_ANY_GL)
         const _sg_buffer_t* buf = _sg_lookup_buffer(&_sg.pools, buf_id.id);
         if (buf) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
                 res.buf[i] = buf->gl.buf[i];
             }
             res.active_slot = buf->cmn.active_slot;
@@ -19403,7 +25997,7 @@ SOKOL_API_IMPL sg_gl_image_info sg_gl_query_image_info(sg_image img_id) {
     #if defined(_SOKOL_ANY_GL)
         const _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
         if (img) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_INFLIGHT_FRAMES; i++) {
                 res.tex[i] = img->gl.tex[i];
             }
             res.tex_target = img->gl.target;
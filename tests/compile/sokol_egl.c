@@ -0,0 +1,10 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_egl.h"
+
+void use_egl_impl(void) {
+    segl_setup(&(segl_desc_t){0});
+    const sg_environment env = segl_environment();
+    (void)env;
+    segl_shutdown();
+}
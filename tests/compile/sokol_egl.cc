@@ -0,0 +1,11 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_egl.h"
+
+void use_egl_impl() {
+    segl_desc_t desc = {};
+    segl_setup(desc);
+    const sg_environment env = segl_environment();
+    (void)env;
+    segl_shutdown();
+}
@@ -0,0 +1,623 @@
+//------------------------------------------------------------------------------
+//  sokol-gfx-gl-test.c
+//
+//  Tests for the GL backend which need a real GL context, rendering happens
+//  headless via sokol_egl.h. If no EGL display is available (e.g. in a
+//  container without Mesa), the tests are skipped.
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_egl.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#if defined(SOKOL_GLCORE)
+#define GLSL_VERSION "#version 410\n"
+#else
+#define GLSL_VERSION "#version 300 es\nprecision mediump float;\n"
+#endif
+
+#define MAX_LOGITEMS (32)
+static int num_log_called = 0;
+static sg_log_item log_items[MAX_LOGITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag;
+    (void)log_level;
+    (void)message_or_null;
+    (void)line_nr;
+    (void)filename_or_null;
+    (void)user_data;
+    if (num_log_called < MAX_LOGITEMS) {
+        log_items[num_log_called++] = log_item_id;
+    }
+    if (message_or_null) {
+        printf("%s\n", message_or_null);
+    }
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    memset(log_items, 0, sizeof(log_items));
+}
+
+// returns false if no GL context could be created, the test should be skipped then
+static bool setup(const sg_desc* desc) {
+    reset_log_items();
+    segl_setup(&(segl_desc_t){ .width = 64, .height = 64 });
+    if (!segl_isvalid()) {
+        printf("no EGL display available, skipping test\n");
+        segl_shutdown();
+        return false;
+    }
+    sg_desc desc_with_env = *desc;
+    desc_with_env.environment = segl_environment();
+    desc_with_env.logger.func = test_logger;
+    sg_setup(&desc_with_env);
+    return true;
+}
+
+static void teardown(void) {
+    sg_shutdown();
+    segl_shutdown();
+}
+
+static void begin_pass(void) {
+    sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain() });
+}
+
+static sg_buffer create_buffer(void) {
+    static const float data[64] = { 0 };
+    return sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+}
+
+static GLuint gl_buffer(sg_buffer buf) {
+    const _sg_buffer_t* b = _sg_lookup_buffer(&_sg.pools, buf.id);
+    return b ? b->gl.buf[b->cmn.active_slot] : 0;
+}
+
+static sg_shader make_shader(void) {
+    return sg_make_shader(&(sg_shader_desc){
+        .attrs[0].name = "position",
+        .vs.source =
+            GLSL_VERSION
+            "in vec4 position;\n"
+            "void main() { gl_Position = position; }\n",
+        .fs.source =
+            GLSL_VERSION
+            "out vec4 frag_color;\n"
+            "void main() { frag_color = vec4(1.0); }\n",
+    });
+}
+
+static sg_pipeline make_pipeline(sg_shader shd, int stride, sg_vertex_step step_func) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout = {
+            .buffers[0] = { .stride = stride, .step_func = step_func },
+            .attrs[0].format = SG_VERTEXFORMAT_FLOAT4,
+        },
+    });
+}
+
+static GLint vertex_attrib(GLenum pname) {
+    GLint val = -1;
+    glGetVertexAttribiv(0, pname, &val);
+    return val;
+}
+
+// check that the hash buckets and the LRU list of the VAO cache are consistent
+static bool vao_cache_consistent(void) {
+    const _sg_gl_vao_cache_t* c = &_sg.gl.vao_cache;
+    int num_used = 0;
+    for (int i = 0; i < c->num; i++) {
+        if (c->items[i].vao) {
+            num_used++;
+        }
+    }
+    int num_in_buckets = 0;
+    for (int b = 0; b < c->num_buckets; b++) {
+        for (int i = c->buckets[b]; i >= 0; i = c->items[i].bucket_next) {
+            if ((0 == c->items[i].vao) || (_sg_gl_vao_cache_bucket(c->items[i].key.hash) != b)) {
+                return false;
+            }
+            num_in_buckets++;
+        }
+    }
+    // all items are in the LRU list, used items first
+    int num_in_list = 0;
+    bool seen_unused = false;
+    for (int i = c->lru_head; i >= 0; i = c->items[i].lru_next) {
+        if (c->items[i].vao && seen_unused) {
+            return false;
+        }
+        seen_unused |= (0 == c->items[i].vao);
+        num_in_list++;
+    }
+    return (num_used == num_in_buckets) && (num_in_list == c->num);
+}
+
+static sg_image create_image(sg_usage usage) {
+    static uint32_t pixels[4][4];
+    sg_image_desc desc = { .width = 4, .height = 4, .usage = usage };
+    if (usage == SG_USAGE_IMMUTABLE) {
+        desc.data.subimage[0][0] = SG_RANGE(pixels);
+    }
+    return sg_make_image(&desc);
+}
+
+// a shader with 3 image-sampler pairs in the fragment stage
+static sg_pipeline make_texture_pipeline(void) {
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vs.source =
+            GLSL_VERSION
+            "void main() { gl_Position = vec4(0.0, 0.0, 0.0, 1.0); }\n",
+        .fs = {
+            .source =
+                GLSL_VERSION
+                "uniform sampler2D tex0;\n"
+                "uniform sampler2D tex1;\n"
+                "uniform sampler2D tex2;\n"
+                "out vec4 frag_color;\n"
+                "void main() { frag_color = texture(tex0, vec2(0.5)) + texture(tex1, vec2(0.5)) + texture(tex2, vec2(0.5)); }\n",
+            .images = {
+                [0] = { .used = true, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+                [1] = { .used = true, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+                [2] = { .used = true, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+            },
+            .samplers[0] = { .used = true, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+            .image_sampler_pairs = {
+                [0] = { .used = true, .image_slot = 0, .sampler_slot = 0, .glsl_name = "tex0" },
+                [1] = { .used = true, .image_slot = 1, .sampler_slot = 0, .glsl_name = "tex1" },
+                [2] = { .used = true, .image_slot = 2, .sampler_slot = 0, .glsl_name = "tex2" },
+            },
+        },
+    });
+    return sg_make_pipeline(&(sg_pipeline_desc){ .shader = shd });
+}
+
+static void apply_textures(sg_image img0, sg_image img1, sg_image img2, sg_sampler smp) {
+    sg_apply_bindings(&(sg_bindings){
+        .fs = {
+            .images = { [0] = img0, [1] = img1, [2] = img2 },
+            .samplers[0] = smp,
+        },
+    });
+}
+
+// check that the GL texture and sampler bindings match the state cache
+static bool texture_sampler_cache_coherent(void) {
+    GLint active_texture = 0;
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &active_texture);
+    if ((0 != _sg.gl.cache.cur_active_texture) && ((GLenum)active_texture != _sg.gl.cache.cur_active_texture)) {
+        return false;
+    }
+    bool coherent = true;
+    const int num_slots = _sg_min(_SG_GL_TEXTURE_SAMPLER_CACHE_SIZE, _sg.limits.gl_max_combined_texture_image_units);
+    for (int i = 0; i < num_slots; i++) {
+        const _sg_gl_cache_texture_sampler_bind_slot* slot = &_sg.gl.cache.texture_samplers[i];
+        glActiveTexture((GLenum)(GL_TEXTURE0 + i));
+        GLint tex = -1;
+        GLint smp = -1;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &tex);
+        glGetIntegerv(GL_SAMPLER_BINDING, &smp);
+        const GLuint expected_tex = (slot->target == GL_TEXTURE_2D) ? slot->texture : 0;
+        coherent &= ((GLuint)tex == expected_tex) && ((GLuint)smp == slot->sampler);
+    }
+    glActiveTexture((GLenum)active_texture);
+    return coherent;
+}
+
+#if defined(SOKOL_GLCORE)
+// a shader with 2 storage buffers in the fragment stage (needs GL 4.3)
+static sg_pipeline make_storage_buffer_pipeline(void) {
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vs.source =
+            "#version 430\n"
+            "void main() { gl_Position = vec4(0.0, 0.0, 0.0, 1.0); }\n",
+        .fs = {
+            .source =
+                "#version 430\n"
+                "layout(std430, binding=8) readonly buffer sb0 { vec4 data0[]; };\n"
+                "layout(std430, binding=9) readonly buffer sb1 { vec4 data1[]; };\n"
+                "out vec4 frag_color;\n"
+                "void main() { frag_color = data0[0] + data1[0]; }\n",
+            .storage_buffers = {
+                [0] = { .used = true, .readonly = true },
+                [1] = { .used = true, .readonly = true },
+            },
+        },
+    });
+    return sg_make_pipeline(&(sg_pipeline_desc){ .shader = shd });
+}
+
+static sg_buffer create_storage_buffer(sg_usage usage) {
+    static const float data[16] = { 0 };
+    sg_buffer_desc desc = { .type = SG_BUFFERTYPE_STORAGEBUFFER, .usage = usage };
+    if (usage == SG_USAGE_IMMUTABLE) {
+        desc.data = SG_RANGE(data);
+    } else {
+        desc.size = sizeof(data);
+    }
+    return sg_make_buffer(&desc);
+}
+
+// check that the GL storage buffer bindings match the state cache
+static bool storage_buffer_cache_coherent(void) {
+    bool coherent = true;
+    for (int stage = 0; stage < SG_NUM_SHADER_STAGES; stage++) {
+        for (int slot = 0; slot < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; slot++) {
+            GLint buf = -1;
+            glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, _sg_gl_storagebuffer_bind_index(stage, slot), &buf);
+            coherent &= ((GLuint)buf == _sg.gl.cache.stage_storage_buffers[stage][slot]);
+        }
+    }
+    GLint generic_buf = -1;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_BINDING, &generic_buf);
+    coherent &= ((GLuint)generic_buf == _sg.gl.cache.storage_buffer);
+    return coherent;
+}
+#endif
+
+// read the pixels of the active texture of an RGBA8 image through a temporary framebuffer
+static void read_image_pixels(sg_image img, uint32_t* pixels) {
+    const _sg_image_t* i = _sg_lookup_image(&_sg.pools, img.id);
+    GLint prev_fb = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prev_fb);
+    GLuint fb = 0;
+    glGenFramebuffers(1, &fb);
+    glBindFramebuffer(GL_FRAMEBUFFER, fb);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, i->gl.tex[i->cmn.active_slot], 0);
+    glReadPixels(0, 0, i->cmn.width, i->cmn.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)prev_fb);
+    glDeleteFramebuffers(1, &fb);
+}
+
+static void fill_pixels(uint32_t* pixels, int num_pixels, uint32_t seed) {
+    for (int i = 0; i < num_pixels; i++) {
+        pixels[i] = (seed * 0x9E3779B9) ^ (uint32_t)i;
+    }
+}
+
+static bool check_image_pixels(sg_image img, const uint32_t* expected, int num_pixels) {
+    static uint32_t pixels[256 * 256];
+    SOKOL_ASSERT(num_pixels <= (256 * 256));
+    memset(pixels, 0, sizeof(pixels));
+    read_image_pixels(img, pixels);
+    return 0 == memcmp(pixels, expected, (size_t)num_pixels * sizeof(uint32_t));
+}
+
+UTEST(sokol_gfx_gl, vao_cache_key) {
+    if (!setup(&(sg_desc){ .gl_vao_cache_size = 8 })) {
+        return;
+    }
+    sg_buffer vbuf = create_buffer();
+    sg_shader shd = make_shader();
+    // pipelines which only differ in the vertex stride or step function must not share a VAO
+    sg_pipeline pips[3] = {
+        make_pipeline(shd, 16, SG_VERTEXSTEP_PER_VERTEX),
+        make_pipeline(shd, 32, SG_VERTEXSTEP_PER_VERTEX),
+        make_pipeline(shd, 16, SG_VERTEXSTEP_PER_INSTANCE),
+    };
+    const GLint strides[3] = { 16, 32, 16 };
+    const GLint divisors[3] = { 0, 0, 1 };
+    begin_pass();
+    for (int iter = 0; iter < 2; iter++) {
+        for (int i = 0; i < 3; i++) {
+            sg_apply_pipeline(pips[i]);
+            sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+            T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_STRIDE) == strides[i]);
+            T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_DIVISOR) == divisors[i]);
+            T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING) == (GLint)gl_buffer(vbuf));
+            sg_draw(0, 3, 1);
+        }
+    }
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_vao_cache_misses == 3);
+    T(sg_query_frame_stats().gl.num_vao_cache_hits == 3);
+    T(vao_cache_consistent());
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_lru) {
+    if (!setup(&(sg_desc){ .gl_vao_cache_size = 2 })) {
+        return;
+    }
+    sg_buffer bufs[3] = { create_buffer(), create_buffer(), create_buffer() };
+    sg_pipeline pip = make_pipeline(make_shader(), 16, SG_VERTEXSTEP_PER_VERTEX);
+    // 0, 1, 2 (evicts 0), 2, 1, 0 (evicts 2), 1
+    const int order[7] = { 0, 1, 2, 2, 1, 0, 1 };
+    begin_pass();
+    sg_apply_pipeline(pip);
+    for (int i = 0; i < 7; i++) {
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = bufs[order[i]] });
+        T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING) == (GLint)gl_buffer(bufs[order[i]]));
+        sg_draw(0, 3, 1);
+        T(vao_cache_consistent());
+    }
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_vao_cache_misses == 4);
+    T(sg_query_frame_stats().gl.num_vao_cache_hits == 3);
+    T(sg_query_frame_stats().gl.num_vao_cache_evictions == 2);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_destroy_buffer) {
+    if (!setup(&(sg_desc){ .gl_vao_cache_size = 4 })) {
+        return;
+    }
+    sg_buffer buf0 = create_buffer();
+    sg_buffer buf1 = create_buffer();
+    sg_pipeline pip = make_pipeline(make_shader(), 16, SG_VERTEXSTEP_PER_VERTEX);
+    begin_pass();
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = buf0 });
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = buf1 });
+    sg_end_pass();
+    sg_commit();
+    // destroying a buffer evicts all VAOs referencing it
+    sg_destroy_buffer(buf0);
+    T(vao_cache_consistent());
+    begin_pass();
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = buf1 });
+    T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING) == (GLint)gl_buffer(buf1));
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_vao_cache_evictions == 1);
+    T(sg_query_frame_stats().gl.num_vao_cache_hits == 1);
+    T(sg_query_frame_stats().gl.num_vao_cache_misses == 0);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_many) {
+    if (!setup(&(sg_desc){ .gl_vao_cache_size = 16, .buffer_pool_size = 64 })) {
+        return;
+    }
+    sg_buffer bufs[24];
+    for (int i = 0; i < 24; i++) {
+        bufs[i] = create_buffer();
+    }
+    sg_pipeline pip = make_pipeline(make_shader(), 16, SG_VERTEXSTEP_PER_VERTEX);
+    begin_pass();
+    sg_apply_pipeline(pip);
+    for (int iter = 0; iter < 3; iter++) {
+        for (int i = 0; i < 24; i++) {
+            // a working set which fits into the cache, and some buffers which don't
+            const int buf_index = ((i % 2) == 0) ? (i % 12) : i;
+            sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = bufs[buf_index] });
+            T(vertex_attrib(GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING) == (GLint)gl_buffer(bufs[buf_index]));
+        }
+        T(vao_cache_consistent());
+    }
+    sg_end_pass();
+    sg_commit();
+    const sg_frame_stats_gl stats = sg_query_frame_stats().gl;
+    T((stats.num_vao_cache_hits + stats.num_vao_cache_misses) == 72);
+    T(stats.num_vao_cache_hits > 0);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, multi_bind_textures) {
+    if (!setup(&(sg_desc){0})) {
+        return;
+    }
+    sg_image img_a = create_image(SG_USAGE_IMMUTABLE);
+    sg_image img_b = create_image(SG_USAGE_IMMUTABLE);
+    sg_image img_c = create_image(SG_USAGE_IMMUTABLE);
+    sg_image img_d = create_image(SG_USAGE_IMMUTABLE);
+    sg_image img_dyn = create_image(SG_USAGE_DYNAMIC);
+    sg_sampler smp0 = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_sampler smp1 = sg_make_sampler(&(sg_sampler_desc){ .min_filter = SG_FILTER_LINEAR });
+    sg_pipeline pip = make_texture_pipeline();
+    // resource creation binds textures, keep it out of the frame stats below
+    sg_commit();
+    begin_pass();
+    sg_apply_pipeline(pip);
+    apply_textures(img_a, img_b, img_c, smp0);
+    T(texture_sampler_cache_coherent());
+    sg_draw(0, 1, 1);
+    // only the middle slot changes
+    apply_textures(img_a, img_d, img_c, smp0);
+    T(texture_sampler_cache_coherent());
+    sg_draw(0, 1, 1);
+    // unchanged bindings
+    apply_textures(img_a, img_d, img_c, smp0);
+    T(texture_sampler_cache_coherent());
+    // the sampler changes in all slots
+    apply_textures(img_a, img_d, img_dyn, smp1);
+    T(texture_sampler_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    if (_sg.gl.ext_multi_bind) {
+        // one glBindTextures() per sg_apply_bindings() with changed bindings
+        T(sg_query_frame_stats().gl.num_multi_bind_textures == 3);
+        T(sg_query_frame_stats().gl.num_multi_bind_samplers == 3);
+        // ...and glBindTexture() is only called to unbind the 3 slots in sg_commit()
+        T(sg_query_frame_stats().gl.num_bind_texture == 3 * 4);
+    }
+
+    // image updates temporarily bind the texture via the single-bind path
+    static uint32_t pixels[4][4];
+    sg_update_image(img_dyn, &(sg_image_data){ .subimage[0][0] = SG_RANGE(pixels) });
+    T(texture_sampler_cache_coherent());
+    begin_pass();
+    sg_apply_pipeline(pip);
+    apply_textures(img_b, img_a, img_dyn, smp1);
+    T(texture_sampler_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+
+    // destroying bound resources clears their bindings
+    sg_destroy_image(img_a);
+    T(texture_sampler_cache_coherent());
+    sg_destroy_sampler(smp1);
+    T(texture_sampler_cache_coherent());
+    begin_pass();
+    sg_apply_pipeline(pip);
+    apply_textures(img_b, img_c, img_d, smp0);
+    T(texture_sampler_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    sg_reset_state_cache();
+    T(texture_sampler_cache_coherent());
+    T(glGetError() == GL_NO_ERROR);
+    T(num_log_called == 0);
+    teardown();
+}
+
+#if defined(SOKOL_GLCORE)
+UTEST(sokol_gfx_gl, multi_bind_storage_buffers) {
+    if (!setup(&(sg_desc){0})) {
+        return;
+    }
+    if (!sg_query_features().storage_buffer) {
+        printf("storage buffers not supported, skipping test\n");
+        teardown();
+        return;
+    }
+    sg_buffer sbuf_a = create_storage_buffer(SG_USAGE_IMMUTABLE);
+    sg_buffer sbuf_b = create_storage_buffer(SG_USAGE_IMMUTABLE);
+    sg_buffer sbuf_c = create_storage_buffer(SG_USAGE_IMMUTABLE);
+    sg_buffer sbuf_dyn = create_storage_buffer(SG_USAGE_DYNAMIC);
+    sg_pipeline pip = make_storage_buffer_pipeline();
+    T(storage_buffer_cache_coherent());
+    sg_commit();
+    begin_pass();
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .fs.storage_buffers = { [0] = sbuf_a, [1] = sbuf_b } });
+    T(storage_buffer_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_apply_bindings(&(sg_bindings){ .fs.storage_buffers = { [0] = sbuf_a, [1] = sbuf_c } });
+    T(storage_buffer_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_apply_bindings(&(sg_bindings){ .fs.storage_buffers = { [0] = sbuf_a, [1] = sbuf_c } });
+    T(storage_buffer_cache_coherent());
+    sg_apply_bindings(&(sg_bindings){ .fs.storage_buffers = { [0] = sbuf_dyn, [1] = sbuf_c } });
+    T(storage_buffer_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    if (_sg.gl.ext_multi_bind) {
+        T(sg_query_frame_stats().gl.num_multi_bind_buffers == 3);
+    }
+
+    // buffer updates go through the generic binding point
+    static const float data[16] = { 1.0f };
+    sg_update_buffer(sbuf_dyn, &SG_RANGE(data));
+    T(storage_buffer_cache_coherent());
+    begin_pass();
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .fs.storage_buffers = { [0] = sbuf_dyn, [1] = sbuf_b } });
+    T(storage_buffer_cache_coherent());
+    sg_draw(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+
+    // destroying a bound buffer clears its bindings
+    sg_destroy_buffer(sbuf_b);
+    T(storage_buffer_cache_coherent());
+    sg_reset_state_cache();
+    T(storage_buffer_cache_coherent());
+    T(glGetError() == GL_NO_ERROR);
+    T(num_log_called == 0);
+    teardown();
+}
+#endif
+
+UTEST(sokol_gfx_gl, staging_update_image) {
+    // room for 4 updates in the staging ring, so it wraps around twice
+    if (!setup(&(sg_desc){ .gl_staging_buffer_size = 4 * 64 * 64 * 4 })) {
+        return;
+    }
+    T(_sg.gl.staging.pbo != 0);
+    sg_image img = sg_make_image(&(sg_image_desc){ .width = 64, .height = 64, .usage = SG_USAGE_DYNAMIC });
+    sg_commit();
+    static uint32_t pixels[64 * 64];
+    for (uint32_t frame = 0; frame < 8; frame++) {
+        fill_pixels(pixels, 64 * 64, frame + 1);
+        sg_update_image(img, &(sg_image_data){ .subimage[0][0] = SG_RANGE(pixels) });
+        sg_commit();
+        T(check_image_pixels(img, pixels, 64 * 64));
+        T(sg_query_frame_stats().gl.num_staging_uploads == 1);
+        T(sg_query_frame_stats().gl.size_staging == 64 * 64 * 4);
+        // sg_commit() fences the writes
+        T(_sg.gl.staging.fenced == _sg.gl.staging.head);
+        T((_sg.gl.staging.head - _sg.gl.staging.tail) <= (uint64_t)_sg.gl.staging.size);
+    }
+    T(glGetError() == GL_NO_ERROR);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, staging_ring_full) {
+    // only room for 2 updates, the third update in a frame must wait for the GPU
+    if (!setup(&(sg_desc){ .gl_staging_buffer_size = 2 * 64 * 64 * 4 })) {
+        return;
+    }
+    sg_image imgs[3];
+    for (int i = 0; i < 3; i++) {
+        imgs[i] = sg_make_image(&(sg_image_desc){ .width = 64, .height = 64, .usage = SG_USAGE_DYNAMIC });
+    }
+    sg_commit();
+    static uint32_t pixels[3][64 * 64];
+    for (uint32_t frame = 0; frame < 3; frame++) {
+        for (int i = 0; i < 3; i++) {
+            fill_pixels(pixels[i], 64 * 64, frame * 3 + (uint32_t)i + 1);
+            sg_update_image(imgs[i], &(sg_image_data){ .subimage[0][0] = SG_RANGE(pixels[i]) });
+            T((_sg.gl.staging.head - _sg.gl.staging.tail) <= (uint64_t)_sg.gl.staging.size);
+        }
+        sg_commit();
+        for (int i = 0; i < 3; i++) {
+            T(check_image_pixels(imgs[i], pixels[i], 64 * 64));
+        }
+        T(sg_query_frame_stats().gl.num_staging_uploads == 3);
+    }
+    T(glGetError() == GL_NO_ERROR);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST(sokol_gfx_gl, staging_immutable_image) {
+    if (!setup(&(sg_desc){ .gl_staging_buffer_size = 1024 * 1024 })) {
+        return;
+    }
+    static uint32_t pixels[256 * 256];
+    fill_pixels(pixels, 256 * 256, 1);
+    // 256 KBytes of pixel data go through the staging buffer...
+    sg_image img0 = sg_make_image(&(sg_image_desc){ .width = 256, .height = 256, .data.subimage[0][0] = SG_RANGE(pixels) });
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_staging_uploads == 1);
+    T(check_image_pixels(img0, pixels, 256 * 256));
+    // ...but small images don't
+    sg_image img1 = sg_make_image(&(sg_image_desc){ .width = 128, .height = 128, .data.subimage[0][0] = { pixels, 128 * 128 * 4 } });
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_staging_uploads == 0);
+    T(check_image_pixels(img1, pixels, 128 * 128));
+    T(num_log_called == 0);
+    teardown();
+
+    // images which don't fit into the staging buffer are uploaded directly
+    if (!setup(&(sg_desc){ .gl_staging_buffer_size = 64 * 1024 })) {
+        return;
+    }
+    sg_image img2 = sg_make_image(&(sg_image_desc){ .width = 256, .height = 256, .data.subimage[0][0] = SG_RANGE(pixels) });
+    sg_commit();
+    T(sg_query_frame_stats().gl.num_staging_uploads == 0);
+    T(check_image_pixels(img2, pixels, 256 * 256));
+    T(glGetError() == GL_NO_ERROR);
+    T(num_log_called == 0);
+    teardown();
+}
+
+UTEST_MAIN();
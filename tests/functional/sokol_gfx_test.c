@@ -1348,6 +1348,387 @@ UTEST(sokol_gfx, query_buffer_will_overflow) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, append_buffer_grow) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .max_size = 256,
+        .usage = SG_USAGE_STREAM,
+    });
+    static const uint8_t data[48] = {0};
+    T(sg_append_buffer(buf, &SG_RANGE(data)) == 0);
+    T(!sg_query_buffer_overflow(buf));
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_overflow(buf));
+    T(num_log_called == 0);
+    sg_commit();
+    // buffer grows on first append in the next frame
+    T(sg_append_buffer(buf, &SG_RANGE(data)) == 0);
+    T(!sg_query_buffer_overflow(buf));
+    T(sg_query_buffer_desc(buf).size == 128);
+    T(log_items[0] == SG_LOGITEM_BUFFER_GROWN);
+    sg_commit();
+    T(sg_query_frame_stats().num_grow_buffer == 1);
+    T(sg_query_frame_stats().size_grow_buffer == 128);
+    // growth is capped at max_size
+    for (int i = 0; i < 8; i++) {
+        sg_append_buffer(buf, &SG_RANGE(data));
+    }
+    T(sg_query_buffer_overflow(buf));
+    sg_commit();
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_desc(buf).size == 256);
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, append_buffer_grow_keeps_label) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .max_size = 256,
+        .usage = SG_USAGE_STREAM,
+        .label = "particles",
+    });
+    static const uint8_t data[48] = {0};
+    sg_append_buffer(buf, &SG_RANGE(data));
+    sg_append_buffer(buf, &SG_RANGE(data));
+    sg_commit();
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_desc(buf).size == 128);
+    T(0 == strcmp(_sg_lookup_buffer(&_sg.pools, buf.id)->cmn.label.buf, "particles"));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, append_buffer_grow_near_int_max) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 0x50000000,
+        .max_size = INT_MAX,
+        .usage = SG_USAGE_STREAM,
+    });
+    // the overflowing appends are never copied, so the data can be a stand-in
+    static const uint8_t data[16] = {0};
+    const sg_range big_range = { data, 0x50000000 };
+    sg_append_buffer(buf, &big_range);
+    sg_append_buffer(buf, &big_range);
+    T(sg_query_buffer_overflow(buf));
+    sg_commit();
+    // doubling would overflow an int, the new size is clamped to max_size
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_desc(buf).size == INT_MAX);
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_buffer_validate_max_size_limit) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .max_size = (size_t)INT_MAX + 1,
+        .usage = SG_USAGE_STREAM,
+    });
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BUFFERDESC_MAX_SIZE_LIMIT);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, append_buffer_no_grow_by_default) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage = SG_USAGE_STREAM,
+    });
+    static const uint8_t data[48] = {0};
+    sg_append_buffer(buf, &SG_RANGE(data));
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_overflow(buf));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_APPENDBUF_SIZE);
+    reset_log_items();
+    sg_commit();
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(!sg_query_buffer_overflow(buf));
+    T(sg_query_buffer_desc(buf).size == 64);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, update_buffer_range) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 256,
+        .usage = SG_USAGE_DYNAMIC,
+    });
+    const _sg_buffer_t* bufptr = _sg_lookup_buffer(&_sg.pools, buf.id);
+    static const uint8_t data0[16] = { 1, 2, 3, 4 };
+    static const uint8_t data1[32] = { 5, 6, 7, 8 };
+    // several disjoint updates in the same frame
+    sg_update_buffer_range(buf, 0, &SG_RANGE(data0));
+    const int slot = bufptr->cmn.active_slot;
+    sg_update_buffer_range(buf, 128, &SG_RANGE(data1));
+    T(num_log_called == 0);
+    T(bufptr->cmn.active_slot == slot);
+    T(bufptr->cmn.shadow);
+    T(0 == memcmp(bufptr->cmn.shadow, data0, sizeof(data0)));
+    T(0 == memcmp(bufptr->cmn.shadow + 128, data1, sizeof(data1)));
+    // the active slot is up to date, all other slots have the updated ranges marked as dirty
+    T(bufptr->cmn.dirty[slot].num == 0);
+    const int other_slot = (slot + 1) % SG_NUM_INFLIGHT_FRAMES;
+    T(bufptr->cmn.dirty[other_slot].num == 2);
+    sg_commit();
+    T(sg_query_frame_stats().num_update_buffer_range == 2);
+    T(sg_query_frame_stats().size_update_buffer_range == 48);
+    T(sg_query_frame_stats().size_sync_buffer_range == 0);
+
+    // in the next frame the next slot is activated and its dirty ranges are synced
+    sg_update_buffer_range(buf, 64, &SG_RANGE(data0));
+    T(bufptr->cmn.active_slot == other_slot);
+    T(bufptr->cmn.dirty[other_slot].num == 0);
+    T(bufptr->cmn.dirty[slot].num == 1);
+    T(bufptr->cmn.dirty[slot].ranges[0].offset == 64);
+    T(bufptr->cmn.dirty[slot].ranges[0].size == 16);
+    sg_commit();
+    T(sg_query_frame_stats().size_sync_buffer_range == 48);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, update_buffer_range_merge_dirty) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 1024,
+        .usage = SG_USAGE_STREAM,
+    });
+    const _sg_buffer_t* bufptr = _sg_lookup_buffer(&_sg.pools, buf.id);
+    static const uint8_t data[16] = {0};
+    // adjacent and overlapping ranges are merged
+    sg_update_buffer_range(buf, 0, &SG_RANGE(data));
+    sg_update_buffer_range(buf, 16, &SG_RANGE(data));
+    sg_update_buffer_range(buf, 24, &SG_RANGE(data));
+    const int other_slot = (bufptr->cmn.active_slot + 1) % SG_NUM_INFLIGHT_FRAMES;
+    T(bufptr->cmn.dirty[other_slot].num == 1);
+    T(bufptr->cmn.dirty[other_slot].ranges[0].offset == 0);
+    T(bufptr->cmn.dirty[other_slot].ranges[0].size == 40);
+    // a range bridging two existing ranges merges all three
+    sg_update_buffer_range(buf, 56, &SG_RANGE(data));
+    T(bufptr->cmn.dirty[other_slot].num == 2);
+    sg_update_buffer_range(buf, 40, &SG_RANGE(data));
+    T(bufptr->cmn.dirty[other_slot].num == 1);
+    T(bufptr->cmn.dirty[other_slot].ranges[0].offset == 0);
+    T(bufptr->cmn.dirty[other_slot].ranges[0].size == 72);
+    // when the dirty list is full, new ranges are merged with the closest range
+    for (int i = 0; i < _SG_MAX_BUFFER_DIRTY_RANGES + 4; i++) {
+        sg_update_buffer_range(buf, (size_t)(128 + i * 64), &SG_RANGE(data));
+    }
+    T(bufptr->cmn.dirty[other_slot].num == _SG_MAX_BUFFER_DIRTY_RANGES);
+    int dirty_bytes = 0;
+    for (int i = 0; i < bufptr->cmn.dirty[other_slot].num; i++) {
+        const _sg_buffer_range_t* r = &bufptr->cmn.dirty[other_slot].ranges[i];
+        T(r->offset >= 0);
+        T((r->offset + r->size) <= 1024);
+        dirty_bytes += r->size;
+    }
+    T(dirty_bytes >= (72 + (_SG_MAX_BUFFER_DIRTY_RANGES + 4) * 16));
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, update_buffer_range_validation) {
+    setup(&(sg_desc){0});
+    static const uint8_t data[16] = {0};
+    sg_buffer immutable_buf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    sg_update_buffer_range(immutable_buf, 0, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_USAGE);
+
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage = SG_USAGE_DYNAMIC,
+    });
+    reset_log_items();
+    sg_update_buffer_range(buf, 56, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_SIZE);
+    reset_log_items();
+    sg_update_buffer_range(buf, 2, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_OFFSET);
+    reset_log_items();
+    sg_update_buffer_range(buf, 0, &(sg_range){ data, 6 });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_SIZE_ALIGNMENT);
+
+    // can't mix with sg_update_buffer() or sg_append_buffer() in the same frame
+    reset_log_items();
+    sg_update_buffer_range(buf, 0, &SG_RANGE(data));
+    T(num_log_called == 0);
+    sg_update_buffer(buf, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUF_RANGE);
+    reset_log_items();
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_APPENDBUF_RANGE);
+    sg_commit();
+    reset_log_items();
+    sg_update_buffer(buf, &SG_RANGE(data));
+    T(num_log_called == 0);
+    sg_update_buffer_range(buf, 16, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_UPDATE);
+    sg_commit();
+    reset_log_items();
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(num_log_called == 0);
+    sg_update_buffer_range(buf, 16, &SG_RANGE(data));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDATEBUFRANGE_APPEND);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_alloc_free) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 256,
+        .usage = SG_USAGE_DYNAMIC,
+        .max_views = 8,
+    });
+    T(sg_query_buffer_desc(buf).view_alignment == 4);
+    sg_buffer_view v0 = sg_alloc_buffer_view(buf, 64);
+    sg_buffer_view v1 = sg_alloc_buffer_view(buf, 30);
+    sg_buffer_view v2 = sg_alloc_buffer_view(buf, 64);
+    T(v0.buffer.id == buf.id); T(v0.offset == 0); T(v0.size == 64);
+    T(v1.buffer.id == buf.id); T(v1.offset == 64); T(v1.size == 32);
+    T(v2.buffer.id == buf.id); T(v2.offset == 96); T(v2.size == 64);
+    sg_buffer_info info = sg_query_buffer_info(buf);
+    T(info.views.num_views == 3);
+    T(info.views.num_free_ranges == 1);
+    T(info.views.free_size == 96);
+    T(info.views.largest_free_size == 96);
+    // freeing the middle view creates a hole
+    sg_free_buffer_view(v1);
+    info = sg_query_buffer_info(buf);
+    T(info.views.num_views == 2);
+    T(info.views.num_free_ranges == 2);
+    T(info.views.free_size == 128);
+    T(info.views.largest_free_size == 96);
+    // first-fit recycles the hole
+    sg_buffer_view v3 = sg_alloc_buffer_view(buf, 16);
+    T(v3.offset == 64); T(v3.size == 16);
+    sg_free_buffer_view(v3);
+    // freeing all views merges everything back into a single free range
+    sg_free_buffer_view(v0);
+    sg_free_buffer_view(v2);
+    info = sg_query_buffer_info(buf);
+    T(info.views.num_views == 0);
+    T(info.views.num_free_ranges == 1);
+    T(info.views.free_size == 256);
+    T(info.views.largest_free_size == 256);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_alignment) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 256,
+        .usage = SG_USAGE_STREAM,
+        .max_views = 4,
+        .view_alignment = 64,
+    });
+    sg_buffer_view v0 = sg_alloc_buffer_view(buf, 1);
+    sg_buffer_view v1 = sg_alloc_buffer_view(buf, 65);
+    T(v0.offset == 0); T(v0.size == 64);
+    T(v1.offset == 64); T(v1.size == 128);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_out_of_memory) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 128,
+        .usage = SG_USAGE_DYNAMIC,
+        .max_views = 4,
+    });
+    sg_buffer_view v0 = sg_alloc_buffer_view(buf, 32);
+    sg_buffer_view v1 = sg_alloc_buffer_view(buf, 32);
+    sg_buffer_view v2 = sg_alloc_buffer_view(buf, 32);
+    sg_alloc_buffer_view(buf, 32);
+    sg_free_buffer_view(v0);
+    sg_free_buffer_view(v2);
+    // 64 bytes free, but fragmented
+    sg_buffer_info info = sg_query_buffer_info(buf);
+    T(info.views.free_size == 64);
+    T(info.views.largest_free_size == 32);
+    sg_buffer_view v3 = sg_alloc_buffer_view(buf, 64);
+    T(v3.buffer.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_BUFFER_VIEW_OUT_OF_MEMORY);
+    sg_free_buffer_view(v1);
+    v3 = sg_alloc_buffer_view(buf, 64);
+    T(v3.buffer.id == buf.id);
+    T(v3.offset == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_exhausted) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 128,
+        .usage = SG_USAGE_DYNAMIC,
+        .max_views = 2,
+    });
+    T(sg_alloc_buffer_view(buf, 4).buffer.id == buf.id);
+    T(sg_alloc_buffer_view(buf, 4).buffer.id == buf.id);
+    T(sg_alloc_buffer_view(buf, 4).buffer.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_BUFFER_VIEWS_EXHAUSTED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_not_enabled) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 128,
+        .usage = SG_USAGE_DYNAMIC,
+    });
+    T(sg_alloc_buffer_view(buf, 4).buffer.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_BUFFER_VIEWS_NOT_ENABLED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_double_free) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 128,
+        .usage = SG_USAGE_DYNAMIC,
+        .max_views = 4,
+    });
+    sg_buffer_view v0 = sg_alloc_buffer_view(buf, 16);
+    sg_alloc_buffer_view(buf, 16);
+    sg_free_buffer_view(v0);
+    T(num_log_called == 0);
+    sg_free_buffer_view(v0);
+    T(log_items[0] == SG_LOGITEM_BUFFER_VIEW_INVALID_FREE);
+    T(sg_query_buffer_info(buf).views.num_views == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, buffer_view_free_mismatch) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 128,
+        .usage = SG_USAGE_DYNAMIC,
+        .max_views = 2,
+    });
+    sg_buffer_view v0 = sg_alloc_buffer_view(buf, 64);
+    T(num_log_called == 0);
+    // a sub-range of a live view
+    sg_free_buffer_view((sg_buffer_view){ .buffer = buf, .offset = 16, .size = 16 });
+    T(log_items[0] == SG_LOGITEM_BUFFER_VIEW_INVALID_FREE);
+    // the same allocation split differently
+    sg_free_buffer_view((sg_buffer_view){ .buffer = buf, .offset = 0, .size = 32 });
+    sg_free_buffer_view((sg_buffer_view){ .buffer = buf, .offset = 32, .size = 32 });
+    T(num_log_called == 3);
+    T(sg_query_buffer_info(buf).views.num_views == 1);
+    T(sg_query_buffer_info(buf).views.num_free_ranges == 1);
+    reset_log_items();
+    sg_free_buffer_view(v0);
+    T(num_log_called == 0);
+    T(sg_query_buffer_info(buf).views.num_views == 0);
+    T(sg_query_buffer_info(buf).views.num_free_ranges == 1);
+    sg_shutdown();
+}
+
 static struct {
     uintptr_t userdata;
     int num_called;
@@ -2975,3 +3356,1688 @@ UTEST(sokol_gfx, sg_query_surface_pitch) {
     T(sg_query_surface_pitch(SG_PIXELFORMAT_BC1_RGBA, 256, 5, 1) == (256 * 2 * 2));
     sg_shutdown();
 }
+
+UTEST(sokol_gfx, transient_image_reuse) {
+    setup(&(sg_desc){0});
+    const sg_image_desc desc = { .render_target = true, .width = 64, .height = 32 };
+    sg_image img0 = sg_acquire_transient_image(&desc);
+    sg_image img1 = sg_acquire_transient_image(&desc);
+    T(img0.id != SG_INVALID_ID);
+    T(img1.id != SG_INVALID_ID);
+    T(img0.id != img1.id);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    sg_transient_stats stats = sg_query_transient_stats();
+    T(stats.num_images == 2);
+    T(stats.num_images_in_use == 2);
+    T(stats.total_bytes == 2 * 64 * 32 * 4);
+    T(stats.peak_bytes == stats.total_bytes);
+    T(stats.num_acquired == 2);
+    T(stats.num_reused == 0);
+    // an image released earlier in the frame is handed out again
+    sg_release_transient_image(img0);
+    T(sg_acquire_transient_image(&desc).id == img0.id);
+    // ...but not for an incompatible desc
+    sg_release_transient_image(img0);
+    sg_image img2 = sg_acquire_transient_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 32, .pixel_format = SG_PIXELFORMAT_R8 });
+    T(img2.id != img0.id);
+    T(img2.id != img1.id);
+    sg_release_transient_image(img1);
+    sg_release_transient_image(img2);
+    sg_commit();
+    // ...or in a later frame
+    T(sg_acquire_transient_image(&desc).id == img0.id);
+    stats = sg_query_transient_stats();
+    T(stats.num_images == 3);
+    T(stats.num_images_in_use == 1);
+    T(stats.total_bytes == (2 * 64 * 32 * 4) + (64 * 32));
+    T(stats.num_acquired == 5);
+    T(stats.num_reused == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, transient_image_eviction) {
+    setup(&(sg_desc){ .transient_max_unused_frames = 2 });
+    const sg_image_desc desc = { .render_target = true, .width = 64, .height = 64 };
+    sg_image img0 = sg_acquire_transient_image(&desc);
+    sg_image img1 = sg_acquire_transient_image(&desc);
+    sg_attachments atts0 = sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img0 });
+    sg_attachments atts1 = sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img1 });
+    T(sg_query_attachments_state(atts0) == SG_RESOURCESTATE_VALID);
+    T(sg_query_attachments_state(atts1) == SG_RESOURCESTATE_VALID);
+    sg_release_transient_image(img1);
+    // img0 stays acquired over several frames and must not be evicted
+    for (int i = 0; i < 3; i++) {
+        sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img0 });
+        sg_commit();
+    }
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    T(sg_query_attachments_state(atts0) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(img1) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_attachments_state(atts1) == SG_RESOURCESTATE_INVALID);
+    sg_transient_stats stats = sg_query_transient_stats();
+    T(stats.num_images == 1);
+    T(stats.num_attachments == 1);
+    T(stats.num_evicted == 1);
+    T(stats.total_bytes == 64 * 64 * 4);
+    T(stats.peak_bytes == 2 * 64 * 64 * 4);
+    sg_release_transient_image(img0);
+    sg_commit();
+    sg_commit();
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    sg_commit();
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_attachments_state(atts0) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_transient_stats().num_images == 0);
+    T(sg_query_transient_stats().total_bytes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, transient_attachments_cache) {
+    setup(&(sg_desc){0});
+    sg_image color = sg_acquire_transient_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 64 });
+    sg_image depth = sg_acquire_transient_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 64, .pixel_format = SG_PIXELFORMAT_DEPTH });
+    sg_attachments atts0 = sg_make_transient_attachments(&(sg_attachments_desc){
+        .colors[0].image = color,
+        .depth_stencil.image = depth,
+        .label = "first",
+    });
+    sg_attachments atts1 = sg_make_transient_attachments(&(sg_attachments_desc){
+        .colors[0].image = color,
+        .depth_stencil.image = depth,
+        .label = "second",
+    });
+    sg_attachments atts2 = sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = color });
+    T(atts0.id != SG_INVALID_ID);
+    T(atts0.id == atts1.id);
+    T(atts2.id != atts0.id);
+    T(sg_query_transient_stats().num_attachments == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, transient_attachments_kept_alive_by_begin_pass) {
+    setup(&(sg_desc){ .transient_max_unused_frames = 2 });
+    sg_image img = sg_acquire_transient_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 64 });
+    sg_attachments atts = sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    T(atts.id != SG_INVALID_ID);
+    // only use the cached attachments in sg_begin_pass() without calling
+    // sg_make_transient_attachments() again
+    for (int i = 0; i < 4; i++) {
+        sg_begin_pass(&(sg_pass){ .attachments = atts });
+        sg_end_pass();
+        sg_commit();
+    }
+    T(sg_query_attachments_state(atts) == SG_RESOURCESTATE_VALID);
+    T(sg_query_transient_stats().num_attachments == 1);
+    for (int i = 0; i < 3; i++) {
+        sg_commit();
+    }
+    T(sg_query_attachments_state(atts) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_transient_stats().num_attachments == 0);
+    sg_release_transient_image(img);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, transient_attachments_cache_size) {
+    setup(&(sg_desc){ .transient_pool_size = 4, .transient_attachments_cache_size = 1 });
+    T(_sg.transient.capacity == 4);
+    T(_sg.transient.atts_capacity == 1);
+    const sg_image_desc desc = { .render_target = true, .width = 8, .height = 8 };
+    sg_image img0 = sg_acquire_transient_image(&desc);
+    sg_image img1 = sg_acquire_transient_image(&desc);
+    T(sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img0 }).id != SG_INVALID_ID);
+    T(sg_make_transient_attachments(&(sg_attachments_desc){ .colors[0].image = img1 }).id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_TRANSIENT_ATTACHMENTS_CACHE_FULL);
+    sg_shutdown();
+    setup(&(sg_desc){ .transient_pool_size = 4 });
+    T(_sg.transient.atts_capacity == 4);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, transient_image_errors) {
+    setup(&(sg_desc){ .transient_pool_size = 1 });
+    T(sg_acquire_transient_image(&(sg_image_desc){ .width = 8, .height = 8 }).id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_TRANSIENT_IMAGE_NOT_RENDER_TARGET);
+    const sg_image_desc desc = { .render_target = true, .width = 8, .height = 8 };
+    sg_image img = sg_acquire_transient_image(&desc);
+    T(img.id != SG_INVALID_ID);
+    T(sg_acquire_transient_image(&desc).id == SG_INVALID_ID);
+    T(log_items[1] == SG_LOGITEM_TRANSIENT_POOL_EXHAUSTED);
+    sg_release_transient_image(img);
+    sg_release_transient_image(img);
+    T(log_items[2] == SG_LOGITEM_TRANSIENT_IMAGE_INVALID_RELEASE);
+    sg_release_transient_image(sg_make_image(&desc));
+    T(log_items[3] == SG_LOGITEM_TRANSIENT_IMAGE_INVALID_RELEASE);
+    T(num_log_called == 4);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, context_make_destroy) {
+    setup(&(sg_desc){0});
+    T(sg_get_context().id == sg_default_context().id);
+    sg_context ctx = sg_make_context(&(sg_desc){
+        .buffer_pool_size = 4,
+        .logger.func = test_logger,
+    });
+    T(ctx.id != SG_INVALID_ID);
+    T(ctx.id != sg_default_context().id);
+    // creating a context doesn't change the current context
+    T(sg_get_context().id == sg_default_context().id);
+    T(_sg.desc.buffer_pool_size == 128);
+
+    sg_set_context(ctx);
+    T(sg_get_context().id == ctx.id);
+    T(sg_isvalid());
+    T(_sg.desc.buffer_pool_size == 4);
+    sg_buffer buf = create_buffer();
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+    sg_commit();
+    sg_commit();
+    T(_sg.frame_index == 3);
+
+    // contexts own their resources and frame counters
+    sg_set_context(sg_default_context());
+    T(_sg.frame_index == 1);
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_INVALID);
+    sg_buffer other_buf = create_buffer();
+    T(sg_query_buffer_state(other_buf) == SG_RESOURCESTATE_VALID);
+
+    // destroying the current context falls back to the default context
+    sg_set_context(ctx);
+    sg_destroy_context(ctx);
+    T(sg_get_context().id == sg_default_context().id);
+    T(sg_query_buffer_state(other_buf) == SG_RESOURCESTATE_VALID);
+    T(num_log_called == 0);
+
+    // the context handle is now invalid
+    sg_set_context(ctx);
+    T(log_items[0] == SG_LOGITEM_CONTEXT_INVALID);
+    T(sg_get_context().id == sg_default_context().id);
+    sg_destroy_context(sg_default_context());
+    T(log_items[1] == SG_LOGITEM_CONTEXT_DESTROY_DEFAULT);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, context_pool_exhausted) {
+    setup(&(sg_desc){0});
+    sg_context ctxs[_SG_MAX_CONTEXTS - 1];
+    for (int i = 0; i < (_SG_MAX_CONTEXTS - 1); i++) {
+        ctxs[i] = sg_make_context(&(sg_desc){0});
+        T(ctxs[i].id != SG_INVALID_ID);
+    }
+    T(sg_make_context(&(sg_desc){0}).id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_CONTEXT_POOL_EXHAUSTED);
+    // a destroyed context's slot is reused with a different handle
+    const sg_context old_ctx = ctxs[3];
+    sg_destroy_context(old_ctx);
+    ctxs[3] = sg_make_context(&(sg_desc){0});
+    T(ctxs[3].id != SG_INVALID_ID);
+    T(ctxs[3].id != old_ctx.id);
+    for (int i = 0; i < (_SG_MAX_CONTEXTS - 1); i++) {
+        sg_destroy_context(ctxs[i]);
+    }
+    T(num_log_called == 1);
+    sg_shutdown();
+}
+
+static int num_readbacks = 0;
+static sg_image_readback last_readback;
+static bool readback_data_zero = false;
+
+static void readback_callback(const sg_image_readback* rb) {
+    num_readbacks++;
+    last_readback = *rb;
+    readback_data_zero = true;
+    for (size_t i = 0; i < rb->data.size; i++) {
+        if (((const uint8_t*)rb->data.ptr)[i] != 0) {
+            readback_data_zero = false;
+        }
+    }
+    // the data pointer is only valid inside the callback
+    last_readback.data.ptr = 0;
+}
+
+UTEST(sokol_gfx, read_image_async) {
+    setup(&(sg_desc){0});
+    num_readbacks = 0;
+    T(sg_query_features().image_readback);
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .render_target = true,
+        .width = 32,
+        .height = 16,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    // the entire image by default
+    T(sg_read_image_async(img, &(sg_read_image_desc){ .callback = readback_callback, .user_data = (void*)&num_readbacks }));
+    T(num_readbacks == 1);
+    T(readback_data_zero);
+    T(last_readback.image.id == img.id);
+    T(last_readback.x == 0);
+    T(last_readback.y == 0);
+    T(last_readback.width == 32);
+    T(last_readback.height == 16);
+    T(last_readback.pixel_format == SG_PIXELFORMAT_RGBA8);
+    T(last_readback.data.size == 32 * 16 * 4);
+    T(last_readback.user_data == (void*)&num_readbacks);
+    // a sub-rectangle
+    T(sg_read_image_async(img, &(sg_read_image_desc){ .x = 8, .y = 4, .width = 3, .height = 2, .callback = readback_callback }));
+    T(num_readbacks == 2);
+    T(last_readback.x == 8);
+    T(last_readback.y == 4);
+    T(last_readback.data.size == 3 * 2 * 4);
+    // the remaining area to the right/bottom if only an offset is provided
+    T(sg_read_image_async(img, &(sg_read_image_desc){ .x = 30, .y = 10, .callback = readback_callback }));
+    T(last_readback.width == 2);
+    T(last_readback.height == 6);
+    sg_commit();
+    T(sg_query_frame_stats().num_read_image_async == 3);
+    T(sg_query_frame_stats().size_read_image_async == (32 * 16 * 4) + (3 * 2 * 4) + (2 * 6 * 4));
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_image_async_validation) {
+    setup(&(sg_desc){0});
+    num_readbacks = 0;
+    const sg_read_image_desc desc = { .callback = readback_callback };
+    sg_image non_rt_img = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .usage = SG_USAGE_DYNAMIC });
+    T(!sg_read_image_async(non_rt_img, &desc));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_RENDERTARGET);
+    reset_log_items();
+    sg_image msaa_img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8, .sample_count = 4 });
+    T(!sg_read_image_async(msaa_img, &desc));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_SAMPLECOUNT);
+    reset_log_items();
+    sg_image depth_img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8, .pixel_format = SG_PIXELFORMAT_DEPTH });
+    T(!sg_read_image_async(depth_img, &desc));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_COLORFORMAT);
+    reset_log_items();
+    sg_image array_img = sg_make_image(&(sg_image_desc){ .type = SG_IMAGETYPE_ARRAY, .render_target = true, .width = 8, .height = 8, .num_slices = 2 });
+    T(!sg_read_image_async(array_img, &desc));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_IMAGETYPE);
+    reset_log_items();
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    T(!sg_read_image_async(img, &(sg_read_image_desc){ .x = 4, .width = 8, .callback = readback_callback }));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_RECT);
+    reset_log_items();
+    T(!sg_read_image_async(img, &(sg_read_image_desc){0}));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_CALLBACK);
+    reset_log_items();
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    T(!sg_read_image_async(img, &desc));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMG_INPASS);
+    sg_end_pass();
+    sg_commit();
+    // invalid images are silently ignored
+    reset_log_items();
+    sg_destroy_image(img);
+    T(!sg_read_image_async(img, &desc));
+    T(num_log_called == 0);
+    T(num_readbacks == 0);
+    sg_shutdown();
+}
+
+static sg_shader make_manifest_shader(const char* label) {
+    return sg_make_shader(&(sg_shader_desc){
+        .attrs[0].name = "pos",
+        .vs = {
+            .source = "vs-source",
+            .uniform_blocks[0] = { .size = 64, .uniforms[0] = { .name = "mvp", .type = SG_UNIFORMTYPE_MAT4 } },
+        },
+        .fs = {
+            .source = "fs-source",
+            .images[0].used = true,
+            .samplers[0].used = true,
+            .image_sampler_pairs[0] = { .used = true, .glsl_name = "tex" },
+        },
+        .label = label,
+    });
+}
+
+static sg_pipeline make_manifest_pipeline(sg_shader shd, sg_cull_mode cull_mode) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .cull_mode = cull_mode,
+        .blend_color = { 0.25f, 0.5f, 0.75f, 1.0f },
+    });
+}
+
+static void apply_manifest_pipeline(sg_pipeline pip) {
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_end_pass();
+    sg_commit();
+    sg_destroy_attachments(atts);
+    sg_destroy_image(img);
+}
+
+UTEST(sokol_gfx, manifest_export_prewarm) {
+    setup(&(sg_desc){ .record_manifest = true });
+    sg_shader shd0 = make_manifest_shader("shd0");
+    sg_shader shd1 = make_manifest_shader("shd1");
+    // identical creation params are only recorded once
+    make_manifest_shader("shd0");
+    make_manifest_pipeline(shd0, SG_CULLMODE_BACK);
+    make_manifest_pipeline(shd1, SG_CULLMODE_FRONT);
+    T(_sg.manifest.num_entries == 4);
+    const size_t size = sg_query_manifest_size();
+    T(size > 0);
+    uint8_t buf[4096];
+    T(size <= sizeof(buf));
+    T(sg_export_manifest(&(sg_range){ buf, size - 1 }) == 0);
+    T(log_items[0] == SG_LOGITEM_MANIFEST_EXPORT_BUFFER_TOO_SMALL);
+    T(sg_export_manifest(&SG_RANGE(buf)) == size);
+    sg_shutdown();
+
+    setup(&(sg_desc){0});
+    T(sg_prewarm(&(sg_range){ buf, size }, 1000.0));
+    sg_commit();
+    T(sg_query_frame_stats().num_prewarm == 4);
+    T(_sg.prewarm.done);
+    T(_sg.prewarm.data == 0);
+    // a hash collision must not return the wrong object
+    T(_sg.prewarm.entries[0].kind == _SG_MANIFEST_SHADER);
+    _sg.prewarm.entries[0].hash = _sg.prewarm.entries[1].hash;
+    // matching creation params return the prewarmed objects
+    sg_shader shd = make_manifest_shader("shd1");
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    T(shd.id == _sg.prewarm.entries[1].res_id);
+    sg_pipeline pip = make_manifest_pipeline(shd, SG_CULLMODE_FRONT);
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(pip.id == _sg.prewarm.entries[3].res_id);
+    T(sg_query_pipeline_desc(pip).cull_mode == SG_CULLMODE_FRONT);
+    sg_commit();
+    T(sg_query_frame_stats().num_prewarm_hits == 2);
+    // ...but only once
+    sg_shader shd_again = make_manifest_shader("shd1");
+    T(shd_again.id != shd.id);
+    // a different shader object doesn't match the prewarmed pipeline
+    sg_pipeline pip_again = make_manifest_pipeline(shd_again, SG_CULLMODE_BACK);
+    T(pip_again.id != _sg.prewarm.entries[2].res_id);
+    sg_commit();
+    T(sg_query_frame_stats().num_prewarm_hits == 0);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, manifest_first_use_order) {
+    setup(&(sg_desc){ .record_manifest = true });
+    sg_shader shd0 = make_manifest_shader("shd0");
+    sg_shader shd1 = make_manifest_shader("shd1");
+    sg_pipeline pip0 = make_manifest_pipeline(shd0, SG_CULLMODE_NONE);
+    sg_pipeline pip1 = make_manifest_pipeline(shd1, SG_CULLMODE_NONE);
+    make_manifest_pipeline(shd1, SG_CULLMODE_BACK);
+    sg_commit();
+    apply_manifest_pipeline(pip1);
+    apply_manifest_pipeline(pip0);
+    apply_manifest_pipeline(pip1);
+    T(_sg.manifest.entries[0].first_use == 3);
+    T(_sg.manifest.entries[1].first_use == 2);
+    T(_sg.manifest.entries[2].first_use == 3);
+    T(_sg.manifest.entries[3].first_use == 2);
+    T(_sg.manifest.entries[4].first_use == 0);
+    uint8_t buf[4096];
+    const size_t size = sg_export_manifest(&SG_RANGE(buf));
+    T(size > 0);
+    sg_shutdown();
+
+    // with a zero budget, one object is created per call in order of first use
+    setup(&(sg_desc){0});
+    const sg_range manifest = { buf, size };
+    T(!sg_prewarm(&manifest, 0.0));
+    T(_sg.prewarm.entries[1].state == _SG_PREWARM_CREATED);
+    T(_sg.prewarm.entries[0].state == _SG_PREWARM_PENDING);
+    T(!sg_prewarm(&manifest, 0.0));
+    T(_sg.prewarm.entries[3].state == _SG_PREWARM_CREATED);
+    T(!sg_prewarm(&manifest, 0.0));
+    T(_sg.prewarm.entries[0].state == _SG_PREWARM_CREATED);
+    T(!sg_prewarm(&manifest, 0.0));
+    T(_sg.prewarm.entries[2].state == _SG_PREWARM_CREATED);
+    T(_sg.prewarm.entries[4].state == _SG_PREWARM_PENDING);
+    // an object created by the application isn't prewarmed again
+    sg_pipeline pip = make_manifest_pipeline(make_manifest_shader("shd1"), SG_CULLMODE_BACK);
+    T(_sg.prewarm.entries[4].state == _SG_PREWARM_CLAIMED);
+    T(_sg.prewarm.entries[4].res_id == pip.id);
+    T(sg_prewarm(&manifest, 0.0));
+    sg_commit();
+    T(sg_query_frame_stats().num_prewarm == 4);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, manifest_errors) {
+    setup(&(sg_desc){0});
+    uint8_t buf[256];
+    T(sg_query_manifest_size() == 0);
+    T(sg_export_manifest(&SG_RANGE(buf)) == 0);
+    T(log_items[0] == SG_LOGITEM_MANIFEST_NOT_RECORDING);
+    reset_log_items();
+    // invalid manifest data is rejected, and prewarming is done
+    memset(buf, 0xFF, sizeof(buf));
+    memcpy(buf, "SGMF", 4);
+    T(sg_prewarm(&SG_RANGE(buf), 1000.0));
+    T(log_items[0] == SG_LOGITEM_MANIFEST_INVALID);
+    T(sg_prewarm(&SG_RANGE(buf), 1000.0));
+    T(num_log_called == 1);
+    sg_shutdown();
+
+    // a manifest from a different backend
+    setup(&(sg_desc){ .record_manifest = true });
+    make_manifest_shader("shd");
+    const size_t size = sg_export_manifest(&SG_RANGE(buf));
+    T(size > 0);
+    sg_shutdown();
+    buf[5] = (uint8_t)((int)SG_BACKEND_GLCORE * 2);
+    setup(&(sg_desc){0});
+    T(sg_prewarm(&(sg_range){ buf, size }, 1000.0));
+    T(log_items[0] == SG_LOGITEM_MANIFEST_BACKEND_MISMATCH);
+    T(sg_query_frame_stats().num_prewarm == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, num_inflight_frames) {
+    setup(&(sg_desc){0});
+    T(sg_query_desc().num_inflight_frames == SG_NUM_INFLIGHT_FRAMES);
+    sg_shutdown();
+    setup(&(sg_desc){ .num_inflight_frames = 16 });
+    T(sg_query_desc().num_inflight_frames == SG_MAX_INFLIGHT_FRAMES);
+    sg_shutdown();
+
+    // dynamic resources rotate through one slot per in-flight frame
+    setup(&(sg_desc){ .num_inflight_frames = 3 });
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_DYNAMIC });
+    sg_buffer imm_buf = create_buffer();
+    sg_image img = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .usage = SG_USAGE_STREAM });
+    T(sg_query_buffer_info(buf).num_slots == 3);
+    T(sg_query_buffer_info(imm_buf).num_slots == 1);
+    T(sg_query_image_info(img).num_slots == 3);
+    static const uint8_t data[64] = {0};
+    const _sg_buffer_t* bufptr = _sg_lookup_buffer(&_sg.pools, buf.id);
+    const int first_slot = bufptr->cmn.active_slot;
+    for (int i = 1; i <= 4; i++) {
+        sg_update_buffer(buf, &SG_RANGE(data));
+        sg_commit();
+        T(bufptr->cmn.active_slot == ((first_slot + i) % 3));
+    }
+    // the dirty ranges of sg_update_buffer_range() cover all slots
+    sg_update_buffer_range(buf, 0, &(sg_range){ data, 16 });
+    int num_dirty_slots = 0;
+    for (int i = 0; i < 3; i++) {
+        num_dirty_slots += (bufptr->cmn.dirty[i].num > 0) ? 1 : 0;
+    }
+    T(num_dirty_slots == 2);
+    sg_shutdown();
+
+    // ...or no rotation at all
+    setup(&(sg_desc){ .num_inflight_frames = 1 });
+    buf = sg_make_buffer(&(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_STREAM });
+    T(sg_query_buffer_info(buf).num_slots == 1);
+    sg_update_buffer(buf, &SG_RANGE(data));
+    sg_commit();
+    sg_update_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_info(buf).active_slot == 0);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+static sg_pipeline make_uniform_pipeline(void) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .vs.uniform_blocks[0].size = 16,
+            .fs.uniform_blocks[0].size = 16,
+        }),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+}
+
+UTEST(sokol_gfx, apply_uniforms_dedup) {
+    setup(&(sg_desc){ .dedup_uniforms = true });
+    sg_pipeline pip0 = make_uniform_pipeline();
+    sg_pipeline pip1 = make_uniform_pipeline();
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    float a[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float b[4] = { 1.0f, 2.0f, 3.0f, 5.0f };
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip0);
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));     // skipped
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, 0, &SG_RANGE(a));     // different uniform block
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(b));
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(b));     // skipped
+    // the content is compared, not the pointer
+    a[3] = 5.0f;
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));     // skipped
+    // re-applying the same pipeline keeps the uniform data
+    sg_apply_pipeline(pip0);
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, 0, &SG_RANGE(b));
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, 0, &SG_RANGE(b));     // skipped
+    // ...but a pipeline change doesn't
+    sg_apply_pipeline(pip1);
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, 0, &SG_RANGE(b));
+    sg_end_pass();
+    // ...and neither does a new pass
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip1);
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, 0, &SG_RANGE(b));
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().num_apply_uniforms == 10);
+    T(sg_query_frame_stats().num_skipped_apply_uniforms == 4);
+    T(sg_query_frame_stats().size_skipped_apply_uniforms == 4 * 16);
+    T(num_log_called == 0);
+    sg_shutdown();
+
+    // disabled by default
+    setup(&(sg_desc){0});
+    pip0 = make_uniform_pipeline();
+    img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip0);
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().num_skipped_apply_uniforms == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_pipeline_variant) {
+    setup(&(sg_desc){0});
+    sg_shader shd = make_manifest_shader("shd");
+    sg_pipeline base = make_manifest_pipeline(shd, SG_CULLMODE_BACK);
+    T(sg_query_pipeline_state(base) == SG_RESOURCESTATE_VALID);
+    sg_pipeline pip = sg_make_pipeline_variant(base, &(sg_pipeline_variant_desc){
+        .override_depth = true,
+        .depth = { .write_enabled = true, .compare = SG_COMPAREFUNC_LESS_EQUAL },
+        .cull_mode = SG_CULLMODE_NONE,
+        .override_colors = true,
+        .colors[0].blend = { .enabled = true, .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA },
+        .label = "variant",
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    const sg_pipeline_desc base_desc = sg_query_pipeline_desc(base);
+    const sg_pipeline_desc desc = sg_query_pipeline_desc(pip);
+    // shader and vertex layout are shared with the base pipeline
+    T(desc.shader.id == shd.id);
+    T(desc.layout.attrs[0].format == SG_VERTEXFORMAT_FLOAT3);
+    T(desc.layout.buffers[0].stride == base_desc.layout.buffers[0].stride);
+    // overridden state
+    T(desc.depth.write_enabled);
+    T(desc.depth.compare == SG_COMPAREFUNC_LESS_EQUAL);
+    T(desc.depth.pixel_format == SG_PIXELFORMAT_DEPTH_STENCIL);
+    T(desc.cull_mode == SG_CULLMODE_NONE);
+    T(desc.color_count == 1);
+    T(desc.colors[0].blend.enabled);
+    T(desc.colors[0].blend.src_factor_rgb == SG_BLENDFACTOR_SRC_ALPHA);
+    T(desc.colors[0].blend.dst_factor_rgb == SG_BLENDFACTOR_ZERO);
+    T(desc.colors[0].write_mask == SG_COLORMASK_RGBA);
+    // state inherited from the base pipeline
+    T(desc.primitive_type == base_desc.primitive_type);
+    T(desc.face_winding == base_desc.face_winding);
+    T(desc.blend_color.g == 0.5f);
+    T(desc.stencil.front.compare == SG_COMPAREFUNC_ALWAYS);
+    // the base pipeline is unchanged
+    T(base_desc.cull_mode == SG_CULLMODE_BACK);
+    T(base_desc.depth.pixel_format == SG_PIXELFORMAT_NONE);
+    T(!base_desc.colors[0].blend.enabled);
+    // a variant of a variant
+    sg_pipeline pip2 = sg_make_pipeline_variant(pip, &(sg_pipeline_variant_desc){ .primitive_type = SG_PRIMITIVETYPE_LINES });
+    T(sg_query_pipeline_state(pip2) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_desc(pip2).primitive_type == SG_PRIMITIVETYPE_LINES);
+    T(sg_query_pipeline_desc(pip2).cull_mode == SG_CULLMODE_NONE);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_pipeline_variant_invalid_base) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = sg_make_pipeline_variant((sg_pipeline){ SG_INVALID_ID }, &(sg_pipeline_variant_desc){0});
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_PIPELINEVARIANTDESC_BASE);
+
+    // destroying the shader after the base pipeline has been created
+    reset_log_items();
+    sg_shader shd = make_manifest_shader("shd");
+    sg_pipeline base = make_manifest_pipeline(shd, SG_CULLMODE_BACK);
+    sg_destroy_shader(shd);
+    pip = sg_make_pipeline_variant(base, &(sg_pipeline_variant_desc){0});
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_PIPELINEVARIANTDESC_SHADER);
+
+    reset_log_items();
+    sg_destroy_pipeline(base);
+    pip = sg_make_pipeline_variant(base, &(sg_pipeline_variant_desc){0});
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_PIPELINEVARIANTDESC_BASE);
+    sg_shutdown();
+}
+
+static sg_shader make_compute_shader(void) {
+    return sg_make_shader(&(sg_shader_desc){
+        .cs = {
+            .source = "cs",
+            .uniform_blocks[0] = { .size = 16 },
+            .storage_buffers[0] = { .used = true },
+            .storage_images[0] = {
+                .used = true,
+                .image_type = SG_IMAGETYPE_2D,
+                .access_format = SG_PIXELFORMAT_RGBA8,
+            },
+        },
+    });
+}
+
+static sg_image make_storage_image(void) {
+    return sg_make_image(&(sg_image_desc){
+        .storage_image = true,
+        .width = 64,
+        .height = 64,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+}
+
+UTEST(sokol_gfx, make_compute_shader_and_pipeline) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().compute);
+    sg_shader shd = make_compute_shader();
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    const sg_shader_desc shd_desc = sg_query_shader_desc(shd);
+    T(shd_desc.cs.uniform_blocks[0].size == 16);
+    T(shd_desc.cs.storage_images[0].used);
+    T(shd_desc.cs.storage_images[0].access_format == SG_PIXELFORMAT_RGBA8);
+    T(shd_desc.vs.uniform_blocks[0].size == 0);
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){ .compute = true, .shader = shd });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_desc(pip).compute);
+    sg_image img = make_storage_image();
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_desc(img).storage_image);
+    T(num_log_called == 0);
+
+    // compute shader with a render pipeline and vice versa
+    sg_pipeline pip1 = sg_make_pipeline(&(sg_pipeline_desc){ .shader = shd });
+    T(sg_query_pipeline_state(pip1) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_PIPELINEDESC_COMPUTE_SHADER);
+    reset_log_items();
+    sg_pipeline pip2 = sg_make_pipeline(&(sg_pipeline_desc){ .compute = true, .shader = create_shader() });
+    T(sg_query_pipeline_state(pip2) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_PIPELINEDESC_COMPUTE_SHADER);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, compute_shader_desc_validation) {
+    setup(&(sg_desc){0});
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vs.source = "vs",
+        .cs.source = "cs",
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_COMPUTE_VS_FS);
+
+    // storage images are only allowed in compute shaders
+    reset_log_items();
+    shd = sg_make_shader(&(sg_shader_desc){
+        .fs.storage_images[0] = { .used = true, .image_type = SG_IMAGETYPE_2D, .access_format = SG_PIXELFORMAT_RGBA8 },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_STORAGEIMAGE_COMPUTE_ONLY);
+
+    // read-write storage buffers are only allowed in compute shaders
+    reset_log_items();
+    shd = sg_make_shader(&(sg_shader_desc){ .vs.storage_buffers[0] = { .used = true } });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_STORAGEBUFFER_READONLY);
+    reset_log_items();
+    shd = sg_make_shader(&(sg_shader_desc){ .cs = { .source = "cs", .storage_buffers[0] = { .used = true } } });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+
+    // storage image access format
+    reset_log_items();
+    shd = sg_make_shader(&(sg_shader_desc){
+        .cs = {
+            .source = "cs",
+            .storage_images[0] = { .used = true, .image_type = SG_IMAGETYPE_2D, .access_format = SG_PIXELFORMAT_BGRA8 },
+        },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_STORAGEIMAGE_FORMAT);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, storage_image_desc_validation) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .storage_image = true,
+        .width = 8,
+        .height = 8,
+        .pixel_format = SG_PIXELFORMAT_BGRA8,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_STORAGE_PIXELFORMAT);
+
+    reset_log_items();
+    uint32_t pixels[8][8] = {{0}};
+    img = sg_make_image(&(sg_image_desc){
+        .storage_image = true,
+        .width = 8,
+        .height = 8,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_STORAGE_NO_DATA);
+
+    reset_log_items();
+    img = sg_make_image(&(sg_image_desc){
+        .storage_image = true,
+        .usage = SG_USAGE_DYNAMIC,
+        .width = 8,
+        .height = 8,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_STORAGE_IMMUTABLE);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, compute_pass_dispatch) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){ .compute = true, .shader = make_compute_shader() });
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){ .type = SG_BUFFERTYPE_STORAGEBUFFER, .usage = SG_USAGE_STREAM, .size = 256 });
+    sg_image img = make_storage_image();
+    const float params[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){
+        .cs = {
+            .storage_buffers[0] = sbuf,
+            .storage_images[0] = img,
+        },
+    });
+    sg_apply_uniforms(SG_SHADERSTAGE_CS, 0, &SG_RANGE(params));
+    sg_dispatch(8, 8, 1);
+    sg_dispatch(4, 1, 1);
+    // zero work groups are skipped silently
+    sg_dispatch(0, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    const sg_frame_stats stats = sg_query_frame_stats();
+    T(stats.num_dispatch == 3);
+    T(stats.num_apply_uniforms == 1);
+    T(stats.num_passes == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, compute_pass_validation) {
+    setup(&(sg_desc){0});
+    sg_pipeline cpip = sg_make_pipeline(&(sg_pipeline_desc){ .compute = true, .shader = make_compute_shader() });
+    sg_pipeline rpip = create_pipeline();
+
+    // dispatch in a render pass
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 64, .height = 64 } });
+    sg_dispatch(1, 1, 1);
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_COMPUTE_PASS);
+
+    // render pipeline in a compute pass, and draw in a compute pass
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(rpip);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_APIP_PASS_TYPE);
+    reset_log_items();
+    sg_draw(0, 3, 1);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DRAW_COMPUTE_PASS);
+    sg_end_pass();
+
+    // vertex stage bindings with a compute pipeline, and a missing storage image
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(cpip);
+    sg_apply_bindings(&(sg_bindings){ .vs.storage_buffers[0] = create_buffer() });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_ABND_COMPUTE_BINDINGS);
+    reset_log_items();
+    sg_apply_bindings(&(sg_bindings){
+        .cs.storage_buffers[0] = sg_make_buffer(&(sg_buffer_desc){ .type = SG_BUFFERTYPE_STORAGEBUFFER, .usage = SG_USAGE_STREAM, .size = 256 }),
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_ABND_CS_EXPECTED_STORAGEIMAGE_BINDING);
+    // uniforms for a render stage in a compute pipeline
+    reset_log_items();
+    const float params[4] = { 0 };
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(params));
+    T(log_items[0] == SG_LOGITEM_VALIDATE_AUB_STAGE);
+    sg_end_pass();
+
+    // compute pass with a swapchain
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .compute = true, .swapchain = { .width = 64, .height = 64 } });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINPASS_COMPUTE_EXPECT_NO_SWAPCHAIN);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, frame_pacing_disabled_by_default) {
+    setup(&(sg_desc){ .dummy_gpu_latency_ms = 20.0 });
+    T(sg_query_desc().max_frames_ahead == 0);
+    for (int i = 0; i < 4; i++) {
+        sg_commit();
+    }
+    const sg_frame_pacing pacing = sg_query_frame_pacing();
+    T(pacing.frame_index == 4);
+    T(pacing.max_frames_in_flight == 0);
+    T(pacing.frames_in_flight == 0);
+    T(pacing.total_wait_ms == 0.0);
+    T(pacing.num_waits == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, frame_pacing_no_latency) {
+    setup(&(sg_desc){ .max_frames_ahead = 2 });
+    for (int i = 0; i < 4; i++) {
+        sg_commit();
+    }
+    const sg_frame_pacing pacing = sg_query_frame_pacing();
+    T(pacing.frame_index == 4);
+    T(pacing.max_frames_in_flight == 2);
+    T(pacing.frames_in_flight == 0);
+    T(pacing.wait_ms == 0.0);
+    T(pacing.total_wait_ms == 0.0);
+    T(pacing.num_waits == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, frame_pacing_gpu_latency) {
+    setup(&(sg_desc){ .max_frames_ahead = 2, .dummy_gpu_latency_ms = 20.0 });
+    sg_commit();
+    sg_commit();
+    // the first frames never wait, the GPU is two frames behind
+    sg_frame_pacing pacing = sg_query_frame_pacing();
+    T(pacing.frames_in_flight == 2);
+    T(pacing.num_waits == 0);
+    sg_commit();
+    pacing = sg_query_frame_pacing();
+    T(pacing.frame_index == 3);
+    T(pacing.max_frames_in_flight == 2);
+    T(pacing.frames_in_flight == 2);
+    T(pacing.num_waits == 1);
+    T(pacing.wait_ms > 0.0);
+    T(pacing.total_wait_ms == pacing.wait_ms);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, frame_pacing_one_frame_ahead) {
+    setup(&(sg_desc){ .num_inflight_frames = 1, .max_frames_ahead = 1, .dummy_gpu_latency_ms = 20.0 });
+    sg_commit();
+    // sg_commit() never waits for the frame it has just committed
+    sg_frame_pacing pacing = sg_query_frame_pacing();
+    T(pacing.max_frames_in_flight == 1);
+    T(pacing.frames_in_flight == 1);
+    T(pacing.num_waits == 0);
+    sg_commit();
+    sg_commit();
+    pacing = sg_query_frame_pacing();
+    T(pacing.frames_in_flight == 1);
+    T(pacing.num_waits == 2);
+    T(pacing.wait_ms > 0.0);
+    T(pacing.total_wait_ms >= pacing.wait_ms);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, frame_pacing_clamped) {
+    setup(&(sg_desc){ .max_frames_ahead = 16 });
+    T(sg_query_desc().max_frames_ahead == SG_MAX_INFLIGHT_FRAMES);
+    for (int i = 0; i < 8; i++) {
+        sg_commit();
+    }
+    T(sg_query_frame_pacing().max_frames_in_flight == SG_MAX_INFLIGHT_FRAMES);
+    sg_shutdown();
+}
+
+#define MAX_EVICTED (8)
+static int num_evicted = 0;
+static sg_image evicted_images[MAX_EVICTED];
+
+static void evicted_func(sg_image img, void* user_data) {
+    if ((user_data == (void*)&num_evicted) && (num_evicted < MAX_EVICTED)) {
+        evicted_images[num_evicted++] = img;
+    }
+}
+
+static void setup_residency(size_t budget) {
+    num_evicted = 0;
+    memset(evicted_images, 0, sizeof(evicted_images));
+    setup(&(sg_desc){
+        .residency = {
+            .budget = budget,
+            .evicted_func = evicted_func,
+            .user_data = &num_evicted,
+        },
+    });
+}
+
+// a 16x16 RGBA8 image costs 1 KB
+static sg_image make_evictable_image(int evict_priority) {
+    static uint32_t pixels[16][16];
+    return sg_make_image(&(sg_image_desc){
+        .width = 16,
+        .height = 16,
+        .evictable = true,
+        .evict_priority = evict_priority,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+}
+
+static sg_pipeline make_textured_pipeline(void) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .fs = {
+                .images[0] = { .used = true, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+                .samplers[0] = { .used = true, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+                .image_sampler_pairs[0] = { .used = true, .image_slot = 0, .sampler_slot = 0 },
+            },
+        }),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+}
+
+UTEST(sokol_gfx, residency_memory_size) {
+    setup_residency(0);
+    sg_image img0 = make_evictable_image(0);
+    sg_residency_stats stats = sg_query_residency_stats();
+    T(stats.budget == 0);
+    T(stats.resident_bytes == 1024);
+    T(stats.num_resident_images == 1);
+    // non-evictable images are not tracked
+    create_image();
+    T(sg_query_residency_stats().resident_bytes == 1024);
+    // mipmaps and slices are included
+    static uint32_t pixels[4 * (16*16 + 8*8)];
+    sg_image img1 = sg_make_image(&(sg_image_desc){
+        .type = SG_IMAGETYPE_ARRAY,
+        .width = 16,
+        .height = 16,
+        .num_slices = 4,
+        .num_mipmaps = 2,
+        .evictable = true,
+        .data.subimage[0] = {
+            { .ptr = pixels, .size = 4 * 16 * 16 * 4 },
+            { .ptr = pixels, .size = 4 * 8 * 8 * 4 },
+        },
+    });
+    T(sg_query_image_state(img1) == SG_RESOURCESTATE_VALID);
+    stats = sg_query_residency_stats();
+    T(stats.resident_bytes == 1024 + 4 * (1024 + 256));
+    T(stats.num_resident_images == 2);
+    sg_destroy_image(img1);
+    sg_destroy_image(img0);
+    stats = sg_query_residency_stats();
+    T(stats.resident_bytes == 0);
+    T(stats.peak_bytes == 1024 + 4 * (1024 + 256));
+    T(stats.num_resident_images == 0);
+    // without a budget, nothing is ever evicted
+    for (int i = 0; i < 4; i++) {
+        make_evictable_image(0);
+    }
+    sg_commit();
+    sg_commit();
+    T(sg_query_residency_stats().num_evicted == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, residency_evict_least_recently_used) {
+    setup_residency(2048);
+    sg_pipeline pip = make_textured_pipeline();
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_buffer vbuf = create_buffer();
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){
+        .colors[0].image = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 }),
+    });
+    sg_image img0 = make_evictable_image(0);
+    sg_image img1 = make_evictable_image(0);
+    sg_image img2 = make_evictable_image(0);
+    // images created in the current frame are not evicted
+    sg_commit();
+    T(num_evicted == 0);
+    T(sg_query_residency_stats().resident_bytes == 3072);
+    // use img0 and img2, img1 must be evicted
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .fs = { .images[0] = img0, .samplers[0] = smp } });
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .fs = { .images[0] = img2, .samplers[0] = smp } });
+    sg_end_pass();
+    T(sg_query_image_info(img2).use_frame_index == 2);
+    sg_commit();
+    T(num_evicted == 1);
+    T(evicted_images[0].id == img1.id);
+    T(sg_query_image_state(img1) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_image_info(img1).evicted);
+    T(!sg_query_image_info(img0).evicted);
+    const sg_residency_stats stats = sg_query_residency_stats();
+    T(stats.resident_bytes == 2048);
+    T(stats.num_resident_images == 2);
+    T(stats.num_evicted == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, residency_evict_priority_and_pinning) {
+    setup_residency(1024);
+    sg_image img0 = make_evictable_image(0);
+    sg_image img1 = make_evictable_image(5);
+    sg_image img2 = make_evictable_image(-5);
+    sg_image img3 = make_evictable_image(-10);
+    sg_pin_image(img3);
+    sg_commit();
+    sg_commit();
+    // lowest priority first, the pinned image stays resident
+    T(num_evicted == 3);
+    T(evicted_images[0].id == img2.id);
+    T(evicted_images[1].id == img0.id);
+    T(evicted_images[2].id == img1.id);
+    T(sg_query_image_state(img3) == SG_RESOURCESTATE_VALID);
+    T(sg_query_residency_stats().resident_bytes == 1024);
+    // if everything is pinned, the budget can't be met
+    sg_image img4 = make_evictable_image(0);
+    sg_pin_image(img4);
+    sg_commit();
+    sg_commit();
+    T(num_evicted == 3);
+    T(sg_query_residency_stats().resident_bytes == 2048);
+    sg_unpin_image(img3);
+    sg_commit();
+    T(num_evicted == 4);
+    T(evicted_images[3].id == img3.id);
+    T(sg_query_residency_stats().resident_bytes == 1024);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, residency_placeholder_and_restream) {
+    setup_residency(1024);
+    sg_pipeline pip = make_textured_pipeline();
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_buffer vbuf = create_buffer();
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){
+        .colors[0].image = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 }),
+    });
+    sg_image img0 = make_evictable_image(0);
+    sg_image img1 = make_evictable_image(1);
+    sg_commit();
+    sg_commit();
+    T(num_evicted == 1);
+    T(evicted_images[0].id == img0.id);
+    // binding the evicted image binds a placeholder instead
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .fs = { .images[0] = img0, .samplers[0] = smp } });
+    T(_sg.next_draw_valid);
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    T(num_log_called == 0);
+    T(sg_query_residency_stats().num_placeholder_binds == 1);
+    // ...the placeholder binding doesn't count as use
+    T(sg_query_image_info(img0).use_frame_index == 0);
+    sg_commit();
+    // re-stream the evicted image into the same handle
+    static uint32_t pixels[16][16];
+    sg_init_image(img0, &(sg_image_desc){
+        .width = 16,
+        .height = 16,
+        .evictable = true,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    T(!sg_query_image_info(img0).evicted);
+    T(sg_query_residency_stats().resident_bytes == 2048);
+    // the re-streamed image is protected in its first frame, so img1 is evicted
+    sg_commit();
+    T(num_evicted == 2);
+    T(evicted_images[1].id == img1.id);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    // destroying an evicted image frees the handle
+    sg_destroy_image(img1);
+    T(sg_query_image_state(img1) == SG_RESOURCESTATE_INVALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, residency_image_desc_validation) {
+    setup_residency(1024);
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .render_target = true,
+        .width = 16,
+        .height = 16,
+        .evictable = true,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_EVICTABLE_RT);
+    reset_log_items();
+    static uint32_t pixels[16][16];
+    img = sg_make_image(&(sg_image_desc){
+        .width = 16,
+        .height = 16,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+        .evictable = true,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_EVICTABLE_PIXELFORMAT);
+    T(sg_query_residency_stats().num_resident_images == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, query_next_resource) {
+    setup(&(sg_desc){0});
+    T(sg_query_next_buffer((sg_buffer){0}).id == SG_INVALID_ID);
+    T(sg_query_next_image((sg_image){0}).id == SG_INVALID_ID);
+    sg_buffer buf0 = create_buffer();
+    sg_buffer buf1 = create_buffer();
+    sg_buffer buf2 = create_buffer();
+    sg_destroy_buffer(buf1);
+    // allocated but not initialized buffers are skipped
+    sg_alloc_buffer();
+    sg_image img0 = create_image();
+    int num_bufs = 0;
+    for (sg_buffer buf = sg_query_next_buffer((sg_buffer){0}); buf.id; buf = sg_query_next_buffer(buf)) {
+        T((buf.id == buf0.id) || (buf.id == buf2.id));
+        num_bufs++;
+    }
+    T(num_bufs == 2);
+    sg_image img = sg_query_next_image((sg_image){0});
+    T(img.id == img0.id);
+    T(sg_query_next_image(img).id == SG_INVALID_ID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, dedup_disabled_by_default) {
+    setup(&(sg_desc){0});
+    sg_buffer buf0 = create_buffer();
+    sg_buffer buf1 = create_buffer();
+    T(buf0.id != buf1.id);
+    sg_dedup_stats stats = sg_query_dedup_stats();
+    T(stats.num_buffers == 0);
+    T(stats.num_buffer_hits == 0);
+    T(stats.hashed_bytes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, dedup_buffers) {
+    setup(&(sg_desc){ .dedup_immutable_resources = true });
+    static const float data0[64] = { 1.0f, 2.0f, 3.0f };
+    static const float data1[64] = { 1.0f, 2.0f, 4.0f };
+    sg_buffer buf0 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data0) });
+    sg_buffer buf1 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data0) });
+    sg_buffer buf2 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data1) });
+    sg_buffer buf3 = sg_make_buffer(&(sg_buffer_desc){ .type = SG_BUFFERTYPE_INDEXBUFFER, .data = SG_RANGE(data0) });
+    T(buf0.id == buf1.id);
+    T(buf0.id != buf2.id);
+    T(buf0.id != buf3.id);
+    sg_dedup_stats stats = sg_query_dedup_stats();
+    T(stats.num_buffers == 3);
+    T(stats.num_buffer_hits == 1);
+    T(stats.num_collisions == 0);
+    T(stats.saved_bytes == sizeof(data0));
+    T(stats.hashed_bytes == 4 * sizeof(data0));
+    // the first destroy only drops a reference
+    sg_destroy_buffer(buf0);
+    T(sg_query_buffer_state(buf1) == SG_RESOURCESTATE_VALID);
+    T(sg_query_dedup_stats().saved_bytes == 0);
+    sg_destroy_buffer(buf1);
+    T(sg_query_buffer_state(buf1) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_dedup_stats().num_buffers == 2);
+    // after the last reference is gone, the same content creates a new buffer
+    sg_buffer buf4 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data0) });
+    T(buf4.id != buf0.id);
+    T(sg_query_buffer_state(buf4) == SG_RESOURCESTATE_VALID);
+    T(sg_query_dedup_stats().num_buffers == 3);
+    T(sg_query_dedup_stats().num_buffer_hits == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, dedup_compare_on_hash_match) {
+    setup(&(sg_desc){ .dedup_immutable_resources = true });
+    static const float data[64] = { 1.0f, 2.0f, 3.0f };
+    sg_buffer buf0 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    _sg_dedup_item_t* item = &_sg_lookup_buffer(&_sg.pools, buf0.id)->cmn.dedup;
+    T(item->bytes != 0);
+    T(item->key.size > sizeof(data));
+    // simulate a hash collision by changing the stored copy of the content,
+    // the hash still matches, but the content compare must fail
+    item->bytes[item->key.size - 1] ^= 0xFF;
+    sg_buffer buf1 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    T(buf0.id != buf1.id);
+    sg_dedup_stats stats = sg_query_dedup_stats();
+    T(stats.num_collisions == 1);
+    T(stats.num_buffer_hits == 0);
+    T(stats.num_buffers == 2);
+    // the unchanged copy in the second buffer matches
+    sg_buffer buf2 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    T(buf2.id == buf1.id);
+    T(sg_query_dedup_stats().num_buffer_hits == 1);
+    // the stored copy is freed when the buffer is destroyed
+    sg_destroy_buffer(buf0);
+    T(_sg_lookup_buffer(&_sg.pools, buf0.id) == 0);
+    T(sg_query_dedup_stats().num_buffers == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, dedup_ineligible_buffers) {
+    setup(&(sg_desc){ .dedup_immutable_resources = true });
+    static const float data[16] = { 0 };
+    sg_buffer buf0 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data), .max_views = 4 });
+    sg_buffer buf1 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data), .max_views = 4 });
+    T(buf0.id != buf1.id);
+    sg_buffer buf2 = sg_make_buffer(&(sg_buffer_desc){ .size = sizeof(data), .usage = SG_USAGE_STREAM });
+    sg_buffer buf3 = sg_make_buffer(&(sg_buffer_desc){ .size = sizeof(data), .usage = SG_USAGE_STREAM });
+    T(buf2.id != buf3.id);
+    T(sg_query_dedup_stats().num_buffers == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, dedup_images) {
+    setup(&(sg_desc){ .dedup_immutable_resources = true });
+    static uint32_t pixels0[8][8];
+    static uint32_t pixels1[8][8] = { { 0xFFFFFFFF } };
+    sg_image img0 = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .data.subimage[0][0] = SG_RANGE(pixels0) });
+    sg_image img1 = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .data.subimage[0][0] = SG_RANGE(pixels0) });
+    sg_image img2 = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .data.subimage[0][0] = SG_RANGE(pixels1) });
+    // same content, but different dimensions
+    sg_image img3 = sg_make_image(&(sg_image_desc){ .width = 16, .height = 4, .data.subimage[0][0] = SG_RANGE(pixels0) });
+    // render targets are never deduplicated
+    sg_image img4 = create_image();
+    sg_image img5 = create_image();
+    T(img0.id == img1.id);
+    T(img0.id != img2.id);
+    T(img0.id != img3.id);
+    T(img4.id != img5.id);
+    sg_dedup_stats stats = sg_query_dedup_stats();
+    T(stats.num_images == 3);
+    T(stats.num_image_hits == 1);
+    T(stats.saved_bytes == sizeof(pixels0));
+    sg_destroy_image(img1);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    sg_destroy_image(img0);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_INVALID);
+    stats = sg_query_dedup_stats();
+    T(stats.num_images == 2);
+    T(stats.saved_bytes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, copy_buffer) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().copy_buffer);
+    static const float data[16] = { 0 };
+    sg_buffer src = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    sg_buffer dst = sg_make_buffer(&(sg_buffer_desc){ .size = sizeof(data), .usage = SG_USAGE_DYNAMIC });
+    sg_copy_buffer(dst, 16, src, 0, 32);
+    T(num_log_called == 0);
+    sg_commit();
+    sg_frame_stats stats = sg_query_frame_stats();
+    T(stats.num_copy_buffer == 1);
+    T(stats.size_copy_buffer == 32);
+    sg_copy_buffer(dst, 0, src, 16, 48);
+    sg_copy_buffer(dst, 0, src, 0, 64);
+    T(num_log_called == 0);
+    sg_commit();
+    stats = sg_query_frame_stats();
+    T(stats.num_copy_buffer == 2);
+    T(stats.size_copy_buffer == 112);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, copy_buffer_validation) {
+    setup(&(sg_desc){0});
+    static const float data[16] = { 0 };
+    sg_buffer src = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    sg_buffer dst = sg_make_buffer(&(sg_buffer_desc){ .size = sizeof(data), .usage = SG_USAGE_STREAM });
+    sg_copy_buffer(src, 0, dst, 0, 16);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_USAGE);
+    reset_log_items();
+    sg_copy_buffer(dst, 2, src, 0, 16);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_ALIGNMENT);
+    reset_log_items();
+    sg_copy_buffer(dst, 0, src, 16, 64);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_SRC_RANGE);
+    reset_log_items();
+    sg_copy_buffer(dst, 16, src, 0, 64);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_DST_RANGE);
+    reset_log_items();
+    sg_copy_buffer(dst, 16, dst, 0, 32);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_OVERLAP);
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 16, .height = 16 } });
+    sg_copy_buffer(dst, 0, src, 0, 16);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_INPASS);
+    sg_end_pass();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, copy_buffer_shadow) {
+    setup(&(sg_desc){0});
+    static const uint32_t data0[4] = { 1, 2, 3, 4 };
+    static const uint32_t data1[4] = { 5, 6, 7, 8 };
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_DYNAMIC });
+    sg_update_buffer_range(buf, 0, &SG_RANGE(data0));
+    sg_update_buffer_range(buf, 16, &SG_RANGE(data1));
+    // defragment within the same buffer, the shadow copy follows the copy
+    sg_copy_buffer(buf, 48, buf, 16, 16);
+    T(num_log_called == 0);
+    const _sg_buffer_t* b = _sg_lookup_buffer(&_sg.pools, buf.id);
+    T(b && b->cmn.shadow);
+    T(0 == memcmp(b->cmn.shadow + 48, data1, sizeof(data1)));
+    // a buffer without shadow copy can't be copied into a buffer with shadow copy
+    sg_buffer src = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data0) });
+    sg_copy_buffer(buf, 32, src, 0, 16);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYBUF_SHADOW);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, copy_image_region) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().copy_image);
+    static uint32_t pixels[16][16];
+    sg_image src = sg_make_image(&(sg_image_desc){ .width = 16, .height = 16, .data.subimage[0][0] = SG_RANGE(pixels) });
+    sg_image atlas = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 64, .num_mipmaps = 2 });
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = atlas, .x = 16, .y = 32 }, .src = { .image = src } });
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = atlas, .mip_level = 1 }, .src = { .image = src, .x = 8 }, .height = 4 });
+    T(num_log_called == 0);
+    sg_commit();
+    sg_frame_stats stats = sg_query_frame_stats();
+    T(stats.num_copy_image == 2);
+    T(stats.size_copy_image == (16 * 16 * 4) + (8 * 4 * 4));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, copy_image_region_validation) {
+    setup(&(sg_desc){0});
+    static uint32_t pixels[16][16];
+    sg_image src = sg_make_image(&(sg_image_desc){ .width = 16, .height = 16, .data.subimage[0][0] = SG_RANGE(pixels) });
+    sg_image dst = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 32, .height = 32 });
+    sg_image dst_r8 = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 32, .height = 32, .pixel_format = SG_PIXELFORMAT_R8 });
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = src }, .src = { .image = dst }, .width = 8, .height = 8 });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_USAGE);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst_r8 }, .src = { .image = src } });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_FORMAT);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst }, .src = { .image = src, .mip_level = 1 } });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_SRC_REGION);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst, .x = 24 }, .src = { .image = src } });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_DST_REGION);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst, .slice = 1 }, .src = { .image = src } });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_DST_REGION);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst, .x = 8 }, .src = { .image = dst }, .width = 16, .height = 16 });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COPYIMG_OVERLAP);
+    reset_log_items();
+    sg_copy_image_region(&(sg_image_copy_desc){ .dst = { .image = dst, .x = 16 }, .src = { .image = dst }, .width = 16, .height = 16 });
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, coalesce_draws_disabled_by_default) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = make_uniform_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 6, 1);
+    T(!_sg.coalesce.pending);
+    sg_draw(6, 6, 1);
+    T(!_sg.coalesce.pending);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().num_draw == 2);
+    T(sg_query_frame_stats().num_coalesced_draws == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, coalesce_draws) {
+    setup(&(sg_desc){ .coalesce_draws = true, .dedup_uniforms = true });
+    sg_pipeline pip = make_uniform_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    float a[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float b[4] = { 1.0f, 2.0f, 3.0f, 5.0f };
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));
+    sg_draw(0, 6, 1);
+    T(_sg.coalesce.pending);
+    sg_draw(6, 6, 1);
+    sg_draw(12, 6, 1);
+    T(_sg.coalesce.pending);
+    T(_sg.coalesce.base_element == 0);
+    T(_sg.coalesce.num_elements == 18);
+    // re-applying the same pipeline, bindings and uniforms doesn't break the batch
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(a));
+    sg_draw(18, 6, 1);
+    T(_sg.coalesce.num_elements == 24);
+    // a gap in the element range starts a new batch
+    sg_draw(30, 6, 1);
+    T(_sg.coalesce.base_element == 30);
+    T(_sg.coalesce.num_elements == 6);
+    // instanced draws are never merged
+    sg_draw(36, 6, 2);
+    T(_sg.coalesce.base_element == 36);
+    sg_draw(42, 6, 1);
+    T(_sg.coalesce.base_element == 42);
+    T(_sg.coalesce.num_elements == 6);
+    // new uniform data flushes the held back draw
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(b));
+    T(!_sg.coalesce.pending);
+    sg_draw(48, 6, 1);
+    sg_apply_viewport(0, 0, 4, 4, true);
+    T(!_sg.coalesce.pending);
+    sg_draw(54, 6, 1);
+    sg_end_pass();
+    T(!_sg.coalesce.pending);
+    sg_commit();
+    T(sg_query_frame_stats().num_draw == 9);
+    T(sg_query_frame_stats().num_coalesced_draws == 3);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, coalesce_draws_strips) {
+    setup(&(sg_desc){ .coalesce_draws = true });
+    sg_pipeline strip_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&(sg_shader_desc){0}),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    sg_pipeline line_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&(sg_shader_desc){0}),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .primitive_type = SG_PRIMITIVETYPE_LINES,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    sg_buffer vbuf = create_buffer();
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    // strips are never held back or merged
+    sg_apply_pipeline(strip_pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 4, 1);
+    T(!_sg.coalesce.pending);
+    sg_draw(4, 4, 1);
+    T(!_sg.coalesce.pending);
+    // line lists are merged, but only if the draws contain whole lines
+    sg_apply_pipeline(line_pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 4, 1);
+    sg_draw(4, 4, 1);
+    T(_sg.coalesce.pending);
+    T(_sg.coalesce.num_elements == 8);
+    sg_draw(8, 3, 1);
+    T(_sg.coalesce.base_element == 8);
+    sg_draw(11, 2, 1);
+    T(_sg.coalesce.base_element == 11);
+    // switching back to the strip pipeline flushes the held back draw
+    sg_apply_pipeline(strip_pip);
+    T(!_sg.coalesce.pending);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().num_draw == 6);
+    T(sg_query_frame_stats().num_coalesced_draws == 1);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, coalesce_draws_flush_on_update) {
+    setup(&(sg_desc){ .coalesce_draws = true });
+    sg_pipeline pip = make_uniform_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_buffer dyn_buf = sg_make_buffer(&(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_STREAM });
+    sg_image img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = img });
+    float data[16] = { 0 };
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 6, 1);
+    T(_sg.coalesce.pending);
+    sg_append_buffer(dyn_buf, &SG_RANGE(data));
+    T(!_sg.coalesce.pending);
+    sg_draw(6, 6, 1);
+    // different bindings flush the held back draw
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .vertex_buffer_offsets[0] = 16 });
+    T(!_sg.coalesce.pending);
+    sg_draw(12, 6, 1);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_frame_stats().num_coalesced_draws == 0);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, mip_streaming) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().mip_streaming);
+    static uint32_t mip0[16][16], mip1[8][8], mip2[4][4], mip3[2][2], mip4[1][1];
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .width = 16,
+        .height = 16,
+        .num_mipmaps = 5,
+        .num_resident_mipmaps = 2,
+        .data.subimage[0] = { [3] = SG_RANGE(mip3), [4] = SG_RANGE(mip4) },
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_info(img).base_mip_level == 3);
+    // the base level doesn't move while there's a gap in the resident mipmaps
+    sg_update_image_mip(img, 1, &(sg_image_data){ .subimage[0][1] = SG_RANGE(mip1) });
+    T(sg_query_image_info(img).base_mip_level == 3);
+    sg_update_image_mip(img, 2, &(sg_image_data){ .subimage[0][2] = SG_RANGE(mip2) });
+    T(sg_query_image_info(img).base_mip_level == 1);
+    sg_update_image_mip(img, 0, &(sg_image_data){ .subimage[0][0] = SG_RANGE(mip0) });
+    T(sg_query_image_info(img).base_mip_level == 0);
+    sg_commit();
+    T(sg_query_frame_stats().num_update_image_mip == 3);
+    T(sg_query_frame_stats().size_update_image_mip == sizeof(mip0) + sizeof(mip1) + sizeof(mip2));
+    // fully resident images have a base level of 0
+    sg_image img2 = sg_make_image(&(sg_image_desc){
+        .width = 2,
+        .height = 2,
+        .num_mipmaps = 2,
+        .data.subimage[0] = { [0] = SG_RANGE(mip3), [1] = SG_RANGE(mip4) },
+    });
+    T(sg_query_image_info(img2).base_mip_level == 0);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, mip_streaming_validation) {
+    setup(&(sg_desc){0});
+    static uint32_t mip0[8][8], mip1[4][4], mip2[2][2];
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .num_mipmaps = 3,
+        .num_resident_mipmaps = 4,
+        .data.subimage[0] = { SG_RANGE(mip0), SG_RANGE(mip1), SG_RANGE(mip2) },
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_RESIDENT_MIPMAPS);
+    reset_log_items();
+    img = sg_make_image(&(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .num_mipmaps = 3,
+        .num_resident_mipmaps = 1,
+        .data.subimage[0] = { [1] = SG_RANGE(mip1), [2] = SG_RANGE(mip2) },
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_STREAMING_NO_DATA);
+    reset_log_items();
+    img = sg_make_image(&(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .num_mipmaps = 3,
+        .num_resident_mipmaps = 1,
+        .usage = SG_USAGE_DYNAMIC,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_STREAMING_USAGE);
+    reset_log_items();
+    img = sg_make_image(&(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .num_mipmaps = 3,
+        .num_resident_mipmaps = 1,
+        .data.subimage[0][2] = SG_RANGE(mip2),
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(num_log_called == 0);
+    sg_update_image_mip(img, 3, &(sg_image_data){ .subimage[0][3] = SG_RANGE(mip2) });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGMIP_MIPLEVEL);
+    reset_log_items();
+    sg_update_image_mip(img, 2, &(sg_image_data){ .subimage[0][2] = SG_RANGE(mip2) });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGMIP_RESIDENT);
+    reset_log_items();
+    sg_update_image_mip(img, 1, &(sg_image_data){ .subimage[0][1] = SG_RANGE(mip2) });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDATA_DATA_SIZE);
+    T(sg_query_image_info(img).base_mip_level == 2);
+    reset_log_items();
+    sg_update_image_mip(img, 1, &(sg_image_data){ .subimage[0][1] = SG_RANGE(mip1) });
+    T(num_log_called == 0);
+    T(sg_query_image_info(img).base_mip_level == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, mip_streaming_residency) {
+    setup(&(sg_desc){ .residency.budget = 1024 * 1024 });
+    static uint32_t mip0[8][8], mip1[4][4], mip2[2][2];
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .num_mipmaps = 3,
+        .num_resident_mipmaps = 1,
+        .evictable = true,
+        .data.subimage[0][2] = SG_RANGE(mip2),
+    });
+    T(sg_query_residency_stats().resident_bytes == sizeof(mip2));
+    sg_update_image_mip(img, 1, &(sg_image_data){ .subimage[0][1] = SG_RANGE(mip1) });
+    T(sg_query_residency_stats().resident_bytes == sizeof(mip1) + sizeof(mip2));
+    sg_update_image_mip(img, 0, &(sg_image_data){ .subimage[0][0] = SG_RANGE(mip0) });
+    T(sg_query_residency_stats().resident_bytes == sizeof(mip0) + sizeof(mip1) + sizeof(mip2));
+    sg_destroy_image(img);
+    T(sg_query_residency_stats().resident_bytes == 0);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
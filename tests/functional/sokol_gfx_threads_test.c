@@ -0,0 +1,494 @@
+//------------------------------------------------------------------------------
+//  sokol-gfx-threads-test.c
+//
+//  Tests for the optional sokol_gfx.h features which are enabled at compile
+//  time (SOKOL_THREADSAFE_RESOURCES, SOKOL_THREADLOCAL_CONTEXT and
+//  SOKOL_TRACK_RESOURCE_USAGE). These live in their own executable so that
+//  sokol-gfx-test.c keeps testing the default configuration.
+//------------------------------------------------------------------------------
+#include "force_dummy_backend.h"
+#define SOKOL_IMPL
+#define SOKOL_THREADSAFE_RESOURCES
+#define SOKOL_THREADLOCAL_CONTEXT
+#define SOKOL_TRACK_RESOURCE_USAGE
+#define SOKOL_TRACE_HOOKS
+#include "sokol_gfx.h"
+#include "utest.h"
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOGITEMS (32)
+static int num_log_called = 0;
+static sg_log_item log_items[MAX_LOGITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag;
+    (void)log_level;
+    (void)message_or_null;
+    (void)line_nr;
+    (void)filename_or_null;
+    (void)user_data;
+    if (num_log_called < MAX_LOGITEMS) {
+        log_items[num_log_called++] = log_item_id;
+    }
+    if (message_or_null) {
+        printf("%s\n", message_or_null);
+    }
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    memset(log_items, 0, sizeof(log_items));
+}
+
+static void setup(const sg_desc* desc) {
+    reset_log_items();
+    sg_desc desc_with_logger = *desc;
+    desc_with_logger.logger.func = test_logger;
+    sg_setup(&desc_with_logger);
+}
+
+static sg_buffer create_buffer(void) {
+    static const float data[] = { 1, 2, 3, 4 };
+    return sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+}
+
+static sg_image make_evictable_image(int evict_priority) {
+    static uint32_t pixels[16][16];
+    return sg_make_image(&(sg_image_desc){
+        .width = 16,
+        .height = 16,
+        .evictable = true,
+        .evict_priority = evict_priority,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+}
+
+static sg_pipeline make_textured_pipeline(void) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .fs = {
+                .images[0] = { .used = true, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+                .samplers[0] = { .used = true, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+                .image_sampler_pairs[0] = { .used = true, .image_slot = 0, .sampler_slot = 0 },
+            },
+        }),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+}
+
+UTEST(sokol_gfx, queue_init_buffer) {
+    setup(&(sg_desc){0});
+    float data[4] = { 1, 2, 3, 4 };
+    sg_buffer buf = sg_alloc_buffer();
+    sg_queue_init_buffer(buf, &(sg_buffer_desc){ .data = SG_RANGE(data), .label = "buf" });
+    // desc content is copied
+    memset(data, 0, sizeof(data));
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_ALLOC);
+    sg_commit();
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_desc(buf).size == sizeof(data));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, queue_init_image) {
+    setup(&(sg_desc){0});
+    uint32_t pixels[8][8] = {0};
+    sg_image img = sg_alloc_image();
+    sg_queue_init_image(img, &(sg_image_desc){
+        .width = 8,
+        .height = 8,
+        .data.subimage[0][0] = SG_RANGE(pixels),
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_ALLOC);
+    sg_commit();
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_desc(img).width == 8);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, queue_init_dealloc_before_commit) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_alloc_buffer();
+    sg_queue_init_buffer(buf, &(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_STREAM });
+    sg_dealloc_buffer(buf);
+    sg_commit();
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_INVALID);
+    sg_shutdown();
+}
+
+#define NUM_PRODUCER_THREADS (8)
+#define NUM_PRODUCER_ITEMS (64)
+typedef struct {
+    sg_buffer bufs[NUM_PRODUCER_ITEMS];
+    sg_image imgs[NUM_PRODUCER_ITEMS];
+} producer_t;
+
+static void produce(producer_t* p) {
+    static const uint32_t pixels[4][4] = {0};
+    for (int i = 0; i < NUM_PRODUCER_ITEMS; i++) {
+        const float data[4] = { 1, 2, 3, (float)i };
+        p->bufs[i] = sg_alloc_buffer();
+        sg_queue_init_buffer(p->bufs[i], &(sg_buffer_desc){ .data = SG_RANGE(data) });
+        p->imgs[i] = sg_alloc_image();
+        sg_queue_init_image(p->imgs[i], &(sg_image_desc){
+            .width = 4,
+            .height = 4,
+            .data.subimage[0][0] = SG_RANGE(pixels),
+        });
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI producer_func(LPVOID arg) {
+    produce((producer_t*)arg);
+    return 0;
+}
+#else
+static void* producer_func(void* arg) {
+    produce((producer_t*)arg);
+    return 0;
+}
+#endif
+
+UTEST(sokol_gfx, queue_init_multithreaded) {
+    setup(&(sg_desc){
+        .buffer_pool_size = NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS,
+        .image_pool_size = NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS,
+    });
+    static producer_t producers[NUM_PRODUCER_THREADS];
+    memset(producers, 0, sizeof(producers));
+    #if defined(_WIN32)
+    HANDLE threads[NUM_PRODUCER_THREADS];
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        threads[i] = CreateThread(NULL, 0, producer_func, &producers[i], 0, NULL);
+    }
+    #else
+    pthread_t threads[NUM_PRODUCER_THREADS];
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        pthread_create(&threads[i], 0, producer_func, &producers[i]);
+    }
+    #endif
+    // the render thread keeps committing frames while the producers are running
+    for (int i = 0; i < 64; i++) {
+        sg_commit();
+    }
+    #if defined(_WIN32)
+    WaitForMultipleObjects(NUM_PRODUCER_THREADS, threads, TRUE, INFINITE);
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        CloseHandle(threads[i]);
+    }
+    #else
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        pthread_join(threads[i], 0);
+    }
+    #endif
+    sg_commit();
+    // all handles must be unique and valid
+    for (int t = 0; t < NUM_PRODUCER_THREADS; t++) {
+        for (int i = 0; i < NUM_PRODUCER_ITEMS; i++) {
+            T(sg_query_buffer_state(producers[t].bufs[i]) == SG_RESOURCESTATE_VALID);
+            T(sg_query_image_state(producers[t].imgs[i]) == SG_RESOURCESTATE_VALID);
+        }
+    }
+    for (int t = 0; t < NUM_PRODUCER_THREADS; t++) {
+        for (int i = 0; i < NUM_PRODUCER_ITEMS; i++) {
+            sg_destroy_buffer(producers[t].bufs[i]);
+            sg_destroy_image(producers[t].imgs[i]);
+        }
+    }
+    T(num_log_called == 0);
+    // pools must be completely free again
+    for (int i = 0; i < NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS; i++) {
+        T(sg_alloc_buffer().id != SG_INVALID_ID);
+    }
+    T(sg_alloc_buffer().id == SG_INVALID_ID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, alloc_while_iterating_pools) {
+    setup(&(sg_desc){
+        .buffer_pool_size = NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS + 16,
+        .image_pool_size = NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS + 16,
+        .residency.budget = 1,
+    });
+    // a pinned evictable image keeps the residency budget exceeded, so that
+    // each sg_commit() walks the image pool
+    sg_image pinned_img = make_evictable_image(0);
+    sg_pin_image(pinned_img);
+    for (int i = 0; i < 8; i++) {
+        create_buffer();
+    }
+    static producer_t producers[NUM_PRODUCER_THREADS];
+    memset(producers, 0, sizeof(producers));
+    #if defined(_WIN32)
+    HANDLE threads[NUM_PRODUCER_THREADS];
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        threads[i] = CreateThread(NULL, 0, producer_func, &producers[i], 0, NULL);
+    }
+    #else
+    pthread_t threads[NUM_PRODUCER_THREADS];
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        pthread_create(&threads[i], 0, producer_func, &producers[i]);
+    }
+    #endif
+    // the render thread iterates the pools while the producers allocate,
+    // only initialized resources must show up
+    bool iter_ok = true;
+    for (int frame = 0; frame < 64; frame++) {
+        int num_bufs = 0;
+        for (sg_buffer buf = sg_query_next_buffer((sg_buffer){0}); buf.id; buf = sg_query_next_buffer(buf)) {
+            iter_ok &= sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID;
+            num_bufs++;
+        }
+        iter_ok &= num_bufs >= 8;
+        for (sg_image img = sg_query_next_image((sg_image){0}); img.id; img = sg_query_next_image(img)) {
+            iter_ok &= sg_query_image_state(img) == SG_RESOURCESTATE_VALID;
+        }
+        sg_commit();
+    }
+    #if defined(_WIN32)
+    WaitForMultipleObjects(NUM_PRODUCER_THREADS, threads, TRUE, INFINITE);
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        CloseHandle(threads[i]);
+    }
+    #else
+    for (int i = 0; i < NUM_PRODUCER_THREADS; i++) {
+        pthread_join(threads[i], 0);
+    }
+    #endif
+    T(iter_ok);
+    sg_commit();
+    int num_bufs = 0;
+    for (sg_buffer buf = sg_query_next_buffer((sg_buffer){0}); buf.id; buf = sg_query_next_buffer(buf)) {
+        num_bufs++;
+    }
+    T(num_bufs == 8 + NUM_PRODUCER_THREADS * NUM_PRODUCER_ITEMS);
+    T(sg_query_image_state(pinned_img) == SG_RESOURCESTATE_VALID);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+static int num_traced_allocs = 0;
+static int num_traced_inits = 0;
+
+static void trace_alloc_buffer(sg_buffer result, void* user_data) {
+    (void)result;
+    (void)user_data;
+    num_traced_allocs++;
+}
+
+static void trace_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc, void* user_data) {
+    (void)buf_id;
+    (void)user_data;
+    if (desc->size == 64) {
+        num_traced_inits++;
+    }
+}
+
+static void alloc_and_queue_buffer(sg_buffer* buf) {
+    *buf = sg_alloc_buffer();
+    sg_queue_init_buffer(*buf, &(sg_buffer_desc){ .size = 64, .usage = SG_USAGE_STREAM });
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI trace_thread_func(LPVOID arg) {
+    alloc_and_queue_buffer((sg_buffer*)arg);
+    return 0;
+}
+#else
+static void* trace_thread_func(void* arg) {
+    alloc_and_queue_buffer((sg_buffer*)arg);
+    return 0;
+}
+#endif
+
+UTEST(sokol_gfx, queue_init_trace_hooks) {
+    setup(&(sg_desc){0});
+    num_traced_allocs = 0;
+    num_traced_inits = 0;
+    sg_install_trace_hooks(&(sg_trace_hooks){
+        .alloc_buffer = trace_alloc_buffer,
+        .init_buffer = trace_init_buffer,
+    });
+    // allocations on the render thread are traced immediately
+    sg_buffer buf0;
+    alloc_and_queue_buffer(&buf0);
+    T(num_traced_allocs == 1);
+    // ...but not on worker threads
+    sg_buffer buf1 = {0};
+    #if defined(_WIN32)
+    HANDLE thread = CreateThread(NULL, 0, trace_thread_func, &buf1, 0, NULL);
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    #else
+    pthread_t thread;
+    pthread_create(&thread, 0, trace_thread_func, &buf1);
+    pthread_join(thread, 0);
+    #endif
+    T(buf1.id != SG_INVALID_ID);
+    T(num_traced_allocs == 1);
+    T(num_traced_inits == 0);
+    // the queued initializations are traced on the render thread in sg_commit()
+    sg_commit();
+    T(num_traced_inits == 2);
+    T(sg_query_buffer_state(buf0) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_state(buf1) == SG_RESOURCESTATE_VALID);
+    // items queued after the queue was processed go into the next frame
+    alloc_and_queue_buffer(&buf0);
+    sg_commit();
+    T(num_traced_inits == 3);
+    T(sg_query_buffer_state(buf0) == SG_RESOURCESTATE_VALID);
+    sg_shutdown();
+}
+
+#define NUM_CONTEXT_THREADS (4)
+#define NUM_CONTEXT_FRAMES (16)
+typedef struct {
+    sg_context ctx;
+    bool ok;
+} context_thread_t;
+
+static void render_context(context_thread_t* t) {
+    t->ok = true;
+    // each thread starts out with the default context as current
+    t->ok &= sg_get_context().id == sg_default_context().id;
+    sg_set_context(t->ctx);
+    t->ok &= sg_get_context().id == t->ctx.id;
+    for (int i = 0; i < NUM_CONTEXT_FRAMES; i++) {
+        sg_buffer buf = create_buffer();
+        t->ok &= sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID;
+        sg_commit();
+        sg_destroy_buffer(buf);
+    }
+    t->ok &= _sg.frame_index == (NUM_CONTEXT_FRAMES + 1);
+    t->ok &= sg_query_frame_stats().frame_index == NUM_CONTEXT_FRAMES;
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI context_thread_func(LPVOID arg) {
+    render_context((context_thread_t*)arg);
+    return 0;
+}
+#else
+static void* context_thread_func(void* arg) {
+    render_context((context_thread_t*)arg);
+    return 0;
+}
+#endif
+
+UTEST(sokol_gfx, context_threadlocal) {
+    setup(&(sg_desc){0});
+    static context_thread_t contexts[NUM_CONTEXT_THREADS];
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        contexts[i].ctx = sg_make_context(&(sg_desc){ .logger.func = test_logger });
+        contexts[i].ok = false;
+    }
+    #if defined(_WIN32)
+    HANDLE threads[NUM_CONTEXT_THREADS];
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        threads[i] = CreateThread(NULL, 0, context_thread_func, &contexts[i], 0, NULL);
+    }
+    WaitForMultipleObjects(NUM_CONTEXT_THREADS, threads, TRUE, INFINITE);
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        CloseHandle(threads[i]);
+    }
+    #else
+    pthread_t threads[NUM_CONTEXT_THREADS];
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        pthread_create(&threads[i], 0, context_thread_func, &contexts[i]);
+    }
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        pthread_join(threads[i], 0);
+    }
+    #endif
+    // the main thread's current context is unaffected
+    T(sg_get_context().id == sg_default_context().id);
+    T(_sg.frame_index == 1);
+    for (int i = 0; i < NUM_CONTEXT_THREADS; i++) {
+        T(contexts[i].ok);
+        sg_destroy_context(contexts[i].ctx);
+    }
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, resource_usage_binds) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = make_textured_pipeline();
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_buffer vbuf = create_buffer();
+    sg_image tex = make_evictable_image(0);
+    sg_image rt = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 8, .height = 8 });
+    sg_attachments atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = rt });
+    T(sg_query_image_info(tex).usage.last_used_frame_index == 0);
+    const sg_bindings bnd = { .vertex_buffers[0] = vbuf, .fs = { .images[0] = tex, .samplers[0] = smp } };
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&bnd);
+    sg_apply_bindings(&bnd);
+    sg_apply_bindings(&bnd);
+    sg_end_pass();
+    sg_resource_usage usage = sg_query_image_info(tex).usage;
+    T(usage.last_used_frame_index == 1);
+    T(usage.num_binds == 3);
+    T(usage.num_binds_prev_frame == 0);
+    T(usage.num_binds_total == 3);
+    T(sg_query_buffer_info(vbuf).usage.num_binds == 3);
+    // render targets count as used when the pass is started
+    T(sg_query_image_info(rt).usage.num_binds == 1);
+    sg_commit();
+    usage = sg_query_image_info(tex).usage;
+    T(usage.num_binds == 0);
+    T(usage.num_binds_prev_frame == 3);
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&bnd);
+    sg_end_pass();
+    usage = sg_query_image_info(tex).usage;
+    T(usage.last_used_frame_index == 2);
+    T(usage.num_binds == 1);
+    T(usage.num_binds_prev_frame == 3);
+    T(usage.num_binds_total == 4);
+    // after an unused frame, the previous frame counter is 0 again
+    sg_commit();
+    sg_commit();
+    usage = sg_query_image_info(tex).usage;
+    T(usage.last_used_frame_index == 2);
+    T(usage.num_binds == 0);
+    T(usage.num_binds_prev_frame == 0);
+    T(usage.num_binds_total == 4);
+    // invalid bindings are not counted
+    sg_begin_pass(&(sg_pass){ .attachments = atts });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .fs = { .images[0] = tex, .samplers[0] = smp } });
+    sg_end_pass();
+    T(sg_query_image_info(tex).usage.num_binds_total == 4);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, resource_usage_updates) {
+    setup(&(sg_desc){0});
+    static const float data[16] = { 0 };
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){ .size = sizeof(data), .usage = SG_USAGE_STREAM });
+    sg_update_buffer(buf, &SG_RANGE(data));
+    T(sg_query_buffer_info(buf).usage.num_updated_bytes == sizeof(data));
+    sg_commit();
+    sg_append_buffer(buf, &(sg_range){ .ptr = data, .size = 16 });
+    sg_append_buffer(buf, &(sg_range){ .ptr = data, .size = 16 });
+    T(sg_query_buffer_info(buf).usage.num_updated_bytes == sizeof(data) + 32);
+    static uint32_t pixels[8][8];
+    sg_image img = sg_make_image(&(sg_image_desc){ .width = 8, .height = 8, .usage = SG_USAGE_DYNAMIC });
+    sg_update_image(img, &(sg_image_data){ .subimage[0][0] = SG_RANGE(pixels) });
+    T(sg_query_image_info(img).usage.num_updated_bytes == sizeof(pixels));
+    T(sg_query_image_info(img).usage.num_binds_total == 0);
+    sg_shutdown();
+}
+
+UTEST_MAIN();
@@ -0,0 +1,304 @@
+//------------------------------------------------------------------------------
+//  sokol-rendergraph-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_RENDERGRAPH_IMPL
+#include "sokol_rendergraph.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOGITEMS (32)
+static int num_log_called = 0;
+static srg_log_item_t log_items[MAX_LOGITEMS];
+
+#define MAX_EXECUTED (32)
+static int num_executed = 0;
+static int executed[MAX_EXECUTED];
+static int num_begin_hooks = 0;
+static int num_end_hooks = 0;
+static bool exec_order_ok = true;
+static bool hook_order_ok = true;
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag;
+    (void)log_level;
+    (void)message_or_null;
+    (void)line_nr;
+    (void)filename_or_null;
+    (void)user_data;
+    if (num_log_called < MAX_LOGITEMS) {
+        log_items[num_log_called++] = (srg_log_item_t)log_item_id;
+    }
+}
+
+static void exec_pass(const srg_pass_info_t* info) {
+    if (num_executed < MAX_EXECUTED) {
+        exec_order_ok &= (info->exec_index == num_executed);
+        executed[num_executed++] = info->pass_index;
+    }
+}
+
+static void begin_pass_hook(const srg_pass_info_t* info, void* user_data) {
+    hook_order_ok &= (user_data == (void*)&num_begin_hooks);
+    hook_order_ok &= (num_begin_hooks == num_end_hooks) && (info->exec_index == num_executed);
+    num_begin_hooks++;
+}
+
+static void end_pass_hook(const srg_pass_info_t* info, void* user_data) {
+    hook_order_ok &= (user_data == (void*)&num_begin_hooks);
+    num_end_hooks++;
+    hook_order_ok &= (num_begin_hooks == num_end_hooks) && (info->exec_index == (num_executed - 1));
+}
+
+static void init(const srg_desc_t* desc) {
+    num_log_called = 0;
+    num_executed = 0;
+    num_begin_hooks = 0;
+    num_end_hooks = 0;
+    exec_order_ok = true;
+    hook_order_ok = true;
+    sg_setup(&(sg_desc){0});
+    srg_desc_t desc_with_logger = *desc;
+    desc_with_logger.logger.func = test_logger;
+    srg_setup(&desc_with_logger);
+}
+
+static void shutdown(void) {
+    srg_shutdown();
+    sg_shutdown();
+}
+
+typedef struct {
+    sg_image img;
+    sg_attachments atts;
+} target_t;
+
+static target_t make_target(void) {
+    target_t tgt;
+    tgt.img = sg_make_image(&(sg_image_desc){ .render_target = true, .width = 64, .height = 64 });
+    tgt.atts = sg_make_attachments(&(sg_attachments_desc){ .colors[0].image = tgt.img });
+    return tgt;
+}
+
+static int add_pass(const char* label, sg_image read, const target_t* write, bool output) {
+    return srg_add_pass(&(srg_pass_desc_t){
+        .label = label,
+        .reads = { read },
+        .writes = { write->img },
+        .output = output,
+        .pass = { .attachments = write->atts },
+        .exec_cb = exec_pass,
+    });
+}
+
+UTEST(sokol_rendergraph, default_init_shutdown) {
+    init(&(srg_desc_t){0});
+    T(_srg.init_cookie == _SRG_INIT_COOKIE);
+    T(_srg.desc.max_passes == 128);
+    T(_srg.desc.max_resources == 256);
+    T(_srg.passes);
+    T(_srg.resources);
+    T(_srg.edges);
+    T(_srg.adj);
+    shutdown();
+    T(_srg.init_cookie == 0);
+    T(_srg.passes == 0);
+}
+
+UTEST(sokol_rendergraph, reverse_declared_chain) {
+    init(&(srg_desc_t){0});
+    target_t a = make_target();
+    target_t b = make_target();
+    target_t c = make_target();
+    srg_begin();
+    // declare consumers before producers
+    T(add_pass("c", b.img, &c, true) == 0);
+    T(add_pass("b", a.img, &b, false) == 1);
+    T(add_pass("a", (sg_image){0}, &a, false) == 2);
+    T(srg_compile());
+    srg_execute();
+    T(num_executed == 3);
+    T(executed[0] == 2);
+    T(executed[1] == 1);
+    T(executed[2] == 0);
+    T(exec_order_ok);
+    srg_stats_t stats = srg_query_stats();
+    T(stats.num_passes == 3);
+    T(stats.num_resources == 3);
+    T(stats.num_culled_passes == 0);
+    T(stats.num_executed_passes == 3);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, cull_unused_passes) {
+    init(&(srg_desc_t){0});
+    target_t a = make_target();
+    target_t b = make_target();
+    target_t unused = make_target();
+    target_t display = make_target();
+    srg_begin();
+    const int pa = add_pass("a", (sg_image){0}, &a, false);
+    const int pu0 = add_pass("unused0", a.img, &unused, false);
+    const int pb = add_pass("b", (sg_image){0}, &b, false);
+    const int pu1 = add_pass("unused1", unused.img, &unused, false);
+    const int pd = add_pass("display", a.img, &display, true);
+    srg_execute();
+    T(!srg_query_pass_culled(pa));
+    T(srg_query_pass_culled(pu0));
+    T(srg_query_pass_culled(pb));
+    T(srg_query_pass_culled(pu1));
+    T(!srg_query_pass_culled(pd));
+    T(num_executed == 2);
+    T(executed[0] == pa);
+    T(executed[1] == pd);
+    srg_stats_t stats = srg_query_stats();
+    T(stats.num_culled_passes == 3);
+    T(stats.num_executed_passes == 2);
+
+    // same graph, but now image b is consumed outside the graph
+    num_executed = 0;
+    srg_begin();
+    add_pass("a", (sg_image){0}, &a, false);
+    add_pass("unused0", a.img, &unused, false);
+    add_pass("b", (sg_image){0}, &b, false);
+    add_pass("unused1", unused.img, &unused, false);
+    add_pass("display", a.img, &display, true);
+    srg_mark_output(b.img);
+    srg_execute();
+    T(!srg_query_pass_culled(pb));
+    T(num_executed == 3);
+    T(srg_query_stats().num_culled_passes == 2);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, ping_pong) {
+    init(&(srg_desc_t){0});
+    target_t src = make_target();
+    target_t x = make_target();
+    target_t y = make_target();
+    target_t display = make_target();
+    srg_begin();
+    // declared out of order: display is declared first and reads the final content of x
+    const int pd = add_pass("display", x.img, &display, true);
+    const int p0 = add_pass("src", (sg_image){0}, &src, false);
+    const int p1 = add_pass("blur0-h", src.img, &x, false);
+    const int p2 = add_pass("blur0-v", x.img, &y, false);
+    const int p3 = add_pass("blur1-h", y.img, &x, false);
+    const int p4 = add_pass("blur1-v", x.img, &y, false);
+    const int p5 = add_pass("blur2-h", y.img, &x, false);
+    T(srg_compile());
+    srg_execute();
+    T(num_executed == 7);
+    T(executed[0] == p0);
+    T(executed[1] == p1);
+    T(executed[2] == p2);
+    T(executed[3] == p3);
+    T(executed[4] == p4);
+    T(executed[5] == p5);
+    T(executed[6] == pd);
+    T(exec_order_ok);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, load_action_keeps_previous_writer) {
+    init(&(srg_desc_t){0});
+    target_t a = make_target();
+    srg_begin();
+    const int p0 = add_pass("clear", (sg_image){0}, &a, false);
+    const int p1 = add_pass("overwrite", (sg_image){0}, &a, true);
+    srg_execute();
+    // the second pass doesn't load the previous content, so the first pass is culled
+    T(srg_query_pass_culled(p0));
+    T(!srg_query_pass_culled(p1));
+    T(num_executed == 1);
+
+    num_executed = 0;
+    srg_begin();
+    const int p2 = add_pass("clear", (sg_image){0}, &a, false);
+    const int p3 = add_pass("load", a.img, &a, true);
+    srg_execute();
+    T(!srg_query_pass_culled(p2));
+    T(!srg_query_pass_culled(p3));
+    T(num_executed == 2);
+    T(executed[0] == p2);
+    T(executed[1] == p3);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, cycle_detected) {
+    init(&(srg_desc_t){0});
+    target_t a = make_target();
+    target_t b = make_target();
+    srg_begin();
+    add_pass("a", b.img, &a, true);
+    add_pass("b", a.img, &b, false);
+    T(!srg_compile());
+    T(num_log_called == 1);
+    T(log_items[0] == SRG_LOGITEM_CYCLE_DETECTED);
+    srg_execute();
+    T(num_executed == 0);
+    T(srg_query_stats().num_executed_passes == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, pass_hooks) {
+    init(&(srg_desc_t){
+        .hooks = {
+            .begin_pass = begin_pass_hook,
+            .end_pass = end_pass_hook,
+            .user_data = &num_begin_hooks,
+        }
+    });
+    target_t a = make_target();
+    target_t b = make_target();
+    target_t c = make_target();
+    srg_begin();
+    add_pass("a", (sg_image){0}, &a, false);
+    add_pass("b", a.img, &b, false);
+    add_pass("unused", a.img, &c, false);
+    add_pass("c", b.img, &c, true);
+    srg_execute();
+    T(num_executed == 3);
+    T(num_begin_hooks == 3);
+    T(num_end_hooks == 3);
+    T(hook_order_ok);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, pass_pool_exhausted) {
+    init(&(srg_desc_t){ .max_passes = 2 });
+    target_t a = make_target();
+    srg_begin();
+    T(add_pass("0", (sg_image){0}, &a, false) == 0);
+    T(add_pass("1", (sg_image){0}, &a, false) == 1);
+    T(add_pass("2", (sg_image){0}, &a, false) == -1);
+    T(num_log_called == 1);
+    T(log_items[0] == SRG_LOGITEM_PASS_POOL_EXHAUSTED);
+    T(srg_query_stats().num_passes == 0);
+    T(srg_compile());
+    T(srg_query_stats().num_passes == 2);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, resource_pool_exhausted) {
+    init(&(srg_desc_t){ .max_resources = 2 });
+    target_t a = make_target();
+    target_t b = make_target();
+    target_t c = make_target();
+    srg_begin();
+    T(add_pass("0", a.img, &b, false) == 0);
+    T(add_pass("1", a.img, &c, false) == -1);
+    T(num_log_called == 1);
+    T(log_items[0] == SRG_LOGITEM_RESOURCE_POOL_EXHAUSTED);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, no_exec_callback) {
+    init(&(srg_desc_t){0});
+    srg_begin();
+    T(srg_add_pass(&(srg_pass_desc_t){ .label = "no-cb" }) == -1);
+    T(num_log_called == 1);
+    T(log_items[0] == SRG_LOGITEM_NO_EXEC_CALLBACK);
+    shutdown();
+}
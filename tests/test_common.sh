@@ -46,5 +46,9 @@ runtest() {
     cfg=$1
     cd build/$cfg
     ./sokol-test
+    ./sokol-gfx-threads-test
+    if [ -f ./sokol-gfx-gl-test ] ; then
+        ./sokol-gfx-gl-test
+    fi
     cd ../../..
 }
@@ -8,4 +8,5 @@ cmake --build --preset win_d3d11_release || exit /b 10
 
 cd build\win_d3d11\Debug
 sokol-test.exe || exit /b 10
+sokol-gfx-threads-test.exe || exit /b 10
 cd ..\..\..
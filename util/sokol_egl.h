@@ -0,0 +1,924 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_EGL_IMPL)
+#define SOKOL_EGL_IMPL
+#endif
+#ifndef SOKOL_EGL_INCLUDED
+/*
+    sokol_egl.h -- headless offscreen GL rendering for sokol_gfx.h via EGL
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_EGL_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Include the following headers before including sokol_egl.h:
+
+        sokol_gfx.h
+
+    The implementation must be compiled with the same GL backend define
+    as sokol_gfx.h:
+
+        SOKOL_GLCORE
+        SOKOL_GLES3
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_EGL_API_DECL  - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_EGL_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_egl.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_EGL_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Link with the following libraries:
+
+        - on Linux with SOKOL_GLCORE: EGL GL
+        - on Linux with SOKOL_GLES3: EGL GLESv2
+
+    FEATURE OVERVIEW
+    ================
+    sokol_egl.h is a replacement for sokol_app.h + sokol_glue.h in programs
+    which render with sokol_gfx.h on machines without a display (for
+    instance batch renderers, render farm jobs or GL tests running in
+    containers).
+
+    It creates an EGL display and GL context without a window system
+    and a default offscreen 'swapchain', and provides the sg_environment
+    and sg_swapchain structs to use with sokol_gfx.h. This works with
+    GPU drivers exposing EGL devices and with Mesa's software rasterizers
+    (llvmpipe) alike.
+
+    Two kinds of swapchain are supported:
+
+        - by default, the GL context is made current without a surface
+          (this requires the EGL_KHR_surfaceless_context extension), and
+          the swapchain is a GL framebuffer object with a color- and
+          depth-stencil renderbuffer, this is the recommended setup
+        - optionally the swapchain is an EGL pbuffer surface, this works
+          with older EGL implementations which don't support surfaceless
+          contexts (NOTE: some Mesa versions ignore glClearBufferfv() on
+          pbuffer surfaces, which breaks the clear action of sokol-gfx
+          swapchain passes, so only use this as a fallback)
+
+    STEP-BY-STEP
+    ============
+    --- call segl_setup() before sg_setup():
+
+            segl_setup(&(segl_desc_t){
+                .width = 1920,
+                .height = 1080,
+            });
+
+        ...and check if this has been successful:
+
+            if (!segl_isvalid()) {
+                // ...
+            }
+
+    --- use segl_environment() in sg_setup():
+
+            sg_setup(&(sg_desc){
+                .environment = segl_environment(),
+                .logger.func = slog_func,
+            });
+
+    --- render frames with segl_swapchain() in the swapchain pass:
+
+            sg_begin_pass(&(sg_pass){ .action = ..., .swapchain = segl_swapchain() });
+            ...
+            sg_end_pass();
+            sg_commit();
+
+    --- to get the rendered pixels, call segl_read_pixels() after
+        sg_commit(). The pixel data is RGBA8 with rows stored top-to-bottom,
+        so the destination buffer must be at least width * height * 4 bytes:
+
+            static uint8_t pixels[1920 * 1080 * 4];
+            segl_read_pixels(&SG_RANGE(pixels));
+
+        segl_read_pixels() stalls until rendering has finished, if that's a
+        problem, render into sokol-gfx render target images instead and read
+        them back with sg_read_image_async().
+
+    --- call segl_shutdown() after sg_shutdown():
+
+            segl_shutdown();
+
+    CHOOSING THE EGL DISPLAY
+    ========================
+    The EGL display is selected via segl_desc_t.platform:
+
+        SEGL_PLATFORM_DEFAULT:
+            try SEGL_PLATFORM_DEVICE first, then SEGL_PLATFORM_SURFACELESS,
+            and finally SEGL_PLATFORM_NATIVE
+        SEGL_PLATFORM_DEVICE:
+            enumerate the EGL devices (EGL_EXT_device_enumeration and
+            EGL_EXT_platform_device) and use the device at index
+            segl_desc_t.device_index, use this to pick a specific GPU
+            on machines with more than one GPU
+        SEGL_PLATFORM_SURFACELESS:
+            use Mesa's surfaceless platform (EGL_MESA_platform_surfaceless)
+        SEGL_PLATFORM_NATIVE:
+            use eglGetDisplay(EGL_DEFAULT_DISPLAY), with Mesa the platform
+            can then be selected with the EGL_PLATFORM environment variable
+
+    To force software rendering with Mesa, run with the environment
+    variable LIBGL_ALWAYS_SOFTWARE=1.
+
+    Call segl_query_info() after segl_setup() to inspect the chosen platform,
+    the EGL vendor string, and the GL renderer string.
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        segl_setup(&(segl_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    To override logging with your own callback, first write a logging function like this:
+
+        void my_log(const char* tag,                // e.g. 'segl'
+                    uint32_t log_level,             // 0=panic, 1=error, 2=warn, 3=info
+                    uint32_t log_item_id,           // SEGL_LOGITEM_*
+                    const char* message_or_null,    // a message string, may be nullptr in release mode
+                    uint32_t line_nr,               // line number in sokol_egl.h
+                    const char* filename_or_null,   // source filename, may be nullptr in release mode
+                    void* user_data)
+        {
+            ...
+        }
+
+    ...and then setup sokol-egl like this:
+
+        segl_setup(&(segl_desc_t){
+            .logger = {
+                .func = my_log,
+                .user_data = my_user_data,
+            }
+        });
+
+    The provided logging function must be reentrant (e.g. be callable from
+    different threads).
+
+    If you don't want to provide your own custom logger it is highly recommended to use
+    the standard logger in sokol_log.h instead, otherwise you won't see any warnings or
+    errors.
+
+    THREADING
+    =========
+    The GL context is made current on the thread which calls segl_setup(),
+    all sokol_gfx.h and sokol_egl.h calls must happen on that thread.
+
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2024 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_EGL_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_egl.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_EGL_API_DECL)
+#define SOKOL_EGL_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_EGL_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_EGL_IMPL)
+#define SOKOL_EGL_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_EGL_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_EGL_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    segl_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'segl_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SEGL_LOG_ITEMS \
+    _SEGL_LOGITEM_XMACRO(OK, "Ok") \
+    _SEGL_LOGITEM_XMACRO(EGL_NO_DEVICE, "no EGL device found at segl_desc_t.device_index (or EGL device enumeration not supported)") \
+    _SEGL_LOGITEM_XMACRO(EGL_NO_SURFACELESS_PLATFORM, "EGL_MESA_platform_surfaceless not supported") \
+    _SEGL_LOGITEM_XMACRO(EGL_NO_DISPLAY, "failed to obtain an EGL display") \
+    _SEGL_LOGITEM_XMACRO(EGL_INITIALIZE_FAILED, "eglInitialize() failed") \
+    _SEGL_LOGITEM_XMACRO(EGL_BIND_API_FAILED, "eglBindAPI() failed") \
+    _SEGL_LOGITEM_XMACRO(EGL_NO_CONFIG, "eglChooseConfig() found no matching config") \
+    _SEGL_LOGITEM_XMACRO(EGL_CREATE_CONTEXT_FAILED, "eglCreateContext() failed (unsupported GL version?)") \
+    _SEGL_LOGITEM_XMACRO(EGL_CREATE_PBUFFER_FAILED, "eglCreatePbufferSurface() failed") \
+    _SEGL_LOGITEM_XMACRO(EGL_NO_SURFACELESS_CONTEXT, "EGL_KHR_surfaceless_context not supported (try segl_desc_t.pbuffer = true)") \
+    _SEGL_LOGITEM_XMACRO(EGL_MAKE_CURRENT_FAILED, "eglMakeCurrent() failed") \
+    _SEGL_LOGITEM_XMACRO(GL_FRAMEBUFFER_INCOMPLETE, "offscreen swapchain framebuffer is incomplete (unsupported sample count?)") \
+    _SEGL_LOGITEM_XMACRO(READ_PIXELS_NOT_VALID, "segl_read_pixels() called without a valid EGL context") \
+    _SEGL_LOGITEM_XMACRO(READ_PIXELS_BUFFER_TOO_SMALL, "segl_read_pixels(): destination buffer must be at least width * height * 4 bytes") \
+
+#define _SEGL_LOGITEM_XMACRO(item,msg) SEGL_LOGITEM_##item,
+typedef enum segl_log_item_t {
+    _SEGL_LOG_ITEMS
+} segl_log_item_t;
+#undef _SEGL_LOGITEM_XMACRO
+
+/*
+    segl_logger_t
+
+    Used in segl_desc_t to provide a custom logging and error reporting
+    callback to sokol-egl.
+*/
+typedef struct segl_logger_t {
+    void (*func)(
+        const char* tag,                // always "segl"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SEGL_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_egl.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} segl_logger_t;
+
+/*
+    segl_platform_t
+
+    Selects how the EGL display is obtained, see the section
+    'CHOOSING THE EGL DISPLAY' in the documentation header.
+*/
+typedef enum segl_platform_t {
+    SEGL_PLATFORM_DEFAULT,
+    SEGL_PLATFORM_DEVICE,
+    SEGL_PLATFORM_SURFACELESS,
+    SEGL_PLATFORM_NATIVE,
+} segl_platform_t;
+
+typedef struct segl_desc_t {
+    int width;                  // width of the offscreen swapchain (default: 640)
+    int height;                 // height of the offscreen swapchain (default: 480)
+    int sample_count;           // MSAA sample count of the offscreen swapchain (default: 1)
+    bool no_depth_buffer;       // if true, the swapchain has no depth-stencil buffer
+    bool pbuffer;               // if true, render into an EGL pbuffer surface instead of a GL framebuffer object
+    segl_platform_t platform;   // how to obtain the EGL display (default: SEGL_PLATFORM_DEFAULT)
+    int device_index;           // device index for SEGL_PLATFORM_DEVICE (default: 0)
+    int gl_major_version;       // override the GL version (default: 4.3 with SOKOL_GLCORE, 3.0 with SOKOL_GLES3)
+    int gl_minor_version;
+    segl_logger_t logger;       // optional log function override (default: NO LOGGING)
+} segl_desc_t;
+
+/*
+    segl_info_t
+
+    Returned by segl_query_info(), describes the EGL display and GL context
+    created in segl_setup().
+*/
+typedef struct segl_info_t {
+    segl_platform_t platform;   // the EGL platform that was actually used
+    int egl_major_version;
+    int egl_minor_version;
+    const char* egl_vendor;     // EGL_VENDOR string
+    const char* gl_renderer;    // GL_RENDERER string
+    const char* gl_version;     // GL_VERSION string
+} segl_info_t;
+
+/* setup and shutdown */
+SOKOL_EGL_API_DECL void segl_setup(const segl_desc_t* desc);
+SOKOL_EGL_API_DECL void segl_shutdown(void);
+SOKOL_EGL_API_DECL bool segl_isvalid(void);
+
+/* sokol-gfx glue */
+SOKOL_EGL_API_DECL sg_environment segl_environment(void);
+SOKOL_EGL_API_DECL sg_swapchain segl_swapchain(void);
+
+/* swapchain and context properties */
+SOKOL_EGL_API_DECL int segl_width(void);
+SOKOL_EGL_API_DECL int segl_height(void);
+SOKOL_EGL_API_DECL segl_info_t segl_query_info(void);
+
+/* read the content of the offscreen swapchain as RGBA8 pixels, rows top-to-bottom */
+SOKOL_EGL_API_DECL bool segl_read_pixels(const sg_range* dst);
+
+/* EGL handles (EGLDisplay, EGLContext and EGLSurface) */
+SOKOL_EGL_API_DECL const void* segl_egl_display(void);
+SOKOL_EGL_API_DECL const void* segl_egl_context(void);
+SOKOL_EGL_API_DECL const void* segl_egl_surface(void);
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for c++
+inline void segl_setup(const segl_desc_t& desc) { return segl_setup(&desc); }
+inline bool segl_read_pixels(const sg_range& dst) { return segl_read_pixels(&dst); }
+
+#endif
+#endif // SOKOL_EGL_INCLUDED
+
+//  ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+//  ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+//  ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+//  ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+//  ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_EGL_IMPL
+#define SOKOL_EGL_IMPL_INCLUDED (1)
+
+#if !defined(SOKOL_GLCORE) && !defined(SOKOL_GLES3)
+#error "sokol_egl.h requires SOKOL_GLCORE or SOKOL_GLES3"
+#endif
+#if defined(_WIN32) || defined(__APPLE__) || defined(__EMSCRIPTEN__)
+#error "sokol_egl.h is not supported on this platform"
+#endif
+
+#include <stdlib.h> // abort
+#include <string.h> // memset, strstr
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#if defined(SOKOL_GLCORE)
+    #if !defined(GL_GLEXT_PROTOTYPES)
+        #define GL_GLEXT_PROTOTYPES
+    #endif
+    #include <GL/gl.h>
+#else
+    #include <GLES3/gl3.h>
+#endif
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#ifndef EGL_PLATFORM_DEVICE_EXT
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#endif
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+#define _segl_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SEGL_INIT_COOKIE (0xABCDABCD)
+#define _SEGL_DEFAULT_WIDTH (640)
+#define _SEGL_DEFAULT_HEIGHT (480)
+#define _SEGL_MAX_DEVICES (16)
+
+// ███████ ████████ ██████  ██    ██  ██████ ████████ ███████
+// ██         ██    ██   ██ ██    ██ ██         ██    ██
+// ███████    ██    ██████  ██    ██ ██         ██    ███████
+//      ██    ██    ██   ██ ██    ██ ██         ██         ██
+// ███████    ██    ██   ██  ██████   ██████    ██    ███████
+//
+// >>structs
+typedef struct {
+    uint32_t init_cookie;
+    segl_desc_t desc;
+    bool valid;
+    segl_platform_t platform;
+    EGLint egl_major_version;
+    EGLint egl_minor_version;
+    EGLDisplay display;
+    EGLConfig config;
+    EGLContext context;
+    EGLSurface surface;
+    GLuint fb;              // the swapchain framebuffer (zero with a pbuffer surface)
+    GLuint color_rb;
+    GLuint depth_rb;
+    GLuint resolve_fb;      // only with MSAA framebuffer, resolve target for segl_read_pixels()
+    GLuint resolve_rb;
+    PFNEGLQUERYDEVICESEXTPROC QueryDevicesEXT;
+    PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplayEXT;
+} _segl_t;
+static _segl_t _segl;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SEGL_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _segl_log_messages[] = {
+    _SEGL_LOG_ITEMS
+};
+#undef _SEGL_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SEGL_PANIC(code) _segl_log(SEGL_LOGITEM_ ##code, 0, __LINE__)
+#define _SEGL_ERROR(code) _segl_log(SEGL_LOGITEM_ ##code, 1, __LINE__)
+#define _SEGL_WARN(code) _segl_log(SEGL_LOGITEM_ ##code, 2, __LINE__)
+#define _SEGL_INFO(code) _segl_log(SEGL_LOGITEM_ ##code, 3, __LINE__)
+
+static void _segl_log(segl_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_segl.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _segl_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _segl.desc.logger.func("segl", log_level, log_item, message, line_nr, filename, _segl.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███████  ██████  ██
+// ██      ██       ██
+// █████   ██   ███ ██
+// ██      ██    ██ ██
+// ███████  ██████  ███████
+//
+// >>egl
+static segl_desc_t _segl_desc_defaults(const segl_desc_t* desc) {
+    segl_desc_t res = *desc;
+    res.width = _segl_def(desc->width, _SEGL_DEFAULT_WIDTH);
+    res.height = _segl_def(desc->height, _SEGL_DEFAULT_HEIGHT);
+    res.sample_count = _segl_def(desc->sample_count, 1);
+    if (0 == res.gl_major_version) {
+        #if defined(SOKOL_GLCORE)
+            res.gl_major_version = 4;
+            res.gl_minor_version = 3;
+        #else
+            res.gl_major_version = 3;
+            res.gl_minor_version = 0;
+        #endif
+    }
+    return res;
+}
+
+// checks for a complete extension name in a space-separated extension string
+static bool _segl_has_extension(const char* extensions, const char* name) {
+    if (0 == extensions) {
+        return false;
+    }
+    const size_t len = strlen(name);
+    const char* ptr = extensions;
+    while ((ptr = strstr(ptr, name)) != 0) {
+        if (((ptr == extensions) || (ptr[-1] == ' ')) && ((ptr[len] == ' ') || (ptr[len] == 0))) {
+            return true;
+        }
+        ptr += len;
+    }
+    return false;
+}
+
+static EGLDisplay _segl_device_display(void) {
+    if (!(_segl.QueryDevicesEXT && _segl.GetPlatformDisplayEXT)) {
+        return EGL_NO_DISPLAY;
+    }
+    EGLDeviceEXT devices[_SEGL_MAX_DEVICES];
+    EGLint num_devices = 0;
+    if (!_segl.QueryDevicesEXT(_SEGL_MAX_DEVICES, devices, &num_devices)) {
+        return EGL_NO_DISPLAY;
+    }
+    if ((_segl.desc.device_index < 0) || (_segl.desc.device_index >= num_devices)) {
+        return EGL_NO_DISPLAY;
+    }
+    return _segl.GetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[_segl.desc.device_index], 0);
+}
+
+static EGLDisplay _segl_surfaceless_display(const char* client_extensions) {
+    if (!(_segl.GetPlatformDisplayEXT && _segl_has_extension(client_extensions, "EGL_MESA_platform_surfaceless"))) {
+        return EGL_NO_DISPLAY;
+    }
+    return _segl.GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0);
+}
+
+static bool _segl_try_platform(segl_platform_t platform, const char* client_extensions) {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    switch (platform) {
+        case SEGL_PLATFORM_DEVICE:
+            display = _segl_device_display();
+            break;
+        case SEGL_PLATFORM_SURFACELESS:
+            display = _segl_surfaceless_display(client_extensions);
+            break;
+        default:
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            break;
+    }
+    if (EGL_NO_DISPLAY == display) {
+        return false;
+    }
+    if (!eglInitialize(display, &_segl.egl_major_version, &_segl.egl_minor_version)) {
+        return false;
+    }
+    _segl.display = display;
+    _segl.platform = platform;
+    return true;
+}
+
+static bool _segl_create_display(void) {
+    // client extensions are only available with EGL 1.5 or EGL_EXT_client_extensions
+    const char* client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (_segl_has_extension(client_extensions, "EGL_EXT_device_enumeration") || _segl_has_extension(client_extensions, "EGL_EXT_device_base")) {
+        _segl.QueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC) eglGetProcAddress("eglQueryDevicesEXT");
+    }
+    if (_segl_has_extension(client_extensions, "EGL_EXT_platform_base")) {
+        _segl.GetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    }
+    if (!_segl_has_extension(client_extensions, "EGL_EXT_platform_device")) {
+        _segl.QueryDevicesEXT = 0;
+    }
+    switch (_segl.desc.platform) {
+        case SEGL_PLATFORM_DEVICE:
+            if (!_segl_try_platform(SEGL_PLATFORM_DEVICE, client_extensions)) {
+                _SEGL_ERROR(EGL_NO_DEVICE);
+                return false;
+            }
+            return true;
+        case SEGL_PLATFORM_SURFACELESS:
+            if (!_segl_try_platform(SEGL_PLATFORM_SURFACELESS, client_extensions)) {
+                _SEGL_ERROR(EGL_NO_SURFACELESS_PLATFORM);
+                return false;
+            }
+            return true;
+        case SEGL_PLATFORM_NATIVE:
+            if (!_segl_try_platform(SEGL_PLATFORM_NATIVE, client_extensions)) {
+                _SEGL_ERROR(EGL_INITIALIZE_FAILED);
+                return false;
+            }
+            return true;
+        default:
+            if (_segl_try_platform(SEGL_PLATFORM_DEVICE, client_extensions)
+                || _segl_try_platform(SEGL_PLATFORM_SURFACELESS, client_extensions)
+                || _segl_try_platform(SEGL_PLATFORM_NATIVE, client_extensions))
+            {
+                return true;
+            }
+            _SEGL_ERROR(EGL_NO_DISPLAY);
+            return false;
+    }
+}
+
+static bool _segl_create_context(void) {
+    #if defined(SOKOL_GLCORE)
+        const EGLenum api = EGL_OPENGL_API;
+        const EGLint renderable_type = EGL_OPENGL_BIT;
+    #else
+        const EGLenum api = EGL_OPENGL_ES_API;
+        const EGLint renderable_type = EGL_OPENGL_ES3_BIT;
+    #endif
+    if (!eglBindAPI(api)) {
+        _SEGL_ERROR(EGL_BIND_API_FAILED);
+        return false;
+    }
+
+    // the config only defines the pixel format for pbuffer surfaces,
+    // for surfaceless contexts any config with the right API will do
+    EGLint config_attrs[32];
+    int i = 0;
+    config_attrs[i++] = EGL_RENDERABLE_TYPE; config_attrs[i++] = renderable_type;
+    if (_segl.desc.pbuffer) {
+        config_attrs[i++] = EGL_SURFACE_TYPE; config_attrs[i++] = EGL_PBUFFER_BIT;
+        config_attrs[i++] = EGL_RED_SIZE; config_attrs[i++] = 8;
+        config_attrs[i++] = EGL_GREEN_SIZE; config_attrs[i++] = 8;
+        config_attrs[i++] = EGL_BLUE_SIZE; config_attrs[i++] = 8;
+        config_attrs[i++] = EGL_ALPHA_SIZE; config_attrs[i++] = 8;
+        if (!_segl.desc.no_depth_buffer) {
+            config_attrs[i++] = EGL_DEPTH_SIZE; config_attrs[i++] = 24;
+            config_attrs[i++] = EGL_STENCIL_SIZE; config_attrs[i++] = 8;
+        }
+        if (_segl.desc.sample_count > 1) {
+            config_attrs[i++] = EGL_SAMPLE_BUFFERS; config_attrs[i++] = 1;
+            config_attrs[i++] = EGL_SAMPLES; config_attrs[i++] = _segl.desc.sample_count;
+        }
+    } else {
+        config_attrs[i++] = EGL_SURFACE_TYPE; config_attrs[i++] = 0;
+    }
+    config_attrs[i++] = EGL_NONE;
+    SOKOL_ASSERT(i <= 32);
+    EGLint num_configs = 0;
+    if (!eglChooseConfig(_segl.display, config_attrs, &_segl.config, 1, &num_configs) || (num_configs < 1)) {
+        _SEGL_ERROR(EGL_NO_CONFIG);
+        return false;
+    }
+
+    EGLint ctx_attrs[16];
+    i = 0;
+    ctx_attrs[i++] = EGL_CONTEXT_MAJOR_VERSION; ctx_attrs[i++] = _segl.desc.gl_major_version;
+    ctx_attrs[i++] = EGL_CONTEXT_MINOR_VERSION; ctx_attrs[i++] = _segl.desc.gl_minor_version;
+    #if defined(SOKOL_GLCORE)
+        ctx_attrs[i++] = EGL_CONTEXT_OPENGL_PROFILE_MASK; ctx_attrs[i++] = EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT;
+    #endif
+    ctx_attrs[i++] = EGL_NONE;
+    _segl.context = eglCreateContext(_segl.display, _segl.config, EGL_NO_CONTEXT, ctx_attrs);
+    if (EGL_NO_CONTEXT == _segl.context) {
+        _SEGL_ERROR(EGL_CREATE_CONTEXT_FAILED);
+        return false;
+    }
+
+    if (_segl.desc.pbuffer) {
+        const EGLint pbuffer_attrs[] = {
+            EGL_WIDTH, _segl.desc.width,
+            EGL_HEIGHT, _segl.desc.height,
+            EGL_NONE,
+        };
+        _segl.surface = eglCreatePbufferSurface(_segl.display, _segl.config, pbuffer_attrs);
+        if (EGL_NO_SURFACE == _segl.surface) {
+            _SEGL_ERROR(EGL_CREATE_PBUFFER_FAILED);
+            return false;
+        }
+    } else {
+        _segl.surface = EGL_NO_SURFACE;
+        if (!_segl_has_extension(eglQueryString(_segl.display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context")) {
+            _SEGL_ERROR(EGL_NO_SURFACELESS_CONTEXT);
+            return false;
+        }
+    }
+    if (!eglMakeCurrent(_segl.display, _segl.surface, _segl.surface, _segl.context)) {
+        _SEGL_ERROR(EGL_MAKE_CURRENT_FAILED);
+        return false;
+    }
+    return true;
+}
+
+static GLuint _segl_create_renderbuffer(GLenum format, int sample_count) {
+    GLuint rb = 0;
+    glGenRenderbuffers(1, &rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, rb);
+    if (sample_count > 1) {
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, sample_count, format, _segl.desc.width, _segl.desc.height);
+    } else {
+        glRenderbufferStorage(GL_RENDERBUFFER, format, _segl.desc.width, _segl.desc.height);
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    return rb;
+}
+
+static bool _segl_create_framebuffer(void) {
+    const int sample_count = _segl.desc.sample_count;
+    _segl.color_rb = _segl_create_renderbuffer(GL_RGBA8, sample_count);
+    if (!_segl.desc.no_depth_buffer) {
+        _segl.depth_rb = _segl_create_renderbuffer(GL_DEPTH24_STENCIL8, sample_count);
+    }
+    glGenFramebuffers(1, &_segl.fb);
+    glBindFramebuffer(GL_FRAMEBUFFER, _segl.fb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _segl.color_rb);
+    if (_segl.depth_rb) {
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _segl.depth_rb);
+    }
+    bool complete = (GL_FRAMEBUFFER_COMPLETE == glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    if (complete && (sample_count > 1)) {
+        // MSAA renderbuffers can't be read directly, segl_read_pixels() resolves into this first
+        _segl.resolve_rb = _segl_create_renderbuffer(GL_RGBA8, 1);
+        glGenFramebuffers(1, &_segl.resolve_fb);
+        glBindFramebuffer(GL_FRAMEBUFFER, _segl.resolve_fb);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _segl.resolve_rb);
+        complete = (GL_FRAMEBUFFER_COMPLETE == glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        _SEGL_ERROR(GL_FRAMEBUFFER_INCOMPLETE);
+        return false;
+    }
+    return true;
+}
+
+static void _segl_discard(void) {
+    if (EGL_NO_DISPLAY == _segl.display) {
+        return;
+    }
+    if ((EGL_NO_CONTEXT != _segl.context) && (eglGetCurrentContext() == _segl.context)) {
+        if (_segl.resolve_fb) { glDeleteFramebuffers(1, &_segl.resolve_fb); }
+        if (_segl.resolve_rb) { glDeleteRenderbuffers(1, &_segl.resolve_rb); }
+        if (_segl.fb) { glDeleteFramebuffers(1, &_segl.fb); }
+        if (_segl.depth_rb) { glDeleteRenderbuffers(1, &_segl.depth_rb); }
+        if (_segl.color_rb) { glDeleteRenderbuffers(1, &_segl.color_rb); }
+    }
+    eglMakeCurrent(_segl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (EGL_NO_SURFACE != _segl.surface) {
+        eglDestroySurface(_segl.display, _segl.surface);
+    }
+    if (EGL_NO_CONTEXT != _segl.context) {
+        eglDestroyContext(_segl.display, _segl.context);
+    }
+    eglTerminate(_segl.display);
+    _segl.display = EGL_NO_DISPLAY;
+    _segl.context = EGL_NO_CONTEXT;
+    _segl.surface = EGL_NO_SURFACE;
+}
+
+// flip rows in place, GL returns the bottom row first
+static void _segl_flip_rows(uint8_t* pixels, size_t pitch, int height) {
+    uint8_t tmp[256];
+    for (int y = 0; y < (height / 2); y++) {
+        uint8_t* row0 = pixels + (size_t)y * pitch;
+        uint8_t* row1 = pixels + (size_t)(height - 1 - y) * pitch;
+        for (size_t offset = 0; offset < pitch; offset += sizeof(tmp)) {
+            const size_t num_bytes = ((pitch - offset) < sizeof(tmp)) ? (pitch - offset) : sizeof(tmp);
+            memcpy(tmp, row0 + offset, num_bytes);
+            memcpy(row0 + offset, row1 + offset, num_bytes);
+            memcpy(row1 + offset, tmp, num_bytes);
+        }
+    }
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+SOKOL_API_IMPL void segl_setup(const segl_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    memset(&_segl, 0, sizeof(_segl));
+    _segl.init_cookie = _SEGL_INIT_COOKIE;
+    _segl.desc = _segl_desc_defaults(desc);
+    _segl.display = EGL_NO_DISPLAY;
+    _segl.context = EGL_NO_CONTEXT;
+    _segl.surface = EGL_NO_SURFACE;
+    if (!(_segl_create_display() && _segl_create_context())) {
+        _segl_discard();
+        return;
+    }
+    if (!_segl.desc.pbuffer && !_segl_create_framebuffer()) {
+        _segl_discard();
+        return;
+    }
+    _segl.valid = true;
+}
+
+SOKOL_API_IMPL void segl_shutdown(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    _segl_discard();
+    _segl.valid = false;
+    _segl.init_cookie = 0;
+}
+
+SOKOL_API_IMPL bool segl_isvalid(void) {
+    return (_SEGL_INIT_COOKIE == _segl.init_cookie) && _segl.valid;
+}
+
+SOKOL_API_IMPL sg_environment segl_environment(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    sg_environment env;
+    memset(&env, 0, sizeof(env));
+    env.defaults.color_format = SG_PIXELFORMAT_RGBA8;
+    env.defaults.depth_format = _segl.desc.no_depth_buffer ? SG_PIXELFORMAT_NONE : SG_PIXELFORMAT_DEPTH_STENCIL;
+    env.defaults.sample_count = _segl.desc.sample_count;
+    return env;
+}
+
+SOKOL_API_IMPL sg_swapchain segl_swapchain(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    sg_swapchain swapchain;
+    memset(&swapchain, 0, sizeof(swapchain));
+    swapchain.width = _segl.desc.width;
+    swapchain.height = _segl.desc.height;
+    swapchain.sample_count = _segl.desc.sample_count;
+    swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+    swapchain.depth_format = _segl.desc.no_depth_buffer ? SG_PIXELFORMAT_NONE : SG_PIXELFORMAT_DEPTH_STENCIL;
+    swapchain.gl.framebuffer = _segl.fb;
+    return swapchain;
+}
+
+SOKOL_API_IMPL int segl_width(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    return _segl.desc.width;
+}
+
+SOKOL_API_IMPL int segl_height(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    return _segl.desc.height;
+}
+
+SOKOL_API_IMPL segl_info_t segl_query_info(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    segl_info_t info;
+    memset(&info, 0, sizeof(info));
+    if (_segl.valid) {
+        info.platform = _segl.platform;
+        info.egl_major_version = _segl.egl_major_version;
+        info.egl_minor_version = _segl.egl_minor_version;
+        info.egl_vendor = eglQueryString(_segl.display, EGL_VENDOR);
+        info.gl_renderer = (const char*) glGetString(GL_RENDERER);
+        info.gl_version = (const char*) glGetString(GL_VERSION);
+    }
+    return info;
+}
+
+SOKOL_API_IMPL bool segl_read_pixels(const sg_range* dst) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    SOKOL_ASSERT(dst);
+    if (!_segl.valid) {
+        _SEGL_ERROR(READ_PIXELS_NOT_VALID);
+        return false;
+    }
+    const int width = _segl.desc.width;
+    const int height = _segl.desc.height;
+    const size_t pitch = (size_t)width * 4;
+    if ((0 == dst->ptr) || (dst->size < (pitch * (size_t)height))) {
+        _SEGL_ERROR(READ_PIXELS_BUFFER_TOO_SMALL);
+        return false;
+    }
+    // preserve the GL state that's touched here, sokol-gfx caches some of it
+    GLint read_fb = 0, draw_fb = 0, read_buffer = 0, pack_buffer = 0, pack_alignment = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_fb);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_fb);
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack_buffer);
+    glGetIntegerv(GL_PACK_ALIGNMENT, &pack_alignment);
+    GLuint src_fb = _segl.fb;
+    if (_segl.resolve_fb) {
+        const GLboolean scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, _segl.fb);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _segl.resolve_fb);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        if (scissor_test) {
+            glEnable(GL_SCISSOR_TEST);
+        }
+        src_fb = _segl.resolve_fb;
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, src_fb);
+    if (0 == src_fb) {
+        // the read buffer of a pbuffer surface may default to GL_FRONT, but rendering goes into GL_BACK
+        glGetIntegerv(GL_READ_BUFFER, &read_buffer);
+        glReadBuffer(GL_BACK);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)dst->ptr);
+    glPixelStorei(GL_PACK_ALIGNMENT, pack_alignment);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)pack_buffer);
+    if (0 == src_fb) {
+        glReadBuffer((GLenum)read_buffer);
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)read_fb);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, (GLuint)draw_fb);
+    _segl_flip_rows((uint8_t*)dst->ptr, pitch, height);
+    return true;
+}
+
+SOKOL_API_IMPL const void* segl_egl_display(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    return (const void*) _segl.display;
+}
+
+SOKOL_API_IMPL const void* segl_egl_context(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    return (const void*) _segl.context;
+}
+
+SOKOL_API_IMPL const void* segl_egl_surface(void) {
+    SOKOL_ASSERT(_SEGL_INIT_COOKIE == _segl.init_cookie);
+    return (const void*) _segl.surface;
+}
+
+#endif // SOKOL_EGL_IMPL
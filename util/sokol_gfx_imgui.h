@@ -280,6 +280,9 @@ typedef struct sgimgui_shader_t {
     sgimgui_str_t fs_d3d11_target;
     sgimgui_str_t fs_image_sampler_name[SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS];
     sgimgui_str_t fs_uniform_name[SG_MAX_SHADERSTAGE_UBS][SG_MAX_UB_MEMBERS];
+    sgimgui_str_t cs_entry;
+    sgimgui_str_t cs_image_sampler_name[SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS];
+    sgimgui_str_t cs_uniform_name[SG_MAX_SHADERSTAGE_UBS][SG_MAX_UB_MEMBERS];
     sgimgui_str_t attr_name[SG_MAX_VERTEX_ATTRIBUTES];
     sgimgui_str_t attr_sem_name[SG_MAX_VERTEX_ATTRIBUTES];
     sg_shader_desc desc;
@@ -358,8 +361,12 @@ typedef enum sgimgui_cmd_t {
     SGIMGUI_CMD_DESTROY_PIPELINE,
     SGIMGUI_CMD_DESTROY_ATTACHMENTS,
     SGIMGUI_CMD_UPDATE_BUFFER,
+    SGIMGUI_CMD_UPDATE_BUFFER_RANGE,
     SGIMGUI_CMD_UPDATE_IMAGE,
+    SGIMGUI_CMD_UPDATE_IMAGE_MIP,
     SGIMGUI_CMD_APPEND_BUFFER,
+    SGIMGUI_CMD_COPY_BUFFER,
+    SGIMGUI_CMD_COPY_IMAGE_REGION,
     SGIMGUI_CMD_BEGIN_PASS,
     SGIMGUI_CMD_APPLY_VIEWPORT,
     SGIMGUI_CMD_APPLY_SCISSOR_RECT,
@@ -367,6 +374,7 @@ typedef enum sgimgui_cmd_t {
     SGIMGUI_CMD_APPLY_BINDINGS,
     SGIMGUI_CMD_APPLY_UNIFORMS,
     SGIMGUI_CMD_DRAW,
+    SGIMGUI_CMD_DISPATCH,
     SGIMGUI_CMD_END_PASS,
     SGIMGUI_CMD_COMMIT,
     SGIMGUI_CMD_ALLOC_BUFFER,
@@ -456,16 +464,39 @@ typedef struct sgimgui_args_update_buffer_t {
     size_t data_size;
 } sgimgui_args_update_buffer_t;
 
+typedef struct sgimgui_args_update_buffer_range_t {
+    sg_buffer buffer;
+    size_t offset;
+    size_t data_size;
+} sgimgui_args_update_buffer_range_t;
+
 typedef struct sgimgui_args_update_image_t {
     sg_image image;
 } sgimgui_args_update_image_t;
 
+typedef struct sgimgui_args_update_image_mip_t {
+    sg_image image;
+    int mip_level;
+} sgimgui_args_update_image_mip_t;
+
 typedef struct sgimgui_args_append_buffer_t {
     sg_buffer buffer;
     size_t data_size;
     int result;
 } sgimgui_args_append_buffer_t;
 
+typedef struct sgimgui_args_copy_buffer_t {
+    sg_buffer dst;
+    size_t dst_offset;
+    sg_buffer src;
+    size_t src_offset;
+    size_t size;
+} sgimgui_args_copy_buffer_t;
+
+typedef struct sgimgui_args_copy_image_region_t {
+    sg_image_copy_desc desc;
+} sgimgui_args_copy_image_region_t;
+
 typedef struct sgimgui_args_begin_pass_t {
     sg_pass pass;
 } sgimgui_args_begin_pass_t;
@@ -502,6 +533,12 @@ typedef struct sgimgui_args_draw_t {
     int num_instances;
 } sgimgui_args_draw_t;
 
+typedef struct sgimgui_args_dispatch_t {
+    int num_groups_x;
+    int num_groups_y;
+    int num_groups_z;
+} sgimgui_args_dispatch_t;
+
 typedef struct sgimgui_args_alloc_buffer_t {
     sg_buffer result;
 } sgimgui_args_alloc_buffer_t;
@@ -640,8 +677,12 @@ typedef union sgimgui_args_t {
     sgimgui_args_destroy_pipeline_t destroy_pipeline;
     sgimgui_args_destroy_attachments_t destroy_attachments;
     sgimgui_args_update_buffer_t update_buffer;
+    sgimgui_args_update_buffer_range_t update_buffer_range;
     sgimgui_args_update_image_t update_image;
+    sgimgui_args_update_image_mip_t update_image_mip;
     sgimgui_args_append_buffer_t append_buffer;
+    sgimgui_args_copy_buffer_t copy_buffer;
+    sgimgui_args_copy_image_region_t copy_image_region;
     sgimgui_args_begin_pass_t begin_pass;
     sgimgui_args_apply_viewport_t apply_viewport;
     sgimgui_args_apply_scissor_rect_t apply_scissor_rect;
@@ -649,6 +690,7 @@ typedef union sgimgui_args_t {
     sgimgui_args_apply_bindings_t apply_bindings;
     sgimgui_args_apply_uniforms_t apply_uniforms;
     sgimgui_args_draw_t draw;
+    sgimgui_args_dispatch_t dispatch;
     sgimgui_args_alloc_buffer_t alloc_buffer;
     sgimgui_args_alloc_image_t alloc_image;
     sgimgui_args_alloc_sampler_t alloc_sampler;
@@ -1138,6 +1180,16 @@ _SOKOL_PRIVATE void _sgimgui_draw_resource_slot(const sg_slot_info* slot) {
     igText("State: %s", _sgimgui_resourcestate_string(slot->state));
 }
 
+// usage counters are only non-zero with SOKOL_TRACK_RESOURCE_USAGE
+_SOKOL_PRIVATE void _sgimgui_draw_resource_usage(const sg_resource_usage* usage) {
+    if ((usage->num_binds_total > 0) || (usage->num_updated_bytes > 0)) {
+        igSeparator();
+        igText("Last Used Frame: %d", usage->last_used_frame_index);
+        igText("Binds (cur/prev/total): %d/%d/%d", usage->num_binds, usage->num_binds_prev_frame, usage->num_binds_total);
+        igText("Updated Bytes: %d", (int)usage->num_updated_bytes);
+    }
+}
+
 _SOKOL_PRIVATE const char* _sgimgui_backend_string(sg_backend b) {
     switch (b) {
         case SG_BACKEND_GLCORE:             return "SG_BACKEND_GLCORE";
@@ -1478,6 +1530,7 @@ _SOKOL_PRIVATE const char* _sgimgui_shaderstage_string(sg_shader_stage stage) {
     switch (stage) {
         case SG_SHADERSTAGE_VS:     return "SG_SHADERSTAGE_VS";
         case SG_SHADERSTAGE_FS:     return "SG_SHADERSTAGE_FS";
+        case SG_SHADERSTAGE_CS:     return "SG_SHADERSTAGE_CS";
         default:                    return "???";
     }
 }
@@ -1620,6 +1673,10 @@ _SOKOL_PRIVATE void _sgimgui_shader_created(sgimgui_t* ctx, sg_shader res_id, in
         shd->fs_entry = _sgimgui_make_str(shd->desc.fs.entry);
         shd->desc.fs.entry = shd->fs_entry.buf;
     }
+    if (shd->desc.cs.entry) {
+        shd->cs_entry = _sgimgui_make_str(shd->desc.cs.entry);
+        shd->desc.cs.entry = shd->cs_entry.buf;
+    }
     if (shd->desc.vs.d3d11_target) {
         shd->vs_d3d11_target = _sgimgui_make_str(shd->desc.vs.d3d11_target);
         shd->desc.fs.d3d11_target = shd->vs_d3d11_target.buf;
@@ -1646,6 +1703,15 @@ _SOKOL_PRIVATE void _sgimgui_shader_created(sgimgui_t* ctx, sg_shader res_id, in
             }
         }
     }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_UBS; i++) {
+        for (int j = 0; j < SG_MAX_UB_MEMBERS; j++) {
+            sg_shader_uniform_desc* ud = &shd->desc.cs.uniform_blocks[i].uniforms[j];
+            if (ud->name) {
+                shd->cs_uniform_name[i][j] = _sgimgui_make_str(ud->name);
+                ud->name = shd->cs_uniform_name[i][j].buf;
+            }
+        }
+    }
     for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS; i++) {
         if (shd->desc.vs.image_sampler_pairs[i].glsl_name) {
             shd->vs_image_sampler_name[i] = _sgimgui_make_str(shd->desc.vs.image_sampler_pairs[i].glsl_name);
@@ -1658,6 +1724,12 @@ _SOKOL_PRIVATE void _sgimgui_shader_created(sgimgui_t* ctx, sg_shader res_id, in
             shd->desc.fs.image_sampler_pairs[i].glsl_name = shd->fs_image_sampler_name[i].buf;
         }
     }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGESAMPLERPAIRS; i++) {
+        if (shd->desc.cs.image_sampler_pairs[i].glsl_name) {
+            shd->cs_image_sampler_name[i] = _sgimgui_make_str(shd->desc.cs.image_sampler_pairs[i].glsl_name);
+            shd->desc.cs.image_sampler_pairs[i].glsl_name = shd->cs_image_sampler_name[i].buf;
+        }
+    }
     if (shd->desc.vs.source) {
         shd->desc.vs.source = _sgimgui_str_dup(&ctx->desc.allocator, shd->desc.vs.source);
     }
@@ -1670,6 +1742,12 @@ _SOKOL_PRIVATE void _sgimgui_shader_created(sgimgui_t* ctx, sg_shader res_id, in
     if (shd->desc.fs.bytecode.ptr) {
         shd->desc.fs.bytecode.ptr = _sgimgui_bin_dup(&ctx->desc.allocator, shd->desc.fs.bytecode.ptr, shd->desc.fs.bytecode.size);
     }
+    if (shd->desc.cs.source) {
+        shd->desc.cs.source = _sgimgui_str_dup(&ctx->desc.allocator, shd->desc.cs.source);
+    }
+    if (shd->desc.cs.bytecode.ptr) {
+        shd->desc.cs.bytecode.ptr = _sgimgui_bin_dup(&ctx->desc.allocator, shd->desc.cs.bytecode.ptr, shd->desc.cs.bytecode.size);
+    }
     for (int i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
         sg_shader_attr_desc* ad = &shd->desc.attrs[i];
         if (ad->name) {
@@ -1703,6 +1781,14 @@ _SOKOL_PRIVATE void _sgimgui_shader_destroyed(sgimgui_t* ctx, int slot_index) {
         _sgimgui_free(&ctx->desc.allocator, (void*)shd->desc.fs.bytecode.ptr);
         shd->desc.fs.bytecode.ptr = 0;
     }
+    if (shd->desc.cs.source) {
+        _sgimgui_free(&ctx->desc.allocator, (void*)shd->desc.cs.source);
+        shd->desc.cs.source = 0;
+    }
+    if (shd->desc.cs.bytecode.ptr) {
+        _sgimgui_free(&ctx->desc.allocator, (void*)shd->desc.cs.bytecode.ptr);
+        shd->desc.cs.bytecode.ptr = 0;
+    }
 }
 
 _SOKOL_PRIVATE void _sgimgui_pipeline_created(sgimgui_t* ctx, sg_pipeline res_id, int slot_index, const sg_pipeline_desc* desc) {
@@ -1916,6 +2002,16 @@ _SOKOL_PRIVATE sgimgui_str_t _sgimgui_capture_item_string(sgimgui_t* ctx, int in
             }
             break;
 
+        case SGIMGUI_CMD_UPDATE_BUFFER_RANGE:
+            {
+                sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.update_buffer_range.buffer);
+                _sgimgui_snprintf(&str, "%d: sg_update_buffer_range(buf=%s, offset=%d, data.size=%d)",
+                    index, res_id.buf,
+                    (int)item->args.update_buffer_range.offset,
+                    (int)item->args.update_buffer_range.data_size);
+            }
+            break;
+
         case SGIMGUI_CMD_UPDATE_IMAGE:
             {
                 sgimgui_str_t res_id = _sgimgui_image_id_string(ctx, item->args.update_image.image);
@@ -1923,6 +2019,13 @@ _SOKOL_PRIVATE sgimgui_str_t _sgimgui_capture_item_string(sgimgui_t* ctx, int in
             }
             break;
 
+        case SGIMGUI_CMD_UPDATE_IMAGE_MIP:
+            {
+                sgimgui_str_t res_id = _sgimgui_image_id_string(ctx, item->args.update_image_mip.image);
+                _sgimgui_snprintf(&str, "%d: sg_update_image_mip(img=%s, mip_level=%d, data=..)", index, res_id.buf, item->args.update_image_mip.mip_level);
+            }
+            break;
+
         case SGIMGUI_CMD_APPEND_BUFFER:
             {
                 sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.append_buffer.buffer);
@@ -1933,6 +2036,32 @@ _SOKOL_PRIVATE sgimgui_str_t _sgimgui_capture_item_string(sgimgui_t* ctx, int in
             }
             break;
 
+        case SGIMGUI_CMD_COPY_BUFFER:
+            {
+                sgimgui_str_t dst_id = _sgimgui_buffer_id_string(ctx, item->args.copy_buffer.dst);
+                sgimgui_str_t src_id = _sgimgui_buffer_id_string(ctx, item->args.copy_buffer.src);
+                _sgimgui_snprintf(&str, "%d: sg_copy_buffer(dst=%s, dst_offset=%d, src=%s, src_offset=%d, size=%d)",
+                    index, dst_id.buf,
+                    (int)item->args.copy_buffer.dst_offset,
+                    src_id.buf,
+                    (int)item->args.copy_buffer.src_offset,
+                    (int)item->args.copy_buffer.size);
+            }
+            break;
+
+        case SGIMGUI_CMD_COPY_IMAGE_REGION:
+            {
+                const sg_image_copy_desc* desc = &item->args.copy_image_region.desc;
+                sgimgui_str_t dst_id = _sgimgui_image_id_string(ctx, desc->dst.image);
+                sgimgui_str_t src_id = _sgimgui_image_id_string(ctx, desc->src.image);
+                _sgimgui_snprintf(&str, "%d: sg_copy_image_region(dst=%s, src=%s, width=%d, height=%d, num_slices=%d)",
+                    index, dst_id.buf, src_id.buf,
+                    desc->width,
+                    desc->height,
+                    desc->num_slices);
+            }
+            break;
+
         case SGIMGUI_CMD_BEGIN_PASS:
             {
                 _sgimgui_snprintf(&str, "%d: sg_begin_pass(pass=...)", index);
@@ -1986,6 +2115,14 @@ _SOKOL_PRIVATE sgimgui_str_t _sgimgui_capture_item_string(sgimgui_t* ctx, int in
                 item->args.draw.num_instances);
             break;
 
+        case SGIMGUI_CMD_DISPATCH:
+            _sgimgui_snprintf(&str, "%d: sg_dispatch(num_groups_x=%d, num_groups_y=%d, num_groups_z=%d)",
+                index,
+                item->args.dispatch.num_groups_x,
+                item->args.dispatch.num_groups_y,
+                item->args.dispatch.num_groups_z);
+            break;
+
         case SGIMGUI_CMD_END_PASS:
             _sgimgui_snprintf(&str, "%d: sg_end_pass()", index);
             break;
@@ -2453,6 +2590,22 @@ _SOKOL_PRIVATE void _sgimgui_update_buffer(sg_buffer buf, const sg_range* data,
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_update_buffer_range(sg_buffer buf, size_t offset, const sg_range* data, void* user_data) {
+    sgimgui_t* ctx = (sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SGIMGUI_CMD_UPDATE_BUFFER_RANGE;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.update_buffer_range.buffer = buf;
+        item->args.update_buffer_range.offset = offset;
+        item->args.update_buffer_range.data_size = data->size;
+    }
+    if (ctx->hooks.update_buffer_range) {
+        ctx->hooks.update_buffer_range(buf, offset, data, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_update_image(sg_image img, const sg_image_data* data, void* user_data) {
     sgimgui_t* ctx = (sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2467,6 +2620,21 @@ _SOKOL_PRIVATE void _sgimgui_update_image(sg_image img, const sg_image_data* dat
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_update_image_mip(sg_image img, int mip_level, const sg_image_data* data, void* user_data) {
+    sgimgui_t* ctx = (sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SGIMGUI_CMD_UPDATE_IMAGE_MIP;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.update_image_mip.image = img;
+        item->args.update_image_mip.mip_level = mip_level;
+    }
+    if (ctx->hooks.update_image_mip) {
+        ctx->hooks.update_image_mip(img, mip_level, data, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_append_buffer(sg_buffer buf, const sg_range* data, int result, void* user_data) {
     sgimgui_t* ctx = (sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2483,6 +2651,38 @@ _SOKOL_PRIVATE void _sgimgui_append_buffer(sg_buffer buf, const sg_range* data,
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_copy_buffer(sg_buffer dst, size_t dst_offset, sg_buffer src, size_t src_offset, size_t size, void* user_data) {
+    sgimgui_t* ctx = (sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SGIMGUI_CMD_COPY_BUFFER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.copy_buffer.dst = dst;
+        item->args.copy_buffer.dst_offset = dst_offset;
+        item->args.copy_buffer.src = src;
+        item->args.copy_buffer.src_offset = src_offset;
+        item->args.copy_buffer.size = size;
+    }
+    if (ctx->hooks.copy_buffer) {
+        ctx->hooks.copy_buffer(dst, dst_offset, src, src_offset, size, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgimgui_copy_image_region(const sg_image_copy_desc* desc, void* user_data) {
+    sgimgui_t* ctx = (sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SGIMGUI_CMD_COPY_IMAGE_REGION;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.copy_image_region.desc = *desc;
+    }
+    if (ctx->hooks.copy_image_region) {
+        ctx->hooks.copy_image_region(desc, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_begin_pass(const sg_pass* pass, void* user_data) {
     sgimgui_t* ctx = (sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2600,6 +2800,22 @@ _SOKOL_PRIVATE void _sgimgui_draw(int base_element, int num_elements, int num_in
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_dispatch(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data) {
+    sgimgui_t* ctx = (sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SGIMGUI_CMD_DISPATCH;
+        item->color = _SGIMGUI_COLOR_DRAW;
+        item->args.dispatch.num_groups_x = num_groups_x;
+        item->args.dispatch.num_groups_y = num_groups_y;
+        item->args.dispatch.num_groups_z = num_groups_z;
+    }
+    if (ctx->hooks.dispatch) {
+        ctx->hooks.dispatch(num_groups_x, num_groups_y, num_groups_z, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_end_pass(void* user_data) {
     sgimgui_t* ctx = (sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3359,6 +3575,7 @@ _SOKOL_PRIVATE void _sgimgui_draw_buffer_panel(sgimgui_t* ctx, sg_buffer buf) {
                 igText("Append Pos:         %d", info.append_pos);
                 igText("Append Overflow:    %s", _sgimgui_bool_string(info.append_overflow));
             }
+            _sgimgui_draw_resource_usage(&info.usage);
         } else {
             igText("Buffer 0x%08X not valid.", buf.id);
         }
@@ -3407,14 +3624,23 @@ _SOKOL_PRIVATE void _sgimgui_draw_image_panel(sgimgui_t* ctx, sg_image img) {
             igText("Height:         %d", desc->height);
             igText("Num Slices:     %d", desc->num_slices);
             igText("Num Mipmaps:    %d", desc->num_mipmaps);
+            if ((desc->num_resident_mipmaps > 0) && (desc->num_resident_mipmaps < desc->num_mipmaps)) {
+                igText("Base Mip Level: %d", info.base_mip_level);
+            }
             igText("Pixel Format:   %s", _sgimgui_pixelformat_string(desc->pixel_format));
             igText("Sample Count:   %d", desc->sample_count);
+            if (desc->evictable) {
+                igSeparator();
+                igText("Evict Priority: %d", desc->evict_priority);
+                igText("Use Frame Index: %d", info.use_frame_index);
+            }
             if (desc->usage != SG_USAGE_IMMUTABLE) {
                 igSeparator();
                 igText("Num Slots:     %d", info.num_slots);
                 igText("Active Slot:   %d", info.active_slot);
                 igText("Update Frame Index: %d", info.upd_frame_index);
             }
+            _sgimgui_draw_resource_usage(&info.usage);
         } else {
             igText("Image 0x%08X not valid.", img.id);
         }
@@ -3494,6 +3720,14 @@ _SOKOL_PRIVATE void _sgimgui_draw_shader_stage(const sg_shader_stage_desc* stage
             break;
         }
     }
+    int num_valid_storage_images = 0;
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEIMAGES; i++) {
+        if (stage->storage_images[i].used) {
+            num_valid_storage_images++;
+        } else {
+            break;
+        }
+    }
 
     if (num_valid_ubs > 0) {
         if (igTreeNode_Str("Uniform Blocks")) {
@@ -3558,6 +3792,18 @@ _SOKOL_PRIVATE void _sgimgui_draw_shader_stage(const sg_shader_stage_desc* stage
             igTreePop();
         }
     }
+    if (num_valid_storage_images > 0) {
+        if (igTreeNode_Str("Storage Images")) {
+            for (int i = 0; i < num_valid_storage_images; i++) {
+                const sg_shader_storage_image_desc* simg_desc = &stage->storage_images[i];
+                igText("slot: %d\n  image_type: %s\n  access_format: %s\n  readonly: %s\n", i,
+                    _sgimgui_imagetype_string(simg_desc->image_type),
+                    _sgimgui_pixelformat_string(simg_desc->access_format),
+                    simg_desc->readonly ? "true" : "false");
+            }
+            igTreePop();
+        }
+    }
     if (stage->entry) {
         igText("Entry: %s", stage->entry);
     }
@@ -3598,13 +3844,20 @@ _SOKOL_PRIVATE void _sgimgui_draw_shader_panel(sgimgui_t* ctx, sg_shader shd) {
                 }
                 igTreePop();
             }
-            if (igTreeNode_Str("Vertex Shader Stage")) {
-                _sgimgui_draw_shader_stage(&shd_ui->desc.vs);
-                igTreePop();
-            }
-            if (igTreeNode_Str("Fragment Shader Stage")) {
-                _sgimgui_draw_shader_stage(&shd_ui->desc.fs);
-                igTreePop();
+            if (shd_ui->desc.cs.source || shd_ui->desc.cs.bytecode.ptr) {
+                if (igTreeNode_Str("Compute Shader Stage")) {
+                    _sgimgui_draw_shader_stage(&shd_ui->desc.cs);
+                    igTreePop();
+                }
+            } else {
+                if (igTreeNode_Str("Vertex Shader Stage")) {
+                    _sgimgui_draw_shader_stage(&shd_ui->desc.vs);
+                    igTreePop();
+                }
+                if (igTreeNode_Str("Fragment Shader Stage")) {
+                    _sgimgui_draw_shader_stage(&shd_ui->desc.fs);
+                    igTreePop();
+                }
             }
         } else {
             igText("Shader 0x%08X not valid!", shd.id);
@@ -3882,6 +4135,50 @@ _SOKOL_PRIVATE void _sgimgui_draw_bindings_panel(sgimgui_t* ctx, const sg_bindin
             }
         }
     }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_IMAGES; i++) {
+        sg_image img = bnd->cs.images[i];
+        if (img.id != SG_INVALID_ID) {
+            igSeparator();
+            igText("Compute Stage Image Slot #%d:", i);
+            igText("  Image: "); igSameLine(0,-1);
+            if (_sgimgui_draw_image_link(ctx, img)) {
+                _sgimgui_show_image(ctx, img);
+            }
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_SAMPLERS; i++) {
+        sg_sampler smp = bnd->cs.samplers[i];
+        if (smp.id != SG_INVALID_ID) {
+            igSeparator();
+            igText("Compute Stage Sampler Slot #%d:", i);
+            igText("  Sampler: "); igSameLine(0,-1);
+            if (_sgimgui_draw_sampler_link(ctx, smp)) {
+                _sgimgui_show_sampler(ctx, smp);
+            }
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEBUFFERS; i++) {
+        sg_buffer buf = bnd->cs.storage_buffers[i];
+        if (buf.id != SG_INVALID_ID) {
+            igSeparator();
+            igText("Compute Stage Storage Buffer Slot #%d:", i);
+            igText("  Buffer: "); igSameLine(0,-1);
+            if (_sgimgui_draw_buffer_link(ctx, buf)) {
+                _sgimgui_show_buffer(ctx, buf);
+            }
+        }
+    }
+    for (int i = 0; i < SG_MAX_SHADERSTAGE_STORAGEIMAGES; i++) {
+        sg_image img = bnd->cs.storage_images[i];
+        if (img.id != SG_INVALID_ID) {
+            igSeparator();
+            igText("Compute Stage Storage Image Slot #%d:", i);
+            igText("  Image: "); igSameLine(0,-1);
+            if (_sgimgui_draw_image_link(ctx, img)) {
+                _sgimgui_show_image(ctx, img);
+            }
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sgimgui_draw_uniforms_panel(sgimgui_t* ctx, const sgimgui_args_apply_uniforms_t* args) {
@@ -3901,9 +4198,12 @@ _SOKOL_PRIVATE void _sgimgui_draw_uniforms_panel(sgimgui_t* ctx, const sgimgui_a
     }
     sgimgui_shader_t* shd_ui = &ctx->shader_window.slots[_sgimgui_slot_index(pip_ui->desc.shader.id)];
     SOKOL_ASSERT(shd_ui->res_id.id == pip_ui->desc.shader.id);
-    const sg_shader_uniform_block_desc* ub_desc = (args->stage == SG_SHADERSTAGE_VS) ?
-        &shd_ui->desc.vs.uniform_blocks[args->ub_index] :
-        &shd_ui->desc.fs.uniform_blocks[args->ub_index];
+    const sg_shader_uniform_block_desc* ub_desc;
+    switch (args->stage) {
+        case SG_SHADERSTAGE_VS: ub_desc = &shd_ui->desc.vs.uniform_blocks[args->ub_index]; break;
+        case SG_SHADERSTAGE_FS: ub_desc = &shd_ui->desc.fs.uniform_blocks[args->ub_index]; break;
+        default:                ub_desc = &shd_ui->desc.cs.uniform_blocks[args->ub_index]; break;
+    }
     SOKOL_ASSERT(args->data_size <= ub_desc->size);
     bool draw_dump = false;
     if (ub_desc->uniforms[0].type == SG_UNIFORMTYPE_INVALID) {
@@ -4140,12 +4440,24 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(sgimgui_t* ctx) {
         case SGIMGUI_CMD_UPDATE_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.update_buffer.buffer);
             break;
+        case SGIMGUI_CMD_UPDATE_BUFFER_RANGE:
+            _sgimgui_draw_buffer_panel(ctx, item->args.update_buffer_range.buffer);
+            break;
         case SGIMGUI_CMD_UPDATE_IMAGE:
             _sgimgui_draw_image_panel(ctx, item->args.update_image.image);
             break;
+        case SGIMGUI_CMD_UPDATE_IMAGE_MIP:
+            _sgimgui_draw_image_panel(ctx, item->args.update_image_mip.image);
+            break;
         case SGIMGUI_CMD_APPEND_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.update_buffer.buffer);
             break;
+        case SGIMGUI_CMD_COPY_BUFFER:
+            _sgimgui_draw_buffer_panel(ctx, item->args.copy_buffer.dst);
+            break;
+        case SGIMGUI_CMD_COPY_IMAGE_REGION:
+            _sgimgui_draw_image_panel(ctx, item->args.copy_image_region.desc.dst.image);
+            break;
         case SGIMGUI_CMD_BEGIN_PASS:
             _sgimgui_draw_passaction_panel(ctx, item->args.begin_pass.pass.attachments, &item->args.begin_pass.pass.action);
             igSeparator();
@@ -4168,6 +4480,7 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(sgimgui_t* ctx) {
             _sgimgui_draw_uniforms_panel(ctx, &item->args.apply_uniforms);
             break;
         case SGIMGUI_CMD_DRAW:
+        case SGIMGUI_CMD_DISPATCH:
         case SGIMGUI_CMD_END_PASS:
         case SGIMGUI_CMD_COMMIT:
             break;
@@ -4240,6 +4553,11 @@ _SOKOL_PRIVATE void _sgimgui_draw_caps_panel(void) {
     igText("    mrt_independent_blend_state: %s", _sgimgui_bool_string(f.mrt_independent_blend_state));
     igText("    mrt_independent_write_mask: %s", _sgimgui_bool_string(f.mrt_independent_write_mask));
     igText("    storage_buffer: %s", _sgimgui_bool_string(f.storage_buffer));
+    igText("    compute: %s", _sgimgui_bool_string(f.compute));
+    igText("    image_readback: %s", _sgimgui_bool_string(f.image_readback));
+    igText("    copy_buffer: %s", _sgimgui_bool_string(f.copy_buffer));
+    igText("    copy_image: %s", _sgimgui_bool_string(f.copy_image));
+    igText("    mip_streaming: %s", _sgimgui_bool_string(f.mip_streaming));
     sg_limits l = sg_query_limits();
     igText("\nLimits:\n");
     igText("    max_image_size_2d: %d", l.max_image_size_2d);
@@ -4280,6 +4598,39 @@ _SOKOL_PRIVATE void _sgimgui_frame_add_stats_row(const char* key, uint32_t value
 _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(sgimgui_t* ctx) {
     _SOKOL_UNUSED(ctx);
     igCheckbox("Ignore sokol_imgui.h", &ctx->frame_stats_window.disable_sokol_imgui_stats);
+    const sg_frame_pacing pacing = sg_query_frame_pacing();
+    if (pacing.max_frames_in_flight > 0) {
+        igText("Frames in flight: %d/%d, CPU wait: %.3f ms (%d waits)",
+            pacing.frames_in_flight,
+            pacing.max_frames_in_flight,
+            pacing.wait_ms,
+            (int)pacing.num_waits);
+    } else {
+        igText("Frame pacing off, CPU wait: %.3f ms (%d waits)",
+            pacing.wait_ms,
+            (int)pacing.num_waits);
+    }
+    if (!sg_query_desc().dedup_uniforms) {
+        igText("Uniform dedup off (num_skipped_apply_uniforms stays 0)");
+    }
+    const sg_residency_stats residency = sg_query_residency_stats();
+    if (residency.budget > 0) {
+        igText("Resident images: %d (%d/%d KB), evicted: %d, placeholder binds: %d",
+            residency.num_resident_images,
+            (int)(residency.resident_bytes / 1024),
+            (int)(residency.budget / 1024),
+            (int)residency.num_evicted,
+            (int)residency.num_placeholder_binds);
+    }
+    const sg_dedup_stats dedup = sg_query_dedup_stats();
+    if ((dedup.num_buffers > 0) || (dedup.num_images > 0)) {
+        igText("Deduplicated buffers: %d (%d hits), images: %d (%d hits), saved: %d KB",
+            dedup.num_buffers,
+            (int)dedup.num_buffer_hits,
+            dedup.num_images,
+            (int)dedup.num_image_hits,
+            (int)(dedup.saved_bytes / 1024));
+    }
     const sg_frame_stats* stats = &ctx->frame_stats_window.stats;
     const ImGuiTableFlags flags =
         ImGuiTableFlags_Resizable |
@@ -4299,13 +4650,32 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(sgimgui_t* ctx) {
         _sgimgui_frame_stats(num_apply_bindings);
         _sgimgui_frame_stats(num_apply_uniforms);
         _sgimgui_frame_stats(num_draw);
+        _sgimgui_frame_stats(num_dispatch);
         _sgimgui_frame_stats(num_update_buffer);
+        _sgimgui_frame_stats(num_update_buffer_range);
         _sgimgui_frame_stats(num_append_buffer);
         _sgimgui_frame_stats(num_update_image);
+        _sgimgui_frame_stats(num_update_image_mip);
+        _sgimgui_frame_stats(num_grow_buffer);
+        _sgimgui_frame_stats(num_read_image_async);
+        _sgimgui_frame_stats(num_copy_buffer);
+        _sgimgui_frame_stats(num_copy_image);
+        _sgimgui_frame_stats(num_prewarm);
+        _sgimgui_frame_stats(num_prewarm_hits);
+        _sgimgui_frame_stats(num_skipped_apply_uniforms);
+        _sgimgui_frame_stats(num_coalesced_draws);
         _sgimgui_frame_stats(size_apply_uniforms);
+        _sgimgui_frame_stats(size_skipped_apply_uniforms);
         _sgimgui_frame_stats(size_update_buffer);
+        _sgimgui_frame_stats(size_update_buffer_range);
+        _sgimgui_frame_stats(size_sync_buffer_range);
         _sgimgui_frame_stats(size_append_buffer);
         _sgimgui_frame_stats(size_update_image);
+        _sgimgui_frame_stats(size_update_image_mip);
+        _sgimgui_frame_stats(size_grow_buffer);
+        _sgimgui_frame_stats(size_read_image_async);
+        _sgimgui_frame_stats(size_copy_buffer);
+        _sgimgui_frame_stats(size_copy_image);
         switch (sg_query_backend()) {
             case SG_BACKEND_GLCORE:
             case SG_BACKEND_GLES3:
@@ -4320,6 +4690,19 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(sgimgui_t* ctx) {
                 _sgimgui_frame_stats(gl.num_enable_vertex_attrib_array);
                 _sgimgui_frame_stats(gl.num_disable_vertex_attrib_array);
                 _sgimgui_frame_stats(gl.num_uniform);
+                _sgimgui_frame_stats(gl.num_readback_fence_waits);
+                _sgimgui_frame_stats(gl.num_bind_vertex_array);
+                _sgimgui_frame_stats(gl.num_vao_cache_hits);
+                _sgimgui_frame_stats(gl.num_vao_cache_misses);
+                _sgimgui_frame_stats(gl.num_vao_cache_evictions);
+                _sgimgui_frame_stats(gl.num_multi_bind_textures);
+                _sgimgui_frame_stats(gl.num_multi_bind_samplers);
+                _sgimgui_frame_stats(gl.num_multi_bind_buffers);
+                _sgimgui_frame_stats(gl.num_staging_uploads);
+                _sgimgui_frame_stats(gl.num_staging_stalls);
+                _sgimgui_frame_stats(gl.size_staging);
+                _sgimgui_frame_stats(gl.num_bind_image_texture);
+                _sgimgui_frame_stats(gl.num_memory_barrier);
                 break;
             case SG_BACKEND_WGPU:
                 _sgimgui_frame_stats(wgpu.uniforms.num_set_bindgroup);
@@ -4428,8 +4811,12 @@ SOKOL_API_IMPL void sgimgui_init(sgimgui_t* ctx, const sgimgui_desc_t* desc) {
     hooks.destroy_pipeline = _sgimgui_destroy_pipeline;
     hooks.destroy_attachments = _sgimgui_destroy_attachments;
     hooks.update_buffer = _sgimgui_update_buffer;
+    hooks.update_buffer_range = _sgimgui_update_buffer_range;
     hooks.update_image = _sgimgui_update_image;
+    hooks.update_image_mip = _sgimgui_update_image_mip;
     hooks.append_buffer = _sgimgui_append_buffer;
+    hooks.copy_buffer = _sgimgui_copy_buffer;
+    hooks.copy_image_region = _sgimgui_copy_image_region;
     hooks.begin_pass = _sgimgui_begin_pass;
     hooks.apply_viewport = _sgimgui_apply_viewport;
     hooks.apply_scissor_rect = _sgimgui_apply_scissor_rect;
@@ -4437,6 +4824,7 @@ SOKOL_API_IMPL void sgimgui_init(sgimgui_t* ctx, const sgimgui_desc_t* desc) {
     hooks.apply_bindings = _sgimgui_apply_bindings;
     hooks.apply_uniforms = _sgimgui_apply_uniforms;
     hooks.draw = _sgimgui_draw;
+    hooks.dispatch = _sgimgui_dispatch;
     hooks.end_pass = _sgimgui_end_pass;
     hooks.commit = _sgimgui_commit;
     hooks.alloc_buffer = _sgimgui_alloc_buffer;
@@ -0,0 +1,1006 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_IMPL
+#endif
+#ifndef SOKOL_RENDERGRAPH_INCLUDED
+/*
+    sokol_rendergraph.h -- automatic pass ordering and culling for sokol_gfx.h
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_RENDERGRAPH_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Include the following headers before including sokol_rendergraph.h:
+
+        sokol_gfx.h
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_RENDERGRAPH_API_DECL  - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_RENDERGRAPH_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_rendergraph.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_RENDERGRAPH_API_DECL as
+    __declspec(dllexport) or __declspec(dllimport) as needed.
+
+    FEATURE OVERVIEW
+    ================
+    sokol_rendergraph.h takes care of the bookkeeping that comes with
+    frames made of many offscreen passes:
+
+        - passes declare the sokol-gfx images they read and write
+        - the passes are sorted so that each pass runs after the passes
+          producing its inputs, the declaration order doesn't need to
+          match the execution order
+        - passes which don't contribute (directly or indirectly) to an
+          output are culled and not executed at all
+        - each executed pass is wrapped in sg_begin_pass()/sg_end_pass(),
+          and a user callback records the actual sokol-gfx calls
+        - optional per-pass hooks are called before and after each pass,
+          which is the place to put CPU- or GPU-timing code
+
+    The render graph doesn't own or create any sokol-gfx resources, images
+    are only used as identifiers to derive dependencies between passes.
+
+    STEP-BY-STEP
+    ============
+    --- call srg_setup() after sg_setup():
+
+            srg_setup(&(srg_desc_t){0});
+
+        ...optionally with a bigger pass- or resource-capacity:
+
+            srg_setup(&(srg_desc_t){
+                .max_passes = ...,      // default: 128
+                .max_resources = ...,   // default: 256
+            });
+
+    --- each frame, start a new graph with srg_begin():
+
+            srg_begin();
+
+    --- add passes with srg_add_pass(), the order doesn't matter (mostly,
+        see below for the details):
+
+            srg_add_pass(&(srg_pass_desc_t){
+                .label = "bloom-blur-h",
+                .reads = { bright_img },
+                .writes = { blur_img },
+                .pass = {
+                    .action = ...,
+                    .attachments = blur_atts,
+                },
+                .exec_cb = draw_blur_h,
+                .user_data = ...,
+            });
+
+        The .pass item is handed to sg_begin_pass() as is, .reads and .writes
+        are zero-terminated lists of images. Images which are read by the
+        pass through texture bindings go into .reads, and images which are
+        render pass attachments go into .writes.
+
+        If a pass loads the previous content of an attachment (e.g. with
+        SG_LOADACTION_LOAD), list the image in both .reads and .writes,
+        otherwise the pass which produced the previous content might be
+        culled.
+
+        The exec callback is called between sg_begin_pass() and sg_end_pass()
+        and records the actual rendering work:
+
+            void draw_blur_h(const srg_pass_info_t* info) {
+                sg_apply_pipeline(...);
+                sg_apply_bindings(...);
+                sg_draw(...);
+            }
+
+    --- tell the graph which passes or images are the final result, every
+        pass which doesn't contribute to one of those will be culled.
+
+        A pass with side effects outside the graph (most importantly the
+        swapchain pass) is marked with the .output flag:
+
+            srg_add_pass(&(srg_pass_desc_t){
+                .label = "display",
+                .reads = { composite_img },
+                .pass = { .action = ..., .swapchain = sglue_swapchain() },
+                .exec_cb = draw_display,
+                .output = true,
+            });
+
+        ...and images which are consumed outside the graph (for instance
+        in an sg_pass that's not part of the graph) are marked with:
+
+            srg_mark_output(img);
+
+    --- finally call srg_execute() to sort, cull and run the passes:
+
+            srg_execute();
+            sg_commit();
+
+        srg_execute() calls srg_compile() if that hasn't been called yet,
+        call srg_compile() directly to separate the graph build cost from
+        the execution cost, or to check whether the graph is valid
+        (srg_compile() returns false when the graph contains a cycle).
+
+    --- call srg_shutdown() before sg_shutdown():
+
+            srg_shutdown();
+
+    DEPENDENCY RULES
+    ================
+    Dependencies between passes are derived per image:
+
+        - a pass which reads an image runs after the pass which wrote the
+          image last *before* the reading pass was declared
+        - if no pass wrote the image before the reading pass was declared,
+          the reading pass depends on the last pass in declaration order
+          writing the image (this allows declaring consumers before producers)
+        - multiple passes writing the same image run in declaration order
+        - a pass writing an image runs after the passes which read the
+          previous content of the image (this makes ping-pong rendering work)
+
+    Passes without dependencies between them run in declaration order.
+
+    Forward references can create cycles (pass A reads the result of
+    pass B, which reads the result of pass A), in this case srg_compile()
+    logs a CYCLE_DETECTED error and returns false, and srg_execute() does
+    nothing.
+
+    PER-PASS HOOKS
+    ==============
+    To measure the time spent in each pass, provide hook callbacks
+    in srg_setup(). The begin hook is called before sg_begin_pass(),
+    the end hook after sg_end_pass():
+
+        static void begin_pass(const srg_pass_info_t* info, void* user_data) {
+            pass_start[info->pass_index] = stm_now();
+        }
+
+        static void end_pass(const srg_pass_info_t* info, void* user_data) {
+            pass_time[info->pass_index] = stm_since(pass_start[info->pass_index]);
+        }
+
+        srg_setup(&(srg_desc_t){
+            .hooks = {
+                .begin_pass = begin_pass,
+                .end_pass = end_pass,
+                .user_data = ...,
+            },
+        });
+
+    The srg_pass_info_t struct contains the index of the pass in declaration
+    order (the value returned by srg_add_pass()), the position in execution
+    order, the pass label and the user data from srg_pass_desc_t.
+
+    INSPECTING THE GRAPH
+    ====================
+    Call srg_query_stats() after srg_compile() or srg_execute() to get the
+    number of declared, culled and executed passes, and the number of
+    distinct images in the graph.
+
+    Call srg_query_pass_culled(pass_index) to check whether a specific pass
+    was culled.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            srg_setup(&(srg_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    All memory is allocated in srg_setup(), building and executing a graph
+    doesn't allocate.
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        srg_setup(&(srg_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    To override logging with your own callback, first write a logging function like this:
+
+        void my_log(const char* tag,                // e.g. 'srg'
+                    uint32_t log_level,             // 0=panic, 1=error, 2=warn, 3=info
+                    uint32_t log_item_id,           // SRG_LOGITEM_*
+                    const char* message_or_null,    // a message string, may be nullptr in release mode
+                    uint32_t line_nr,               // line number in sokol_rendergraph.h
+                    const char* filename_or_null,   // source filename, may be nullptr in release mode
+                    void* user_data)
+        {
+            ...
+        }
+
+    ...and then setup sokol-rendergraph like this:
+
+        srg_setup(&(srg_desc_t){
+            .logger = {
+                .func = my_log,
+                .user_data = my_user_data,
+            }
+        });
+
+    The provided logging function must be reentrant (e.g. be callable from
+    different threads).
+
+    If you don't want to provide your own custom logger it is highly recommended to use
+    the standard logger in sokol_log.h instead, otherwise you won't see any warnings or
+    errors.
+
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2024 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_RENDERGRAPH_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_rendergraph.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_RENDERGRAPH_API_DECL)
+#define SOKOL_RENDERGRAPH_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_RENDERGRAPH_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_RENDERGRAPH_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    SRG_MAX_PASS_READS = 8,
+    SRG_MAX_PASS_WRITES = 8,
+};
+
+/*
+    srg_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'srg_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SRG_LOG_ITEMS \
+    _SRG_LOGITEM_XMACRO(OK, "Ok") \
+    _SRG_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SRG_LOGITEM_XMACRO(PASS_POOL_EXHAUSTED, "too many passes in graph (use srg_desc_t.max_passes to adjust)") \
+    _SRG_LOGITEM_XMACRO(RESOURCE_POOL_EXHAUSTED, "too many images in graph (use srg_desc_t.max_resources to adjust)") \
+    _SRG_LOGITEM_XMACRO(NO_EXEC_CALLBACK, "srg_pass_desc_t.exec_cb must be provided") \
+    _SRG_LOGITEM_XMACRO(CYCLE_DETECTED, "render graph contains a dependency cycle, graph will not be executed") \
+
+#define _SRG_LOGITEM_XMACRO(item,msg) SRG_LOGITEM_##item,
+typedef enum srg_log_item_t {
+    _SRG_LOG_ITEMS
+} srg_log_item_t;
+#undef _SRG_LOGITEM_XMACRO
+
+/*
+    srg_logger_t
+
+    Used in srg_desc_t to provide a custom logging and error reporting
+    callback to sokol-rendergraph.
+*/
+typedef struct srg_logger_t {
+    void (*func)(
+        const char* tag,                // always "srg"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SRG_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_rendergraph.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} srg_logger_t;
+
+/*
+    srg_allocator_t
+
+    Used in srg_desc_t to provide custom memory-alloc and -free functions
+    to sokol_rendergraph.h. If memory management should be overridden, both the
+    alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct srg_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} srg_allocator_t;
+
+/*
+    srg_pass_info_t
+
+    Passed into the pass exec callback and the per-pass hooks.
+*/
+typedef struct srg_pass_info_t {
+    int pass_index;         // index of the pass in declaration order
+    int exec_index;         // position of the pass in execution order
+    const char* label;      // the label from srg_pass_desc_t
+    void* user_data;        // the user_data from srg_pass_desc_t
+} srg_pass_info_t;
+
+/*
+    srg_pass_desc_t
+
+    Describes a render graph pass in srg_add_pass(). The .reads and
+    .writes arrays are zero-terminated (the first image with a zero id
+    ends the list).
+*/
+typedef struct srg_pass_desc_t {
+    const char* label;
+    sg_image reads[SRG_MAX_PASS_READS];     // images sampled by the pass
+    sg_image writes[SRG_MAX_PASS_WRITES];   // images rendered to by the pass
+    bool output;                            // true if the pass has side effects outside the graph (never culled)
+    sg_pass pass;                           // handed to sg_begin_pass() before calling exec_cb
+    void (*exec_cb)(const srg_pass_info_t* info);
+    void* user_data;
+} srg_pass_desc_t;
+
+/*
+    srg_hooks_t
+
+    Optional callbacks which are called before sg_begin_pass() and
+    after sg_end_pass() for each executed pass.
+*/
+typedef struct srg_hooks_t {
+    void (*begin_pass)(const srg_pass_info_t* info, void* user_data);
+    void (*end_pass)(const srg_pass_info_t* info, void* user_data);
+    void* user_data;
+} srg_hooks_t;
+
+/*
+    srg_stats_t
+
+    Returned by srg_query_stats(), describes the most recently
+    compiled graph.
+*/
+typedef struct srg_stats_t {
+    int num_passes;             // number of passes added since srg_begin()
+    int num_resources;          // number of distinct images in the graph
+    int num_culled_passes;      // number of passes culled in srg_compile()
+    int num_executed_passes;    // number of passes executed in srg_execute()
+} srg_stats_t;
+
+typedef struct srg_desc_t {
+    int max_passes;             // max number of passes per graph (default: 128)
+    int max_resources;          // max number of distinct images per graph (default: 256)
+    srg_hooks_t hooks;          // optional per-pass hooks
+    srg_allocator_t allocator;  // optional memory allocation overrides (default: malloc/free)
+    srg_logger_t logger;        // optional log function override (default: NO LOGGING)
+} srg_desc_t;
+
+/* setup and shutdown */
+SOKOL_RENDERGRAPH_API_DECL void srg_setup(const srg_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL void srg_shutdown(void);
+
+/* build a graph */
+SOKOL_RENDERGRAPH_API_DECL void srg_begin(void);
+SOKOL_RENDERGRAPH_API_DECL int srg_add_pass(const srg_pass_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL void srg_mark_output(sg_image img);
+
+/* sort and cull, and execute the graph */
+SOKOL_RENDERGRAPH_API_DECL bool srg_compile(void);
+SOKOL_RENDERGRAPH_API_DECL void srg_execute(void);
+
+/* inspect the most recently compiled graph */
+SOKOL_RENDERGRAPH_API_DECL srg_stats_t srg_query_stats(void);
+SOKOL_RENDERGRAPH_API_DECL bool srg_query_pass_culled(int pass_index);
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for c++
+inline void srg_setup(const srg_desc_t& desc) { return srg_setup(&desc); }
+inline int srg_add_pass(const srg_pass_desc_t& desc) { return srg_add_pass(&desc); }
+
+#endif
+#endif // SOKOL_RENDERGRAPH_INCLUDED
+
+//  ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+//  ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+//  ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+//  ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+//  ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_RENDERGRAPH_IMPL
+#define SOKOL_RENDERGRAPH_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
+#error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use srg_desc_t.allocator to override memory allocation functions"
+#endif
+
+#include <stdlib.h> // malloc/free
+#include <string.h> // memset
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _srg_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SRG_INIT_COOKIE (0xABCDABCD)
+#define _SRG_DEFAULT_MAX_PASSES (128)
+#define _SRG_DEFAULT_MAX_RESOURCES (256)
+
+// ███████ ████████ ██████  ██    ██  ██████ ████████ ███████
+// ██         ██    ██   ██ ██    ██ ██         ██    ██
+// ███████    ██    ██████  ██    ██ ██         ██    ███████
+//      ██    ██    ██   ██ ██    ██ ██         ██         ██
+// ███████    ██    ██   ██  ██████   ██████    ██    ███████
+//
+// >>structs
+
+// an image referenced by one or more passes
+typedef struct {
+    uint32_t img_id;
+    bool output;
+    int last_writer;        // last writing pass in declaration order
+    int cur_writer;         // most recent writer while walking the passes in declaration order
+    int first_reader;       // list of passes which read the content of cur_writer
+} _srg_resource_t;
+
+typedef struct {
+    srg_pass_desc_t desc;
+    int num_reads;
+    int num_writes;
+    int reads[SRG_MAX_PASS_READS];      // indices into _srg.resources
+    int writes[SRG_MAX_PASS_WRITES];
+    bool culled;
+    int first_edge;         // first outgoing edge in _srg.adj
+    int num_edges;
+    int num_deps;           // number of incoming edges not yet resolved during sorting
+} _srg_pass_t;
+
+// a dependency between two passes, if 'data' is false the
+// edge only enforces execution order and doesn't prevent culling
+typedef struct {
+    int from;
+    int to;
+    bool data;
+} _srg_edge_t;
+
+// a node in a per-resource reader list
+typedef struct {
+    int pass;
+    int next;
+} _srg_reader_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    srg_desc_t desc;
+    bool compiled;
+    bool valid;
+    int num_passes;
+    int num_resources;
+    int num_edges;
+    int num_readers;
+    int max_edges;
+    int max_readers;
+    int num_exec;
+    _srg_pass_t* passes;
+    _srg_resource_t* resources;
+    _srg_edge_t* edges;
+    _srg_edge_t* adj;       // edges sorted by source pass
+    _srg_reader_t* readers;
+    int* order;             // topologically sorted pass indices
+    int* exec;              // the sorted pass indices minus culled passes
+    srg_stats_t stats;
+} _srg_t;
+static _srg_t _srg;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SRG_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _srg_log_messages[] = {
+    _SRG_LOG_ITEMS
+};
+#undef _SRG_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SRG_PANIC(code) _srg_log(SRG_LOGITEM_ ##code, 0, __LINE__)
+#define _SRG_ERROR(code) _srg_log(SRG_LOGITEM_ ##code, 1, __LINE__)
+#define _SRG_WARN(code) _srg_log(SRG_LOGITEM_ ##code, 2, __LINE__)
+#define _SRG_INFO(code) _srg_log(SRG_LOGITEM_ ##code, 3, __LINE__)
+
+static void _srg_log(srg_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_srg.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _srg_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _srg.desc.logger.func("srg", log_level, log_item, message, line_nr, filename, _srg.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+static void _srg_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _srg_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_srg.desc.allocator.alloc_fn) {
+        ptr = _srg.desc.allocator.alloc_fn(size, _srg.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SRG_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _srg_malloc_clear(size_t size) {
+    void* ptr = _srg_malloc(size);
+    _srg_clear(ptr, size);
+    return ptr;
+}
+
+static void _srg_free(void* ptr) {
+    if (_srg.desc.allocator.free_fn) {
+        _srg.desc.allocator.free_fn(ptr, _srg.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+//  ██████  ██████   █████  ██████  ██   ██
+// ██       ██   ██ ██   ██ ██   ██ ██   ██
+// ██   ███ ██████  ███████ ██████  ███████
+// ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ██████  ██   ██ ██   ██ ██      ██   ██
+//
+// >>graph
+static srg_desc_t _srg_desc_defaults(const srg_desc_t* desc) {
+    srg_desc_t res = *desc;
+    res.max_passes = _srg_def(desc->max_passes, _SRG_DEFAULT_MAX_PASSES);
+    res.max_resources = _srg_def(desc->max_resources, _SRG_DEFAULT_MAX_RESOURCES);
+    return res;
+}
+
+static void _srg_setup_graph(void) {
+    const int max_passes = _srg.desc.max_passes;
+    const int max_resources = _srg.desc.max_resources;
+    SOKOL_ASSERT((max_passes > 0) && (max_resources > 0));
+    // each read creates at most one data edge and one write-after-read edge,
+    // and each write creates at most one write-after-write edge
+    _srg.max_readers = max_passes * SRG_MAX_PASS_READS;
+    _srg.max_edges = max_passes * (2 * SRG_MAX_PASS_READS + SRG_MAX_PASS_WRITES);
+    _srg.passes = (_srg_pass_t*) _srg_malloc_clear((size_t)max_passes * sizeof(_srg_pass_t));
+    _srg.resources = (_srg_resource_t*) _srg_malloc_clear((size_t)max_resources * sizeof(_srg_resource_t));
+    _srg.edges = (_srg_edge_t*) _srg_malloc_clear((size_t)_srg.max_edges * sizeof(_srg_edge_t));
+    _srg.adj = (_srg_edge_t*) _srg_malloc_clear((size_t)_srg.max_edges * sizeof(_srg_edge_t));
+    _srg.readers = (_srg_reader_t*) _srg_malloc_clear((size_t)_srg.max_readers * sizeof(_srg_reader_t));
+    _srg.order = (int*) _srg_malloc_clear((size_t)max_passes * sizeof(int));
+    _srg.exec = (int*) _srg_malloc_clear((size_t)max_passes * sizeof(int));
+}
+
+static void _srg_discard_graph(void) {
+    _srg_free(_srg.exec); _srg.exec = 0;
+    _srg_free(_srg.order); _srg.order = 0;
+    _srg_free(_srg.readers); _srg.readers = 0;
+    _srg_free(_srg.adj); _srg.adj = 0;
+    _srg_free(_srg.edges); _srg.edges = 0;
+    _srg_free(_srg.resources); _srg.resources = 0;
+    _srg_free(_srg.passes); _srg.passes = 0;
+}
+
+static void _srg_reset_graph(void) {
+    _srg.compiled = false;
+    _srg.valid = false;
+    _srg.num_passes = 0;
+    _srg.num_resources = 0;
+    _srg.num_edges = 0;
+    _srg.num_readers = 0;
+    _srg.num_exec = 0;
+    _srg_clear(&_srg.stats, sizeof(_srg.stats));
+}
+
+// returns index of resource, or -1 if the resource pool is exhausted
+static int _srg_lookup_resource(uint32_t img_id) {
+    SOKOL_ASSERT(img_id != SG_INVALID_ID);
+    for (int i = 0; i < _srg.num_resources; i++) {
+        if (_srg.resources[i].img_id == img_id) {
+            return i;
+        }
+    }
+    if (_srg.num_resources >= _srg.desc.max_resources) {
+        _SRG_ERROR(RESOURCE_POOL_EXHAUSTED);
+        return -1;
+    }
+    const int res_index = _srg.num_resources++;
+    _srg_resource_t* res = &_srg.resources[res_index];
+    _srg_clear(res, sizeof(_srg_resource_t));
+    res->img_id = img_id;
+    return res_index;
+}
+
+static void _srg_add_edge(int from, int to, bool data) {
+    SOKOL_ASSERT((from >= 0) && (from < _srg.num_passes));
+    SOKOL_ASSERT((to >= 0) && (to < _srg.num_passes));
+    if (from == to) {
+        return;
+    }
+    SOKOL_ASSERT(_srg.num_edges < _srg.max_edges);
+    _srg_edge_t* edge = &_srg.edges[_srg.num_edges++];
+    edge->from = from;
+    edge->to = to;
+    edge->data = data;
+}
+
+static void _srg_add_reader(_srg_resource_t* res, int pass_index) {
+    SOKOL_ASSERT(_srg.num_readers < _srg.max_readers);
+    const int reader_index = _srg.num_readers++;
+    _srg.readers[reader_index].pass = pass_index;
+    _srg.readers[reader_index].next = res->first_reader;
+    res->first_reader = reader_index;
+}
+
+static bool _srg_pass_reads(const _srg_pass_t* pass, int res_index) {
+    for (int i = 0; i < pass->num_reads; i++) {
+        if (pass->reads[i] == res_index) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _srg_pass_writes(const _srg_pass_t* pass, int res_index) {
+    for (int i = 0; i < pass->num_writes; i++) {
+        if (pass->writes[i] == res_index) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// derive the edges between passes by walking the passes in declaration order
+static void _srg_build_edges(void) {
+    for (int res_index = 0; res_index < _srg.num_resources; res_index++) {
+        _srg_resource_t* res = &_srg.resources[res_index];
+        res->last_writer = -1;
+        res->cur_writer = -1;
+        res->first_reader = -1;
+    }
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        const _srg_pass_t* pass = &_srg.passes[pass_index];
+        for (int i = 0; i < pass->num_writes; i++) {
+            _srg.resources[pass->writes[i]].last_writer = pass_index;
+        }
+    }
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        const _srg_pass_t* pass = &_srg.passes[pass_index];
+        for (int i = 0; i < pass->num_reads; i++) {
+            const int res_index = pass->reads[i];
+            _srg_resource_t* res = &_srg.resources[res_index];
+            if (res->cur_writer >= 0) {
+                _srg_add_edge(res->cur_writer, pass_index, true);
+                _srg_add_reader(res, pass_index);
+            } else if ((res->last_writer >= 0) && !_srg_pass_writes(pass, res_index)) {
+                // forward reference, reads the final content of the image
+                // (unless the pass is the first writer itself and loads the initial content)
+                _srg_add_edge(res->last_writer, pass_index, true);
+            }
+        }
+        for (int i = 0; i < pass->num_writes; i++) {
+            const int res_index = pass->writes[i];
+            _srg_resource_t* res = &_srg.resources[res_index];
+            if (res->cur_writer >= 0) {
+                // only a data dependency if the pass also reads the previous content
+                _srg_add_edge(res->cur_writer, pass_index, _srg_pass_reads(pass, res_index));
+            }
+            // write-after-read: passes reading the previous content must run first
+            for (int r = res->first_reader; r >= 0; r = _srg.readers[r].next) {
+                _srg_add_edge(_srg.readers[r].pass, pass_index, false);
+            }
+            res->cur_writer = pass_index;
+            res->first_reader = -1;
+        }
+    }
+}
+
+// sort the edges by source pass into the adjacency array
+static void _srg_build_adjacency(void) {
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        _srg_pass_t* pass = &_srg.passes[pass_index];
+        pass->num_edges = 0;
+        pass->num_deps = 0;
+    }
+    for (int i = 0; i < _srg.num_edges; i++) {
+        const _srg_edge_t* edge = &_srg.edges[i];
+        _srg.passes[edge->from].num_edges++;
+        _srg.passes[edge->to].num_deps++;
+    }
+    int first_edge = 0;
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        _srg_pass_t* pass = &_srg.passes[pass_index];
+        pass->first_edge = first_edge;
+        first_edge += pass->num_edges;
+        pass->num_edges = 0;
+    }
+    for (int i = 0; i < _srg.num_edges; i++) {
+        const _srg_edge_t* edge = &_srg.edges[i];
+        _srg_pass_t* pass = &_srg.passes[edge->from];
+        _srg.adj[pass->first_edge + pass->num_edges++] = *edge;
+    }
+}
+
+// topological sort (Kahn's algorithm), returns false if the graph contains a cycle
+static bool _srg_sort(void) {
+    int num_sorted = 0;
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        if (_srg.passes[pass_index].num_deps == 0) {
+            _srg.order[num_sorted++] = pass_index;
+        }
+    }
+    // the order array doubles as the queue of passes with resolved dependencies
+    for (int i = 0; i < num_sorted; i++) {
+        const _srg_pass_t* pass = &_srg.passes[_srg.order[i]];
+        for (int e = 0; e < pass->num_edges; e++) {
+            _srg_pass_t* dst = &_srg.passes[_srg.adj[pass->first_edge + e].to];
+            SOKOL_ASSERT(dst->num_deps > 0);
+            if (--dst->num_deps == 0) {
+                _srg.order[num_sorted++] = (int)(dst - _srg.passes);
+            }
+        }
+    }
+    return num_sorted == _srg.num_passes;
+}
+
+// walk the sorted passes back to front, a pass is kept if it is an output,
+// writes an output image, or if a kept pass depends on its data
+static void _srg_cull(void) {
+    for (int i = _srg.num_passes - 1; i >= 0; i--) {
+        _srg_pass_t* pass = &_srg.passes[_srg.order[i]];
+        bool keep = pass->desc.output;
+        for (int w = 0; !keep && (w < pass->num_writes); w++) {
+            keep = _srg.resources[pass->writes[w]].output;
+        }
+        for (int e = 0; !keep && (e < pass->num_edges); e++) {
+            const _srg_edge_t* edge = &_srg.adj[pass->first_edge + e];
+            keep = edge->data && !_srg.passes[edge->to].culled;
+        }
+        pass->culled = !keep;
+    }
+    _srg.num_exec = 0;
+    for (int i = 0; i < _srg.num_passes; i++) {
+        const int pass_index = _srg.order[i];
+        if (!_srg.passes[pass_index].culled) {
+            _srg.exec[_srg.num_exec++] = pass_index;
+        }
+    }
+}
+
+static void _srg_execute_pass(int pass_index, int exec_index) {
+    _srg_pass_t* pass = &_srg.passes[pass_index];
+    srg_pass_info_t info;
+    _srg_clear(&info, sizeof(info));
+    info.pass_index = pass_index;
+    info.exec_index = exec_index;
+    info.label = pass->desc.label;
+    info.user_data = pass->desc.user_data;
+    if (_srg.desc.hooks.begin_pass) {
+        _srg.desc.hooks.begin_pass(&info, _srg.desc.hooks.user_data);
+    }
+    sg_begin_pass(&pass->desc.pass);
+    pass->desc.exec_cb(&info);
+    sg_end_pass();
+    if (_srg.desc.hooks.end_pass) {
+        _srg.desc.hooks.end_pass(&info, _srg.desc.hooks.user_data);
+    }
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+SOKOL_API_IMPL void srg_setup(const srg_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    _srg_clear(&_srg, sizeof(_srg));
+    _srg.init_cookie = _SRG_INIT_COOKIE;
+    _srg.desc = _srg_desc_defaults(desc);
+    _srg_setup_graph();
+}
+
+SOKOL_API_IMPL void srg_shutdown(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    _srg_discard_graph();
+    _srg.init_cookie = 0;
+}
+
+SOKOL_API_IMPL void srg_begin(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    _srg_reset_graph();
+}
+
+SOKOL_API_IMPL int srg_add_pass(const srg_pass_desc_t* desc) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(desc);
+    if (0 == desc->exec_cb) {
+        _SRG_ERROR(NO_EXEC_CALLBACK);
+        return -1;
+    }
+    if (_srg.num_passes >= _srg.desc.max_passes) {
+        _SRG_ERROR(PASS_POOL_EXHAUSTED);
+        return -1;
+    }
+    const int pass_index = _srg.num_passes;
+    _srg_pass_t* pass = &_srg.passes[pass_index];
+    _srg_clear(pass, sizeof(_srg_pass_t));
+    pass->desc = *desc;
+    for (int i = 0; (i < SRG_MAX_PASS_READS) && (desc->reads[i].id != SG_INVALID_ID); i++) {
+        const int res_index = _srg_lookup_resource(desc->reads[i].id);
+        if (res_index < 0) {
+            return -1;
+        }
+        pass->reads[pass->num_reads++] = res_index;
+    }
+    for (int i = 0; (i < SRG_MAX_PASS_WRITES) && (desc->writes[i].id != SG_INVALID_ID); i++) {
+        const int res_index = _srg_lookup_resource(desc->writes[i].id);
+        if (res_index < 0) {
+            return -1;
+        }
+        pass->writes[pass->num_writes++] = res_index;
+    }
+    _srg.num_passes++;
+    _srg.compiled = false;
+    return pass_index;
+}
+
+SOKOL_API_IMPL void srg_mark_output(sg_image img) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(img.id != SG_INVALID_ID);
+    const int res_index = _srg_lookup_resource(img.id);
+    if (res_index >= 0) {
+        _srg.resources[res_index].output = true;
+        _srg.compiled = false;
+    }
+}
+
+SOKOL_API_IMPL bool srg_compile(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    _srg.compiled = true;
+    _srg.num_edges = 0;
+    _srg.num_readers = 0;
+    _srg.num_exec = 0;
+    _srg_build_edges();
+    _srg_build_adjacency();
+    _srg.valid = _srg_sort();
+    if (_srg.valid) {
+        _srg_cull();
+    } else {
+        _SRG_ERROR(CYCLE_DETECTED);
+    }
+    _srg.stats.num_passes = _srg.num_passes;
+    _srg.stats.num_resources = _srg.num_resources;
+    _srg.stats.num_culled_passes = _srg.valid ? (_srg.num_passes - _srg.num_exec) : 0;
+    _srg.stats.num_executed_passes = 0;
+    return _srg.valid;
+}
+
+SOKOL_API_IMPL void srg_execute(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    if (!_srg.compiled) {
+        srg_compile();
+    }
+    if (!_srg.valid) {
+        return;
+    }
+    for (int i = 0; i < _srg.num_exec; i++) {
+        _srg_execute_pass(_srg.exec[i], i);
+    }
+    _srg.stats.num_executed_passes = _srg.num_exec;
+}
+
+SOKOL_API_IMPL srg_stats_t srg_query_stats(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    return _srg.stats;
+}
+
+SOKOL_API_IMPL bool srg_query_pass_culled(int pass_index) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    if (!_srg.compiled || !_srg.valid || (pass_index < 0) || (pass_index >= _srg.num_passes)) {
+        return false;
+    }
+    return _srg.passes[pass_index].culled;
+}
+
+#endif // SOKOL_RENDERGRAPH_IMPL